@@ -55,6 +55,7 @@
 #include <QStringList>
 #include <QHash>
 #include <QUrl>
+#include <QVariant>
 
 #include <private/qv4value_p.h>
 #include <private/qv4executableallocator_p.h>
@@ -1146,6 +1147,11 @@ public:
     // lookups by string (property name).
     QVector<BindingPropertyData> bindingPropertyDataPerObject;
 
+    // Literal binding values that have to be parsed from strings, such as
+    // colors, URLs or geometry. They are converted the first time the binding
+    // is applied and reused by every later instantiation of the type.
+    QHash<const Binding *, QVariant> convertedLiteralValues;
+
     // mapping from component object index (CompiledData::Unit object index that points to component) to identifier hash of named objects
     // this is initialized on-demand by QQmlContextData
     QHash<int, IdentifierHash> namedObjectsPerComponentCache;
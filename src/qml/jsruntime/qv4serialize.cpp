@@ -53,6 +53,8 @@
 #endif
 #include <private/qv4objectproto_p.h>
 #include <private/qv4qobjectwrapper_p.h>
+#include <private/qv4arraybuffer_p.h>
+#include <private/qv4mm_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -70,7 +72,14 @@ using namespace QV4;
 //    + Number
 //    + Date
 //    + RegExp
+//    + ArrayBuffer (copied, or moved when it is in the transfer list)
+//    + SharedArrayBuffer (shared)
 // <quint8 type><quint24 size><data>
+//
+// A message starts with the backing stores of its array buffers, as
+// <quint32 count><pointer>*count. The message holds a reference to each of
+// them until it is released, and the buffers refer to them by index, so a
+// buffer that appears several times in a message is received as one object.
 
 enum Type {
     WorkerUndefined,
@@ -86,6 +95,8 @@ enum Type {
     WorkerNumber,
     WorkerDate,
     WorkerRegexp,
+    WorkerArrayBuffer,
+    WorkerSharedArrayBuffer,
 #if QT_CONFIG(qml_list_model)
     WorkerListModel,
 #endif
@@ -153,8 +164,15 @@ static inline void *popPtr(const char *&data)
 // XXX TODO: Check that worker script is exception safe in the case of
 // serialization/deserialization failures
 
+struct Serialize::Buffers
+{
+    QVector<Heap::ArrayBuffer *> transfer;
+    QVector<Heap::SharedArrayBuffer *> sources;
+    QByteArray table;
+};
+
 #define ALIGN(size) (((size) + 3) & ~3)
-void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine *engine)
+void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine *engine, Buffers &buffers)
 {
     QV4::Scope scope(engine);
 
@@ -197,7 +215,7 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
         push(data, valueheader(WorkerArray, length));
         ScopedValue val(scope);
         for (uint ii = 0; ii < length; ++ii)
-            serialize(data, (val = array->get(ii)), engine);
+            serialize(data, (val = array->get(ii)), engine, buffers);
     } else if (v.isInteger()) {
         reserve(data, 2 * sizeof(quint32));
         push(data, valueheader(WorkerInt32));
@@ -250,6 +268,34 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
 #endif
         // No other QObject's are allowed to be sent
         push(data, valueheader(WorkerUndefined));
+    } else if (const SharedArrayBuffer *buffer = v.as<SharedArrayBuffer>()) {
+        Heap::SharedArrayBuffer *b = buffer->d();
+        if (b->isDetachedBuffer()) {
+            push(data, valueheader(WorkerUndefined));
+            return;
+        }
+        const Type type = b->isSharedArrayBuffer() ? WorkerSharedArrayBuffer : WorkerArrayBuffer;
+        int index = buffers.sources.indexOf(b);
+        if (index < 0) {
+            QTypedArrayData<char> *store = b->data;
+            if (type == WorkerSharedArrayBuffer
+                    || buffers.transfer.contains(static_cast<Heap::ArrayBuffer *>(b))) {
+                // A transferred source is detached once the whole message is serialized
+                store->ref.ref();
+            } else {
+                store = QTypedArrayData<char>::allocate(b->byteLength() + 1);
+                if (!store) {
+                    push(data, valueheader(WorkerUndefined));
+                    return;
+                }
+                store->size = b->data->size;
+                memcpy(store->data(), b->data->data(), b->byteLength() + 1);
+            }
+            index = buffers.sources.size();
+            buffers.sources.append(b);
+            push(buffers.table, (void *)store);
+        }
+        push(data, valueheader(type, index));
     } else if (const Object *o = v.as<Object>()) {
 #if QT_CONFIG(qml_sequence_object)
         if (o->isListType()) {
@@ -262,10 +308,10 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
             }
             reserve(data, sizeof(quint32) + length * sizeof(quint32));
             push(data, valueheader(WorkerSequence, length));
-            serialize(data, QV4::Value::fromInt32(QV4::SequencePrototype::metaTypeForSequence(o)), engine); // sequence type
+            serialize(data, QV4::Value::fromInt32(QV4::SequencePrototype::metaTypeForSequence(o)), engine, buffers); // sequence type
             ScopedValue val(scope);
             for (uint ii = 0; ii < seqLength; ++ii)
-                serialize(data, (val = o->get(ii)), engine); // sequence elements
+                serialize(data, (val = o->get(ii)), engine, buffers); // sequence elements
 
             return;
         }
@@ -284,14 +330,14 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
         QV4::ScopedValue s(scope);
         for (quint32 ii = 0; ii < length; ++ii) {
             s = properties->get(ii);
-            serialize(data, s, engine);
+            serialize(data, s, engine, buffers);
 
             QV4::String *str = s->as<String>();
             val = o->get(str);
             if (scope.hasException())
                 scope.engine->catchException();
 
-            serialize(data, val, engine);
+            serialize(data, val, engine, buffers);
         }
         return;
     } else {
@@ -299,7 +345,8 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
     }
 }
 
-ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
+ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine,
+                                     const char *bufferTable, Value *buffers)
 {
     quint32 header = popUint32(data);
     Type type = headertype(header);
@@ -331,7 +378,7 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         ScopedArrayObject a(scope, engine->newArrayObject());
         ScopedValue v(scope);
         for (quint32 ii = 0; ii < size; ++ii) {
-            v = deserialize(data, engine);
+            v = deserialize(data, engine, bufferTable, buffers);
             a->put(ii, v);
         }
         return a.asReturnedValue();
@@ -344,8 +391,8 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         ScopedString n(scope);
         ScopedValue value(scope);
         for (quint32 ii = 0; ii < size; ++ii) {
-            name = deserialize(data, engine);
-            value = deserialize(data, engine);
+            name = deserialize(data, engine, bufferTable, buffers);
+            value = deserialize(data, engine, bufferTable, buffers);
             n = name->asReturnedValue();
             o->put(n, value);
         }
@@ -367,11 +414,35 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         data += ALIGN(length * sizeof(quint16));
         return Encode(engine->newRegExpObject(pattern, flags));
     }
+    case WorkerArrayBuffer:
+    case WorkerSharedArrayBuffer:
+    {
+        const quint32 index = headersize(header);
+        if (buffers[index].isUndefined()) {
+            const char *entry = bufferTable + index * sizeof(void *);
+            QTypedArrayData<char> *store = static_cast<QTypedArrayData<char> *>(popPtr(entry));
+            // The message keeps its own reference until it is released
+            store->ref.ref();
+            QByteArrayDataPtr ptr = { store };
+            const QByteArray array(ptr);
+            if (type == WorkerSharedArrayBuffer)
+                buffers[index] = Encode(engine->memoryManager->allocate<SharedArrayBuffer>(array));
+            else
+                buffers[index] = Encode(engine->newArrayBuffer(array));
+        }
+        return buffers[index].asReturnedValue();
+    }
 #if QT_CONFIG(qml_list_model)
     case WorkerListModel:
     {
         void *ptr = popPtr(data);
         QQmlListModelWorkerAgent *agent = (QQmlListModelWorkerAgent *)ptr;
+        if (!agent->setEngine(engine)) {
+            qWarning("WorkerScript: a ListModel can only be used by the WorkerScripts of one thread; "
+                     "set QML_WORKERSCRIPT_MAX_THREADS=1 to run all scripts on the same thread");
+            agent->release();
+            return QV4::Encode::undefined();
+        }
         QV4::ScopedValue rv(scope, QV4::QObjectWrapper::wrap(engine, agent));
         // ### Find a better solution then the ugly property
         QQmlListModelWorkerAgent::VariantRef ref(agent);
@@ -381,7 +452,6 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         rv->as<Object>()->defineReadonlyProperty(s, v);
 
         agent->release();
-        agent->setEngine(engine);
         return rv->asReturnedValue();
     }
 #endif
@@ -392,12 +462,12 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         bool succeeded = false;
         quint32 length = headersize(header);
         quint32 seqLength = length - 1;
-        value = deserialize(data, engine);
+        value = deserialize(data, engine, bufferTable, buffers);
         int sequenceType = value->integerValue();
         ScopedArrayObject array(scope, engine->newArrayObject());
         array->arrayReserve(seqLength);
         for (quint32 ii = 0; ii < seqLength; ++ii) {
-            value = deserialize(data, engine);
+            value = deserialize(data, engine, bufferTable, buffers);
             array->arrayPut(ii, value);
         }
         array->setArrayLengthUnchecked(seqLength);
@@ -412,15 +482,86 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
 
 QByteArray Serialize::serialize(const QV4::Value &value, ExecutionEngine *engine)
 {
+    return serialize(value, QV4::Value::undefinedValue(), engine);
+}
+
+/*
+    Serializes \a value, moving the backing store of the ArrayBuffers listed in
+    \a transferList instead of copying it. The listed buffers are detached
+    afterwards. Throws a TypeError and returns an empty array if the list holds
+    anything but distinct, non-detached ArrayBuffers.
+
+    The message holds references that have to be dropped with release().
+*/
+QByteArray Serialize::serialize(const QV4::Value &value, const QV4::Value &transferList, ExecutionEngine *engine)
+{
+    Buffers buffers;
+
+    if (!transferList.isNullOrUndefined()) {
+        Scope scope(engine);
+        ScopedArrayObject list(scope, transferList);
+        if (!list) {
+            engine->throwTypeError(QStringLiteral("Serialize: the transfer list must be an array"));
+            return QByteArray();
+        }
+
+        const uint length = list->getLength();
+        buffers.transfer.reserve(length);
+        Scoped<ArrayBuffer> buffer(scope);
+        for (uint ii = 0; ii < length; ++ii) {
+            buffer = list->get(ii);
+            if (!buffer || buffer->isDetachedBuffer() || buffers.transfer.contains(buffer->d())) {
+                engine->throwTypeError(QStringLiteral("Serialize: only distinct, non-detached ArrayBuffers can be transferred"));
+                return QByteArray();
+            }
+            buffers.transfer.append(buffer->d());
+        }
+    }
+
+    QByteArray body;
+    serialize(body, value, engine, buffers);
+
+    for (Heap::ArrayBuffer *b : qAsConst(buffers.transfer))
+        b->detachArrayBuffer();
+
     QByteArray rv;
-    serialize(rv, value, engine);
+    reserve(rv, sizeof(quint32) + buffers.table.size() + body.size());
+    push(rv, quint32(buffers.sources.size()));
+    rv.append(buffers.table);
+    rv.append(body);
     return rv;
 }
 
 ReturnedValue Serialize::deserialize(const QByteArray &data, ExecutionEngine *engine)
 {
     const char *stream = data.constData();
-    return deserialize(stream, engine);
+    const quint32 bufferCount = popUint32(stream);
+    const char *bufferTable = stream;
+    stream += bufferCount * sizeof(void *);
+
+    Scope scope(engine);
+    Value *buffers = scope.alloc(bufferCount);
+    ScopedValue value(scope, deserialize(stream, engine, bufferTable, buffers));
+    return value->asReturnedValue();
+}
+
+/*
+    Drops the references \a data holds to the backing stores of its array
+    buffers. Every serialized message has to be released once, whether it was
+    deserialized or not.
+*/
+void Serialize::release(const QByteArray &data)
+{
+    if (data.isEmpty())
+        return;
+
+    const char *stream = data.constData();
+    const quint32 bufferCount = popUint32(stream);
+    for (quint32 ii = 0; ii < bufferCount; ++ii) {
+        QTypedArrayData<char> *store = static_cast<QTypedArrayData<char> *>(popPtr(stream));
+        if (!store->ref.deref())
+            QTypedArrayData<char>::deallocate(store);
+    }
 }
 
 QT_END_NAMESPACE
@@ -62,11 +62,15 @@ class Serialize {
 public:
 
     static QByteArray serialize(const Value &, ExecutionEngine *);
+    static QByteArray serialize(const Value &, const Value &transferList, ExecutionEngine *);
     static ReturnedValue deserialize(const QByteArray &, ExecutionEngine *);
+    static void release(const QByteArray &);
 
 private:
-    static void serialize(QByteArray &, const Value &, ExecutionEngine *);
-    static ReturnedValue deserialize(const char *&, ExecutionEngine *);
+    struct Buffers;
+
+    static void serialize(QByteArray &, const Value &, ExecutionEngine *, Buffers &);
+    static ReturnedValue deserialize(const char *&, ExecutionEngine *, const char *bufferTable, Value *buffers);
 };
 
 }
@@ -9,6 +9,7 @@ HEADERS +=  \
     $$PWD/qfinitestack_p.h \
     $$PWD/qrecursionwatcher_p.h \
     $$PWD/qrecyclepool_p.h \
+    $$PWD/qrecyclingallocator_p.h \
     $$PWD/qflagpointer_p.h \
     $$PWD/qlazilyallocated_p.h \
     $$PWD/qqmlnullablevalue_p.h
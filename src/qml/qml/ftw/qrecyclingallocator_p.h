@@ -0,0 +1,215 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QRECYCLINGALLOCATOR_P_H
+#define QRECYCLINGALLOCATOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qthreadstorage.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Recycles the memory of objects of type T through a per-thread pool.
+
+    Objects of exactly sizeof(T) are taken from, and returned to, a free list
+    instead of going through malloc and free each time. Subclasses of T with a
+    different size fall back to the global operator new and delete.
+
+    Every block remembers the pool it was taken from. Blocks freed on the
+    owning thread go straight back onto its free list. Blocks freed on any
+    other thread are pushed onto a lock-free list, which the owning thread
+    takes over the next time its own free list is empty. When the owning
+    thread exits, its pool stays alive until the last of its blocks has been
+    freed, so objects may outlive the thread that allocated them.
+
+    Use Q_QML_RECYCLING_ALLOCATOR(T) in the class declaration to route all
+    heap allocations of T through this allocator.
+*/
+template<typename T>
+class QRecyclingAllocator
+{
+    struct Pool;
+
+    struct Block {
+        Pool *pool;
+        Block *next;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+    };
+
+    enum { PageSize = 128 };
+
+    struct Page {
+        Page *next;
+        Block blocks[PageSize];
+    };
+
+    struct Pool {
+        // One reference for the owning thread plus one per allocated block.
+        QAtomicInt ref;
+        QAtomicPointer<void> owner;
+        Block *freeList = nullptr;
+        QAtomicPointer<Block> remoteFreeList;
+        Page *pages = nullptr;
+        int pageUsed = PageSize;
+
+        Pool() : ref(1), owner(QThread::currentThreadId()) {}
+        ~Pool()
+        {
+            while (pages) {
+                Page *next = pages->next;
+                delete pages;
+                pages = next;
+            }
+        }
+
+        Block *take()
+        {
+            if (!freeList)
+                freeList = remoteFreeList.fetchAndStoreAcquire(nullptr);
+            Block *block;
+            if (freeList) {
+                block = freeList;
+                freeList = block->next;
+            } else {
+                if (pageUsed == PageSize) {
+                    Page *page = new Page;
+                    page->next = pages;
+                    pages = page;
+                    pageUsed = 0;
+                }
+                block = &pages->blocks[pageUsed++];
+            }
+            block->pool = this;
+            ref.ref();
+            return block;
+        }
+
+        void give(Block *block)
+        {
+            if (owner.loadAcquire() == QThread::currentThreadId()) {
+                block->next = freeList;
+                freeList = block;
+            } else {
+                Block *head = remoteFreeList.load();
+                do {
+                    block->next = head;
+                } while (!remoteFreeList.testAndSetRelease(head, block, head));
+            }
+            deref();
+        }
+
+        void detach()
+        {
+            owner.storeRelease(nullptr);
+            deref();
+        }
+
+        void deref()
+        {
+            if (!ref.deref())
+                delete this;
+        }
+    };
+
+    struct ThreadPool {
+        Pool *pool = new Pool;
+        ~ThreadPool() { pool->detach(); }
+    };
+
+    static Pool *pool()
+    {
+        static QThreadStorage<ThreadPool *> pools;
+        if (!pools.hasLocalData())
+            pools.setLocalData(new ThreadPool);
+        return pools.localData()->pool;
+    }
+
+    static Block *blockFor(void *ptr)
+    {
+        return reinterpret_cast<Block *>(static_cast<char *>(ptr) - offsetof(Block, data));
+    }
+
+public:
+    static void *allocate(size_t size)
+    {
+        if (size != sizeof(T))
+            return ::operator new(size);
+        return &pool()->take()->data;
+    }
+
+    static void deallocate(void *ptr, size_t size)
+    {
+        if (!ptr)
+            return;
+        if (size != sizeof(T))
+            ::operator delete(ptr);
+        else
+            blockFor(ptr)->pool->give(blockFor(ptr));
+    }
+};
+
+#define Q_QML_RECYCLING_ALLOCATOR(Class) \
+public: \
+    static void *operator new(size_t size) \
+    { return QRecyclingAllocator<Class>::allocate(size); } \
+    static void operator delete(void *ptr, size_t size) \
+    { QRecyclingAllocator<Class>::deallocate(ptr, size); } \
+    static void *operator new(size_t, void *where) Q_DECL_NOTHROW { return where; } \
+    static void operator delete(void *, void *) Q_DECL_NOTHROW {}
+
+QT_END_NAMESPACE
+
+#endif // QRECYCLINGALLOCATOR_P_H
@@ -39,6 +39,9 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QTranslator>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+#include <QtCore/QSaveFile>
 #include <QQmlComponent>
 #include "qqmlapplicationengine.h"
 #include "qqmlapplicationengine_p.h"
@@ -65,6 +68,7 @@ void QQmlApplicationEnginePrivate::cleanUp()
 #if QT_CONFIG(translation)
     qDeleteAll(translators);
 #endif
+    releasePreloaded();
 }
 
 void QQmlApplicationEnginePrivate::init()
@@ -82,6 +86,10 @@ void QQmlApplicationEnginePrivate::init()
 #endif
     new QQmlFileSelector(q,q);
     QCoreApplication::instance()->setProperty("__qml_using_qqmlapplicationengine", QVariant(true));
+
+    preloadManifestOutput = qEnvironmentVariable("QML_PRELOAD_MANIFEST_OUTPUT");
+    if (!preloadManifestOutput.isEmpty())
+        typeLoader.setRecordingDependencies(true);
 }
 
 void QQmlApplicationEnginePrivate::loadTranslations(const QUrl &rootFile)
@@ -137,6 +145,7 @@ void QQmlApplicationEnginePrivate::finishLoad(QQmlComponent *c)
         objects << newObj;
         QObject::connect(newObj, &QObject::destroyed, q, [&](QObject *obj) { objects.removeAll(obj); });
         q->objectCreated(objects.constLast(), c->url());
+        writePreloadManifest();
         }
         break;
     case QQmlComponent::Loading:
@@ -144,9 +153,46 @@ void QQmlApplicationEnginePrivate::finishLoad(QQmlComponent *c)
         return; //These cases just wait for the next status update
     }
 
+    // Once a root component is done, its dependencies are held by its own
+    // compilation unit, so the preload references are no longer needed.
+    releasePreloaded();
     c->deleteLater();
 }
 
+void QQmlApplicationEnginePrivate::releasePreloaded()
+{
+    preloadedTypes.clear();
+    preloadedScripts.clear();
+}
+
+void QQmlApplicationEnginePrivate::writePreloadManifest()
+{
+    if (preloadManifestOutput.isEmpty())
+        return;
+
+    QSaveFile file(preloadManifestOutput);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "QQmlApplicationEngine failed to write preload manifest"
+                   << preloadManifestOutput << file.errorString();
+        return;
+    }
+
+    QTextStream stream(&file);
+    stream << "# QML preload manifest\n";
+    const QVector<QUrl> types = typeLoader.recordedTypes();
+    for (const QUrl &url : types)
+        stream << "type " << url.toString() << '\n';
+    const QVector<QUrl> scripts = typeLoader.recordedScripts();
+    for (const QUrl &url : scripts)
+        stream << "script " << url.toString() << '\n';
+    stream.flush();
+
+    if (!file.commit()) {
+        qWarning() << "QQmlApplicationEngine failed to write preload manifest"
+                   << preloadManifestOutput << file.errorString();
+    }
+}
+
 /*!
   \class QQmlApplicationEngine
   \since 5.1
@@ -188,6 +234,18 @@ void QQmlApplicationEnginePrivate::finishLoad(QQmlComponent *c)
   QML files and assets.
   \endlist
 
+  \section1 Preloading Dependencies
+
+  The QML documents and scripts a root file depends on are normally only
+  discovered once each of them has been parsed, so a deep component hierarchy
+  is fetched one level at a time. If the \c QML_PRELOAD_MANIFEST_OUTPUT
+  environment variable is set to a file name, the engine records every QML
+  document and JavaScript file it requests and writes them to that file each
+  time a root object has been created. On later runs, passing this manifest to
+  loadPreloadManifest() before calling load() starts fetching and compiling all
+  of the recorded dependencies up front, while the root file is still being
+  loaded.
+
   The engine behavior can be further tweaked by using the inherited methods from QQmlEngine.
 
 */
@@ -295,6 +353,76 @@ void QQmlApplicationEngine::loadData(const QByteArray &data, const QUrl &url)
     d->startLoad(url, data, true);
 }
 
+/*!
+  \since 5.13
+
+  Starts loading the QML documents and JavaScript files at \a urls in the
+  background, without waiting for any of them to finish.
+
+  URLs ending in \c{.js} are loaded as scripts, all other URLs are loaded as
+  QML documents. Relative URLs are resolved against the engine's base URL. When
+  a file loaded later through load() depends on one of the preloaded files, the
+  already started load is reused instead of being started on demand.
+
+  The engine keeps the preloaded files alive until the next root object has
+  been created, or loading it has failed.
+
+  \sa loadPreloadManifest()
+*/
+void QQmlApplicationEngine::preload(const QList<QUrl> &urls)
+{
+    Q_D(QQmlApplicationEngine);
+    for (const QUrl &url : urls) {
+        const QUrl resolved = baseUrl().resolved(url);
+        if (resolved.path().endsWith(QLatin1String(".js")))
+            d->preloadedScripts.append(d->typeLoader.getScript(resolved));
+        else
+            d->preloadedTypes.append(d->typeLoader.getType(resolved, QQmlTypeLoader::Asynchronous));
+    }
+}
+
+/*!
+  \since 5.13
+
+  Reads the preload manifest \a fileName and preloads all files listed in it.
+
+  A manifest contains one entry per line, either \c{type <url>} for a QML
+  document or \c{script <url>} for a JavaScript file. Empty lines and lines
+  starting with \c{#} are ignored. Such a manifest is written by the engine
+  when the \c QML_PRELOAD_MANIFEST_OUTPUT environment variable is set.
+
+  Returns \c false if the manifest could not be read.
+
+  \sa preload()
+*/
+bool QQmlApplicationEngine::loadPreloadManifest(const QString &fileName)
+{
+    Q_D(QQmlApplicationEngine);
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return false;
+
+    QTextStream stream(&file);
+    QString line;
+    while (stream.readLineInto(&line)) {
+        const QStringRef entry = line.midRef(0).trimmed();
+        if (entry.isEmpty() || entry.startsWith(QLatin1Char('#')))
+            continue;
+
+        const int space = entry.indexOf(QLatin1Char(' '));
+        if (space < 0)
+            continue;
+
+        const QStringRef kind = entry.left(space);
+        const QUrl url = baseUrl().resolved(QUrl(entry.mid(space + 1).trimmed().toString()));
+        if (kind == QLatin1String("type"))
+            d->preloadedTypes.append(d->typeLoader.getType(url, QQmlTypeLoader::Asynchronous));
+        else if (kind == QLatin1String("script"))
+            d->preloadedScripts.append(d->typeLoader.getScript(url));
+    }
+    return true;
+}
+
 /*!
   Returns a list of all the root objects instantiated by the
   QQmlApplicationEngine. This will only contain objects loaded via load() or a
@@ -63,6 +63,9 @@ public:
 #endif
     QList<QObject*> rootObjects() const;
 
+    void preload(const QList<QUrl> &urls);
+    bool loadPreloadManifest(const QString &fileName);
+
 public Q_SLOTS:
     void load(const QUrl &url);
     void load(const QString &filePath);
@@ -73,9 +73,15 @@ public:
     void startLoad(const QUrl &url, const QByteArray &data = QByteArray(), bool dataFlag = false);
     void loadTranslations(const QUrl &rootFile);
     void finishLoad(QQmlComponent *component);
+    void releasePreloaded();
+    void writePreloadManifest();
     QList<QObject *> objects;
     QObject *appObj;
 
+    QVector<QQmlRefPointer<QQmlTypeData>> preloadedTypes;
+    QVector<QQmlRefPointer<QQmlScriptBlob>> preloadedScripts;
+    QString preloadManifestOutput;
+
 #if QT_CONFIG(translation)
     QList<QTranslator *> translators;
 #endif
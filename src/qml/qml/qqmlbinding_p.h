@@ -63,6 +63,7 @@
 
 #include <private/qqmlabstractbinding_p.h>
 #include <private/qqmljavascriptexpression_p.h>
+#include <private/qrecyclingallocator_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -71,6 +72,7 @@ class Q_QML_PRIVATE_EXPORT QQmlBinding : public QQmlJavaScriptExpression,
                                          public QQmlAbstractBinding
 {
     friend class QQmlAbstractBinding;
+    Q_QML_RECYCLING_ALLOCATOR(QQmlBinding)
 public:
     typedef QExplicitlySharedDataPointer<QQmlBinding> Ptr;
 
@@ -60,11 +60,13 @@
 #include <private/qqmlrefcount_p.h>
 #include <private/qqmlglobal_p.h>
 #include <private/qbitfield_p.h>
+#include <private/qrecyclingallocator_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class Q_QML_PRIVATE_EXPORT QQmlBoundSignalExpression : public QQmlJavaScriptExpression, public QQmlRefCount
 {
+    Q_QML_RECYCLING_ALLOCATOR(QQmlBoundSignalExpression)
 public:
     QQmlBoundSignalExpression(QObject *target, int index,
                               QQmlContextData *ctxt, QObject *scope, const QString &expression,
@@ -102,6 +104,7 @@ private:
 
 class Q_QML_PRIVATE_EXPORT QQmlBoundSignal : public QQmlNotifierEndpoint
 {
+    Q_QML_RECYCLING_ALLOCATOR(QQmlBoundSignal)
 public:
     QQmlBoundSignal(QObject *target, int signal, QObject *owner, QQmlEngine *engine);
     ~QQmlBoundSignal();
@@ -244,9 +244,11 @@ void QQmlEnginePrivate::registerQtQuick2Types(const char *uri, int versionMajor,
 #if QT_CONFIG(qml_list_model)
     qmlRegisterType<QQmlListElement>(uri, versionMajor, versionMinor, "ListElement"); // Now in QtQml.Models, here for compatibility
     qmlRegisterCustomType<QQmlListModel>(uri, versionMajor, versionMinor, "ListModel", new QQmlListModelParser); // Now in QtQml.Models, here for compatibility
+    qmlRegisterCustomType<QQmlListModel, 13>(uri, versionMajor, 13, "ListModel", new QQmlListModelParser); //Only available in QtQuick >=2.13
 #endif
 #if QT_CONFIG(qml_worker_script)
     qmlRegisterType<QQuickWorkerScript>(uri, versionMajor, versionMinor, "WorkerScript");
+    qmlRegisterType<QQuickWorkerScript, 13>(uri, versionMajor, 13, "WorkerScript"); //Only available in QtQuick >=2.13
 #endif
     qmlRegisterType<QQuickPackage>(uri, versionMajor, versionMinor, "Package");
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
@@ -694,14 +696,15 @@ QQmlEnginePrivate::QQmlEnginePrivate(QQmlEngine *e)
   outputWarningsToMsgLog(true),
   cleanup(nullptr), erroredBindings(nullptr), inProgressCreations(0),
 #if QT_CONFIG(qml_worker_script)
-  workerScriptEngine(nullptr),
+  workerScriptEnginePool(nullptr),
 #endif
   activeObjectCreator(nullptr),
 #if QT_CONFIG(qml_network)
   networkAccessManager(nullptr), networkAccessManagerFactory(nullptr),
 #endif
   urlInterceptor(nullptr), scarceResourcesRefCount(0), importDatabase(e), typeLoader(e),
-  uniqueId(1), incubatorCount(0), incubationController(nullptr)
+  uniqueId(1), incubatorCount(0), incubationsCompleted(0), incubationController(nullptr),
+  lastIncubatedObjectCount(0), lastIncubationBudget(0), lastIncubationTime(0)
 {
 }
 
@@ -999,12 +1002,17 @@ void QQmlEnginePrivate::init()
 }
 
 #if QT_CONFIG(qml_worker_script)
-QQuickWorkerScriptEngine *QQmlEnginePrivate::getWorkerScriptEngine()
+QQuickWorkerScriptEngine *QQmlEnginePrivate::getWorkerScriptEngine(QThread::Priority priority)
+{
+    return getWorkerScriptEnginePool()->engineForPriority(priority);
+}
+
+QQuickWorkerScriptEnginePool *QQmlEnginePrivate::getWorkerScriptEnginePool()
 {
     Q_Q(QQmlEngine);
-    if (!workerScriptEngine)
-        workerScriptEngine = new QQuickWorkerScriptEngine(q);
-    return workerScriptEngine;
+    if (!workerScriptEnginePool)
+        workerScriptEnginePool = new QQuickWorkerScriptEnginePool(q);
+    return workerScriptEnginePool;
 }
 #endif
 
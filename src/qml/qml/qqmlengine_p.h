@@ -96,6 +96,7 @@ class QQmlComponentAttached;
 class QQmlCleanup;
 class QQmlDelayedError;
 class QQuickWorkerScriptEngine;
+class QQuickWorkerScriptEnginePool;
 class QQmlObjectCreator;
 class QDir;
 class QQmlIncubator;
@@ -154,8 +155,9 @@ public:
     QV4::ExecutionEngine *v4engine() const { return q_func()->handle(); }
 
 #if QT_CONFIG(qml_worker_script)
-    QQuickWorkerScriptEngine *getWorkerScriptEngine();
-    QQuickWorkerScriptEngine *workerScriptEngine;
+    QQuickWorkerScriptEngine *getWorkerScriptEngine(QThread::Priority priority = QThread::LowestPriority);
+    QQuickWorkerScriptEnginePool *getWorkerScriptEnginePool();
+    QQuickWorkerScriptEnginePool *workerScriptEnginePool;
 #endif
 
     QUrl baseUrl;
@@ -195,9 +197,15 @@ public:
         // Unfortunate workaround for MSVC
         QIntrusiveListNode nextWaitingFor;
     };
-    QIntrusiveList<Incubator, &Incubator::next> incubatorList;
+    // One list per QQmlIncubator::Priority, indexed by priority
+    QIntrusiveList<Incubator, &Incubator::next> incubatorList[3];
     unsigned int incubatorCount;
+    quint64 incubationsCompleted;
     QQmlIncubationController *incubationController;
+    // Of the last QQmlIncubationController::incubateFor() or incubateWhile() call
+    int lastIncubatedObjectCount;
+    int lastIncubationBudget;
+    qint64 lastIncubationTime;
     void incubate(QQmlIncubator &, QQmlContextData *);
 
     // These methods may be called from any thread
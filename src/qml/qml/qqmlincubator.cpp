@@ -45,6 +45,8 @@
 #include "qqmlmemoryprofiler_p.h"
 #include "qqmlobjectcreator_p.h"
 
+#include <QtCore/qelapsedtimer.h>
+
 void QQmlEnginePrivate::incubate(QQmlIncubator &i, QQmlContextData *forContext)
 {
     QExplicitlySharedDataPointer<QQmlIncubatorPrivate> p(i.d);
@@ -72,6 +74,9 @@ void QQmlEnginePrivate::incubate(QQmlIncubator &i, QQmlContextData *forContext)
             mode = QQmlIncubator::Asynchronous;
             p->waitingOnMe = parentIncubator;
             parentIncubator->waitingFor.insert(p.data());
+            // The parent cannot complete before this incubation, so it must
+            // not be scheduled after less urgent work.
+            p->raisePriority(parentIncubator->priority);
         }
     }
 
@@ -89,7 +94,7 @@ void QQmlEnginePrivate::incubate(QQmlIncubator &i, QQmlContextData *forContext)
             p->incubate(i);
         }
     } else {
-        incubatorList.insert(p.data());
+        incubatorList[p->priority].insert(p.data());
         incubatorCount++;
 
         p->vmeGuard.guard(p->creator.data());
@@ -127,7 +132,8 @@ QQmlIncubationController *QQmlEngine::incubationController() const
 }
 
 QQmlIncubatorPrivate::QQmlIncubatorPrivate(QQmlIncubator *q, QQmlIncubator::IncubationMode m)
-    : q(q), status(QQmlIncubator::Null), mode(m), isAsynchronous(false), progress(Execute),
+    : q(q), status(QQmlIncubator::Null), mode(m), priority(QQmlIncubator::NormalPriority),
+      isAsynchronous(false), progress(Execute),
       result(nullptr), enginePriv(nullptr), waitingOnMe(nullptr)
 {
 }
@@ -229,6 +235,39 @@ QQmlIncubationController::~QQmlIncubationController()
     d = nullptr;
 }
 
+void QQmlIncubatorPrivate::raisePriority(QQmlIncubator::Priority p)
+{
+    if (p <= priority)
+        return;
+    changePriority(p);
+    for (auto it = waitingFor.begin(), end = waitingFor.end(); it != end; ++it)
+        static_cast<QQmlIncubatorPrivate *>(*it)->raisePriority(p);
+}
+
+/*
+    Sets the priority and, if the incubator is queued, moves it to the
+    engine's list for the new priority.
+*/
+void QQmlIncubatorPrivate::changePriority(QQmlIncubator::Priority p)
+{
+    priority = p;
+    if (next.isInList())
+        enginePriv->incubatorList[p].insert(this);
+}
+
+/*
+    Returns the incubator with the highest priority. Incubators of equal
+    priority are processed in the order of the incubator list.
+*/
+static QQmlIncubatorPrivate *nextIncubator(QQmlEnginePrivate *d)
+{
+    for (int p = QQmlIncubator::HighPriority; p >= QQmlIncubator::LowPriority; --p) {
+        if (!d->incubatorList[p].isEmpty())
+            return static_cast<QQmlIncubatorPrivate *>(d->incubatorList[p].first());
+    }
+    return nullptr;
+}
+
 /*!
 Return the QQmlEngine this incubation controller is set on, or 0 if it
 has not been set on any engine.
@@ -366,6 +405,7 @@ finishIncubate:
         }
 
         enginePriv->inProgressCreations--;
+        enginePriv->incubationsCompleted++;
 
         if (0 == enginePriv->inProgressCreations) {
             while (enginePriv->erroredBindings)
@@ -384,11 +424,21 @@ void QQmlIncubationController::incubateFor(int msecs)
     if (!d || !d->incubatorCount)
         return;
 
+    const quint64 completedBefore = d->incubationsCompleted;
+    QElapsedTimer timer;
+    timer.start();
+
     QQmlInstantiationInterrupt i(msecs * 1000000);
     i.reset();
     do {
-        static_cast<QQmlIncubatorPrivate*>(d->incubatorList.first())->incubate(i);
+        nextIncubator(d)->incubate(i);
     } while (d && d->incubatorCount != 0 && !i.shouldInterrupt());
+
+    if (d) {
+        d->lastIncubatedObjectCount = int(d->incubationsCompleted - completedBefore);
+        d->lastIncubationTime = timer.nsecsElapsed();
+        d->lastIncubationBudget = msecs;
+    }
 }
 
 /*!
@@ -403,11 +453,65 @@ void QQmlIncubationController::incubateWhile(volatile bool *flag, int msecs)
     if (!d || !d->incubatorCount)
         return;
 
+    const quint64 completedBefore = d->incubationsCompleted;
+    QElapsedTimer timer;
+    timer.start();
+
     QQmlInstantiationInterrupt i(flag, msecs * 1000000);
     i.reset();
     do {
-        static_cast<QQmlIncubatorPrivate*>(d->incubatorList.first())->incubate(i);
+        nextIncubator(d)->incubate(i);
     } while (d && d->incubatorCount != 0 && !i.shouldInterrupt());
+
+    if (d) {
+        d->lastIncubatedObjectCount = int(d->incubationsCompleted - completedBefore);
+        d->lastIncubationTime = timer.nsecsElapsed();
+        d->lastIncubationBudget = msecs;
+    }
+}
+
+/*!
+\since 5.13
+
+Returns the number of objects that finished incubating during the last call to
+incubateFor() or incubateWhile().  Calls made while no objects were incubating
+are not counted.
+
+With the incubation controller of QQuickWindow, which incubates once per frame,
+this is the number of objects incubated in the last frame.
+
+\sa lastIncubationTime(), lastIncubationBudget()
+*/
+int QQmlIncubationController::lastIncubatedObjectCount() const
+{
+    return d ? d->lastIncubatedObjectCount : 0;
+}
+
+/*!
+\since 5.13
+
+Returns the time, in nanoseconds, spent in the last call to incubateFor() or
+incubateWhile() that had objects to incubate.
+
+\sa lastIncubatedObjectCount(), lastIncubationBudget()
+*/
+qint64 QQmlIncubationController::lastIncubationTime() const
+{
+    return d ? d->lastIncubationTime : 0;
+}
+
+/*!
+\since 5.13
+
+Returns the time limit, in milliseconds, that was passed to the last call to
+incubateFor() or incubateWhile() that had objects to incubate.  For
+incubateWhile(), 0 means there was no limit.
+
+\sa lastIncubatedObjectCount(), lastIncubationTime()
+*/
+int QQmlIncubationController::lastIncubationBudget() const
+{
+    return d ? d->lastIncubationBudget : 0;
 }
 
 /*!
@@ -528,6 +632,21 @@ incubation have completed.  Otherwise, the incubation will execute synchronously
 \value Synchronous The object will be created synchronously.
 */
 
+/*!
+\enum QQmlIncubator::Priority
+\since 5.13
+
+Specifies the order in which an incubation controller processes asynchronous
+incubators.  Incubators with a higher priority are incubated before any incubator
+with a lower priority.  Incubators with the same priority are incubated in an
+unspecified order.
+
+\value LowPriority The object is not needed soon, for example a prefetched delegate.
+\value NormalPriority The default priority.
+\value HighPriority The object is needed as soon as possible, for example a delegate
+that is already visible.
+*/
+
 /*!
 \enum QQmlIncubator::Status
 
@@ -640,6 +759,36 @@ QQmlIncubator::IncubationMode QQmlIncubator::incubationMode() const
     return d->mode;
 }
 
+/*!
+\since 5.13
+
+Return the priority of the incubator.  The default is NormalPriority.
+
+\sa setPriority()
+*/
+QQmlIncubator::Priority QQmlIncubator::priority() const
+{
+    return d->priority;
+}
+
+/*!
+\since 5.13
+
+Sets the \a priority of the incubator.  The priority can be changed at any time,
+including while the incubator is Loading.  Any incubations the object is waiting
+for are raised to at least the same priority.
+
+\sa priority()
+*/
+void QQmlIncubator::setPriority(Priority priority)
+{
+    if (priority < d->priority) {
+        d->changePriority(priority);
+        return;
+    }
+    d->raisePriority(priority);
+}
+
 /*!
 Return the current status of the incubator.
 */
@@ -58,6 +58,11 @@ public:
         AsynchronousIfNested,
         Synchronous
     };
+    enum Priority {
+        LowPriority,
+        NormalPriority,
+        HighPriority
+    };
     enum Status {
         Null,
         Ready,
@@ -80,6 +85,9 @@ public:
 
     IncubationMode incubationMode() const;
 
+    Priority priority() const;
+    void setPriority(Priority priority);
+
     Status status() const;
 
     QObject *object() const;
@@ -109,6 +117,10 @@ public:
     void incubateFor(int msecs);
     void incubateWhile(volatile bool *flag, int msecs=0);
 
+    int lastIncubatedObjectCount() const;
+    qint64 lastIncubationTime() const;
+    int lastIncubationBudget() const;
+
 protected:
     virtual void incubatingObjectCountChanged(int);
 
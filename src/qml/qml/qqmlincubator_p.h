@@ -77,6 +77,7 @@ public:
     QQmlIncubator::Status status;
 
     QQmlIncubator::IncubationMode mode;
+    QQmlIncubator::Priority priority;
     bool isAsynchronous;
 
     QList<QQmlError> errors;
@@ -99,6 +100,8 @@ public:
     QRecursionNode recursion;
 
     void clear();
+    void raisePriority(QQmlIncubator::Priority);
+    void changePriority(QQmlIncubator::Priority);
 
     void forceCompletion(QQmlInstantiationInterrupt &i);
     void incubate(QQmlInstantiationInterrupt &i);
@@ -361,6 +361,15 @@ bool QQmlObjectCreator::populateDeferredBinding(const QQmlProperty &qmlProperty,
     return errors.isEmpty();
 }
 
+template<typename Converter>
+const QVariant &QQmlObjectCreator::convertedLiteral(const QV4::CompiledData::Binding *binding, Converter convert)
+{
+    auto it = compilationUnit->convertedLiteralValues.find(binding);
+    if (it == compilationUnit->convertedLiteralValues.end())
+        it = compilationUnit->convertedLiteralValues.insert(binding, convert(binding->valueAsString(compilationUnit.data())));
+    return *it;
+}
+
 void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const QV4::CompiledData::Binding *binding)
 {
     QQmlPropertyData::WriteFlags propertyWriteFlags = QQmlPropertyData::BypassInterceptor | QQmlPropertyData::RemoveBindingOnAliasWrite;
@@ -409,12 +418,13 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
                 property->writeProperty(_qobject, &value, propertyWriteFlags);
             }
         } else {
-            QString stringValue = binding->valueAsString(compilationUnit.data());
             if (property->isVarProperty()) {
-                QV4::ScopedString s(scope, v4->newString(stringValue));
+                QV4::ScopedString s(scope, v4->newString(binding->valueAsString(compilationUnit.data())));
                 _vmeMetaObject->setVMEProperty(property->coreIndex(), s);
             } else {
-                QVariant value = QQmlStringConverters::variantFromString(stringValue);
+                QVariant value = convertedLiteral(binding, [](const QString &string) {
+                    return QQmlStringConverters::variantFromString(string);
+                });
                 property->writeProperty(_qobject, &value, propertyWriteFlags);
             }
         }
@@ -440,10 +450,12 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
     break;
     case QVariant::Url: {
         Q_ASSERT(binding->type == QV4::CompiledData::Binding::Type_String);
-        QString string = binding->valueAsString(compilationUnit.data());
-        // Encoded dir-separators defeat QUrl processing - decode them first
-        string.replace(QLatin1String("%2f"), QLatin1String("/"), Qt::CaseInsensitive);
-        QUrl value = string.isEmpty() ? QUrl() : compilationUnit->finalUrl().resolved(QUrl(string));
+        const QUrl baseUrl = compilationUnit->finalUrl();
+        QUrl value = convertedLiteral(binding, [&baseUrl](QString string) {
+            // Encoded dir-separators defeat QUrl processing - decode them first
+            string.replace(QLatin1String("%2f"), QLatin1String("/"), Qt::CaseInsensitive);
+            return QVariant(string.isEmpty() ? QUrl() : baseUrl.resolved(QUrl(string)));
+        }).toUrl();
         // Apply URL interceptor
         if (engine->urlInterceptor())
             value = engine->urlInterceptor()->intercept(value, QQmlAbstractUrlInterceptor::UrlString);
@@ -479,9 +491,12 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
     }
     break;
     case QVariant::Color: {
-        bool ok = false;
-        uint colorValue = QQmlStringConverters::rgbaFromString(binding->valueAsString(compilationUnit.data()), &ok);
-        Q_ASSERT(ok);
+        uint colorValue = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const uint rgba = QQmlStringConverters::rgbaFromString(string, &ok);
+            Q_ASSERT(ok);
+            return QVariant(rgba);
+        }).toUInt();
         struct { void *data[4]; } buffer;
         if (QQml_valueTypeProvider()->storeValueType(property->propType(), &colorValue, &buffer, sizeof(buffer))) {
             property->writeProperty(_qobject, &buffer, propertyWriteFlags);
@@ -490,72 +505,99 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
     break;
 #if QT_CONFIG(datestring)
     case QVariant::Date: {
-        bool ok = false;
-        QDate value = QQmlStringConverters::dateFromString(binding->valueAsString(compilationUnit.data()), &ok);
-        Q_ASSERT(ok);
+        QDate value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const QDate date = QQmlStringConverters::dateFromString(string, &ok);
+            Q_ASSERT(ok);
+            return QVariant(date);
+        }).toDate();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QVariant::Time: {
-        bool ok = false;
-        QTime value = QQmlStringConverters::timeFromString(binding->valueAsString(compilationUnit.data()), &ok);
-        Q_ASSERT(ok);
+        QTime value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const QTime time = QQmlStringConverters::timeFromString(string, &ok);
+            Q_ASSERT(ok);
+            return QVariant(time);
+        }).toTime();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QVariant::DateTime: {
-        bool ok = false;
-        QDateTime value = QQmlStringConverters::dateTimeFromString(binding->valueAsString(compilationUnit.data()), &ok);
-        // ### VME compatibility :(
-        {
-            const qint64 date = value.date().toJulianDay();
-            const int msecsSinceStartOfDay = value.time().msecsSinceStartOfDay();
-            value = QDateTime(QDate::fromJulianDay(date), QTime::fromMSecsSinceStartOfDay(msecsSinceStartOfDay));
-        }
-        Q_ASSERT(ok);
+        QDateTime value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            QDateTime dateTime = QQmlStringConverters::dateTimeFromString(string, &ok);
+            // ### VME compatibility :(
+            {
+                const qint64 date = dateTime.date().toJulianDay();
+                const int msecsSinceStartOfDay = dateTime.time().msecsSinceStartOfDay();
+                dateTime = QDateTime(QDate::fromJulianDay(date), QTime::fromMSecsSinceStartOfDay(msecsSinceStartOfDay));
+            }
+            Q_ASSERT(ok);
+            return QVariant(dateTime);
+        }).toDateTime();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
 #endif // datestring
     case QVariant::Point: {
-        bool ok = false;
-        QPoint value = QQmlStringConverters::pointFFromString(binding->valueAsString(compilationUnit.data()), &ok).toPoint();
-        Q_ASSERT(ok);
+        QPoint value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const QPoint converted = QQmlStringConverters::pointFFromString(string, &ok).toPoint();
+            Q_ASSERT(ok);
+            return QVariant(converted);
+        }).toPoint();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QVariant::PointF: {
-        bool ok = false;
-        QPointF value = QQmlStringConverters::pointFFromString(binding->valueAsString(compilationUnit.data()), &ok);
-        Q_ASSERT(ok);
+        QPointF value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const QPointF converted = QQmlStringConverters::pointFFromString(string, &ok);
+            Q_ASSERT(ok);
+            return QVariant(converted);
+        }).toPointF();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QVariant::Size: {
-        bool ok = false;
-        QSize value = QQmlStringConverters::sizeFFromString(binding->valueAsString(compilationUnit.data()), &ok).toSize();
-        Q_ASSERT(ok);
+        QSize value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const QSize converted = QQmlStringConverters::sizeFFromString(string, &ok).toSize();
+            Q_ASSERT(ok);
+            return QVariant(converted);
+        }).toSize();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QVariant::SizeF: {
-        bool ok = false;
-        QSizeF value = QQmlStringConverters::sizeFFromString(binding->valueAsString(compilationUnit.data()), &ok);
-        Q_ASSERT(ok);
+        QSizeF value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const QSizeF converted = QQmlStringConverters::sizeFFromString(string, &ok);
+            Q_ASSERT(ok);
+            return QVariant(converted);
+        }).toSizeF();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QVariant::Rect: {
-        bool ok = false;
-        QRect value = QQmlStringConverters::rectFFromString(binding->valueAsString(compilationUnit.data()), &ok).toRect();
-        Q_ASSERT(ok);
+        QRect value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const QRect converted = QQmlStringConverters::rectFFromString(string, &ok).toRect();
+            Q_ASSERT(ok);
+            return QVariant(converted);
+        }).toRect();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QVariant::RectF: {
-        bool ok = false;
-        QRectF value = QQmlStringConverters::rectFFromString(binding->valueAsString(compilationUnit.data()), &ok);
-        Q_ASSERT(ok);
+        QRectF value = convertedLiteral(binding, [](const QString &string) {
+            bool ok = false;
+            const QRectF converted = QQmlStringConverters::rectFFromString(string, &ok);
+            Q_ASSERT(ok);
+            return QVariant(converted);
+        }).toRectF();
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
@@ -570,9 +612,14 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
             float xp;
             float yp;
         } vec;
-        bool ok = QQmlStringConverters::createFromString(QMetaType::QVector2D, binding->valueAsString(compilationUnit.data()), &vec, sizeof(vec));
-        Q_ASSERT(ok);
-        Q_UNUSED(ok);
+        const QByteArray data = convertedLiteral(binding, [&vec](const QString &string) {
+            bool ok = QQmlStringConverters::createFromString(QMetaType::QVector2D, string, &vec, sizeof(vec));
+            Q_ASSERT(ok);
+            Q_UNUSED(ok);
+            return QVariant(QByteArray(reinterpret_cast<const char *>(&vec), sizeof(vec)));
+        }).toByteArray();
+        Q_ASSERT(data.size() == int(sizeof(vec)));
+        memcpy(&vec, data.constData(), sizeof(vec));
         property->writeProperty(_qobject, &vec, propertyWriteFlags);
     }
     break;
@@ -582,9 +629,14 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
             float yp;
             float zy;
         } vec;
-        bool ok = QQmlStringConverters::createFromString(QMetaType::QVector3D, binding->valueAsString(compilationUnit.data()), &vec, sizeof(vec));
-        Q_ASSERT(ok);
-        Q_UNUSED(ok);
+        const QByteArray data = convertedLiteral(binding, [&vec](const QString &string) {
+            bool ok = QQmlStringConverters::createFromString(QMetaType::QVector3D, string, &vec, sizeof(vec));
+            Q_ASSERT(ok);
+            Q_UNUSED(ok);
+            return QVariant(QByteArray(reinterpret_cast<const char *>(&vec), sizeof(vec)));
+        }).toByteArray();
+        Q_ASSERT(data.size() == int(sizeof(vec)));
+        memcpy(&vec, data.constData(), sizeof(vec));
         property->writeProperty(_qobject, &vec, propertyWriteFlags);
     }
     break;
@@ -595,9 +647,14 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
             float zy;
             float wp;
         } vec;
-        bool ok = QQmlStringConverters::createFromString(QMetaType::QVector4D, binding->valueAsString(compilationUnit.data()), &vec, sizeof(vec));
-        Q_ASSERT(ok);
-        Q_UNUSED(ok);
+        const QByteArray data = convertedLiteral(binding, [&vec](const QString &string) {
+            bool ok = QQmlStringConverters::createFromString(QMetaType::QVector4D, string, &vec, sizeof(vec));
+            Q_ASSERT(ok);
+            Q_UNUSED(ok);
+            return QVariant(QByteArray(reinterpret_cast<const char *>(&vec), sizeof(vec)));
+        }).toByteArray();
+        Q_ASSERT(data.size() == int(sizeof(vec)));
+        memcpy(&vec, data.constData(), sizeof(vec));
         property->writeProperty(_qobject, &vec, propertyWriteFlags);
     }
     break;
@@ -608,9 +665,14 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
             float yp;
             float zp;
         } vec;
-        bool ok = QQmlStringConverters::createFromString(QMetaType::QQuaternion, binding->valueAsString(compilationUnit.data()), &vec, sizeof(vec));
-        Q_ASSERT(ok);
-        Q_UNUSED(ok);
+        const QByteArray data = convertedLiteral(binding, [&vec](const QString &string) {
+            bool ok = QQmlStringConverters::createFromString(QMetaType::QQuaternion, string, &vec, sizeof(vec));
+            Q_ASSERT(ok);
+            Q_UNUSED(ok);
+            return QVariant(QByteArray(reinterpret_cast<const char *>(&vec), sizeof(vec)));
+        }).toByteArray();
+        Q_ASSERT(data.size() == int(sizeof(vec)));
+        memcpy(&vec, data.constData(), sizeof(vec));
         property->writeProperty(_qobject, &vec, propertyWriteFlags);
     }
     break;
@@ -670,7 +732,8 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
             break;
         }
 
-        // otherwise, try a custom type assignment
+        // otherwise, try a custom type assignment. Custom converters are not
+        // cached, as they may depend on state other than the literal.
         QString stringValue = binding->valueAsString(compilationUnit.data());
         QQmlMetaType::StringConverter converter = QQmlMetaType::customStringConverter(property->propType());
         Q_ASSERT(converter);
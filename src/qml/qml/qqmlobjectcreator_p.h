@@ -116,6 +116,8 @@ private:
     void setupBindings(bool applyDeferredBindings = false);
     bool setPropertyBinding(const QQmlPropertyData *property, const QV4::CompiledData::Binding *binding);
     void setPropertyValue(const QQmlPropertyData *property, const QV4::CompiledData::Binding *binding);
+    template<typename Converter>
+    const QVariant &convertedLiteral(const QV4::CompiledData::Binding *binding, Converter convert);
     void setupFunctions();
 
     QString stringAt(int idx) const { return compilationUnit->stringAt(idx); }
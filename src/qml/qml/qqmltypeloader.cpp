@@ -1693,6 +1693,8 @@ QQmlRefPointer<QQmlTypeData> QQmlTypeLoader::getType(const QUrl &unNormalizedUrl
         typeData = new QQmlTypeData(url, this);
         // TODO: if (compiledData == 0), is it safe to omit this insertion?
         m_typeCache.insert(url, typeData);
+        if (m_recordDependencies)
+            m_recordedTypes.append(url);
         QQmlMetaType::CachedUnitLookupError error = QQmlMetaType::CachedUnitLookupError::NoError;
         if (const QV4::CompiledData::Unit *cachedUnit = QQmlMetaType::findCachedCompilationUnit(typeData->url(), &error)) {
             QQmlTypeLoader::loadWithCachedUnit(typeData, cachedUnit, mode);
@@ -1751,6 +1753,8 @@ QQmlRefPointer<QQmlScriptBlob> QQmlTypeLoader::getScript(const QUrl &unNormalize
     if (!scriptBlob) {
         scriptBlob = new QQmlScriptBlob(url, this);
         m_scriptCache.insert(url, scriptBlob);
+        if (m_recordDependencies)
+            m_recordedScripts.append(url);
 
         QQmlMetaType::CachedUnitLookupError error;
         if (const QV4::CompiledData::Unit *cachedUnit = QQmlMetaType::findCachedCompilationUnit(scriptBlob->url(), &error)) {
@@ -2098,6 +2102,42 @@ bool QQmlTypeLoader::isScriptLoaded(const QUrl &url) const
     return m_scriptCache.contains(url);
 }
 
+/*!
+Enables or disables recording of the type and script URLs requested from this
+loader, in the order in which they are first requested. The recorded lists can
+be used to build a preload manifest, so that a later run can start fetching
+all dependencies up front instead of discovering them one level at a time.
+
+Enabling recording clears any previously recorded URLs.
+*/
+void QQmlTypeLoader::setRecordingDependencies(bool record)
+{
+    LockHolder<QQmlTypeLoader> holder(this);
+    if (record && !m_recordDependencies) {
+        m_recordedTypes.clear();
+        m_recordedScripts.clear();
+    }
+    m_recordDependencies = record;
+}
+
+bool QQmlTypeLoader::isRecordingDependencies() const
+{
+    LockHolder<QQmlTypeLoader> holder(const_cast<QQmlTypeLoader *>(this));
+    return m_recordDependencies;
+}
+
+QVector<QUrl> QQmlTypeLoader::recordedTypes() const
+{
+    LockHolder<QQmlTypeLoader> holder(const_cast<QQmlTypeLoader *>(this));
+    return m_recordedTypes;
+}
+
+QVector<QUrl> QQmlTypeLoader::recordedScripts() const
+{
+    LockHolder<QQmlTypeLoader> holder(const_cast<QQmlTypeLoader *>(this));
+    return m_recordedScripts;
+}
+
 QQmlTypeData::TypeDataCallback::~TypeDataCallback()
 {
 }
@@ -325,6 +325,11 @@ public:
     bool isTypeLoaded(const QUrl &url) const;
     bool isScriptLoaded(const QUrl &url) const;
 
+    void setRecordingDependencies(bool record);
+    bool isRecordingDependencies() const;
+    QVector<QUrl> recordedTypes() const;
+    QVector<QUrl> recordedScripts() const;
+
     void lock() { m_mutex.lock(); }
     void unlock() { m_mutex.unlock(); }
 
@@ -409,6 +414,10 @@ private:
     ImportDirCache m_importDirCache;
     ImportQmlDirCache m_importQmlDirCache;
 
+    QVector<QUrl> m_recordedTypes;
+    QVector<QUrl> m_recordedScripts;
+    bool m_recordDependencies = false;
+
     template<typename Loader>
     void doLoad(const Loader &loader, QQmlDataBlob *blob, Mode mode);
     void updateTypeCacheTrimThreshold();
@@ -253,6 +253,7 @@ QQmlDelegateModel::QQmlDelegateModel(QQmlContext *ctxt, QObject *parent)
 QQmlDelegateModel::~QQmlDelegateModel()
 {
     Q_D(QQmlDelegateModel);
+    d->m_reusableItemsPool.drain(0, [d](QQmlDelegateModelItem *cacheItem){ d->destroyCacheItem(cacheItem); });
     d->disconnectFromAbstractItemModel();
     d->m_adaptorModel.setObject(nullptr, this);
 
@@ -416,6 +417,9 @@ void QQmlDelegateModel::setModel(const QVariant &model)
     if (d->m_complete)
         _q_itemsRemoved(0, d->m_count);
 
+    // Pooled items were created for the old model's data type, so they cannot be reused
+    drainReusableItemsPool(0);
+
     d->disconnectFromAbstractItemModel();
     d->m_adaptorModel.setModel(model, this, d->m_context->engine());
     d->connectToAbstractItemModel();
@@ -454,6 +458,7 @@ void QQmlDelegateModel::setDelegate(QQmlComponent *delegate)
     }
     if (d->m_delegate == delegate)
         return;
+    drainReusableItemsPool(0);
     bool wasValid = d->m_delegate != nullptr;
     d->m_delegate.setObject(delegate, this);
     d->m_delegateValidated = false;
@@ -584,7 +589,7 @@ int QQmlDelegateModel::count() const
     return d->m_compositor.count(d->m_compositorGroup);
 }
 
-QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *object)
+QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *object, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     if (!object)
         return QQmlDelegateModel::ReleaseFlags(0);
@@ -596,6 +601,27 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
     if (!cacheItem->releaseObject())
         return QQmlDelegateModel::Referenced;
 
+    // An item can only be recycled if nothing but its delegate object refers to it. Items
+    // held from script, packages, and items proxying an object list are destroyed instead.
+    if (reusableFlag == QQmlInstanceModel::Reusable
+            && !cacheItem->incubationTask
+            && cacheItem->scriptRef == 1
+            && !(cacheItem->groups & Compositor::UnresolvedFlag)
+            && !m_adaptorModel.hasProxyObject()
+            && !qmlobject_cast<QQuickPackage *>(object)
+            && m_reusableItemsPool.insertItem(cacheItem)) {
+        removeCacheItem(cacheItem);
+        Q_EMIT q_func()->itemPooled(cacheItem->index, object);
+        return QQmlInstanceModel::Pooled;
+    }
+
+    destroyCacheItem(cacheItem);
+    return QQmlInstanceModel::Destroyed;
+}
+
+void QQmlDelegateModelPrivate::destroyCacheItem(QQmlDelegateModelItem *cacheItem)
+{
+    QObject *object = cacheItem->object;
     cacheItem->destroyObject();
     emitDestroyingItem(object);
     if (cacheItem->incubationTask) {
@@ -603,20 +629,41 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
         cacheItem->incubationTask = nullptr;
     }
     cacheItem->Dispose();
-    return QQmlInstanceModel::Destroyed;
 }
 
 /*
   Returns ReleaseStatus flags.
+
+  If \a reusableFlag is QQmlInstanceModel::Reusable, an object that is no
+  longer referenced is moved into a pool instead of being destroyed, and
+  Pooled is returned. A later call to object() for an index that resolves
+  to the same delegate will then get the pooled object back, with its
+  context updated to the new index, rather than a newly created one.
 */
 
-QQmlDelegateModel::ReleaseFlags QQmlDelegateModel::release(QObject *item)
+QQmlDelegateModel::ReleaseFlags QQmlDelegateModel::release(QObject *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     Q_D(QQmlDelegateModel);
-    QQmlInstanceModel::ReleaseFlags stat = d->release(item);
+    QQmlInstanceModel::ReleaseFlags stat = d->release(item, reusableFlag);
     return stat;
 }
 
+/*
+  Destroys the pooled objects that have not been reused within the
+  last \a maxPoolTime calls to this function.
+*/
+void QQmlDelegateModel::drainReusableItemsPool(int maxPoolTime)
+{
+    Q_D(QQmlDelegateModel);
+    d->m_reusableItemsPool.drain(maxPoolTime, [d](QQmlDelegateModelItem *cacheItem){ d->destroyCacheItem(cacheItem); });
+}
+
+int QQmlDelegateModel::poolSize()
+{
+    Q_D(QQmlDelegateModel);
+    return d->m_reusableItemsPool.size();
+}
+
 // Cancel a requested async item
 void QQmlDelegateModel::cancel(int index)
 {
@@ -935,6 +982,42 @@ void QQmlDelegateModelPrivate::removeCacheItem(QQmlDelegateModelItem *cacheItem)
     Q_ASSERT(m_cache.count() == m_compositor.count(Compositor::Cache));
 }
 
+void QQmlDelegateModelPrivate::reuseItem(QQmlDelegateModelItem *item, int newModelIndex, int newGroups)
+{
+    Q_ASSERT(item->object);
+
+    // The item was out of the cache while it was pooled, so its groups are stale
+    item->groups = newGroups;
+
+    // Update the context properties index, row and column on the delegate item,
+    // and notify the application that all role based context data has changed
+    // as well (their getter functions will use the updated index).
+    item->setModelIndex(newModelIndex, m_adaptorModel.rowAt(newModelIndex), m_adaptorModel.columnAt(newModelIndex));
+    const auto itemAsList = QList<QQmlDelegateModelItem *>() << item;
+    m_adaptorModel.notify(itemAsList, newModelIndex, 1, QVector<int>());
+
+    if (QQmlDelegateModelAttached *att = item->attached) {
+        // Let the attached DelegateModel object report the groups
+        // and indexes the item has in its new position.
+        att->resetCurrentIndex();
+        att->emitChanges();
+    }
+}
+
+QQmlComponent *QQmlDelegateModelPrivate::resolveDelegate(int index)
+{
+    if (!m_delegateChooser)
+        return m_delegate;
+
+    QQmlComponent *delegate = nullptr;
+    QQmlAbstractDelegateComponent *chooser = m_delegateChooser;
+    do {
+        delegate = chooser->delegate(&m_adaptorModel, index);
+        chooser = qobject_cast<QQmlAbstractDelegateComponent *>(delegate);
+    } while (chooser);
+    return delegate;
+}
+
 void QQmlDelegateModelPrivate::incubatorStatusChanged(QQDMIncubationTask *incubationTask, QQmlIncubator::Status status)
 {
     if (!isDoneIncubating(status))
@@ -1008,6 +1091,29 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
 
     QQmlDelegateModelItem *cacheItem = it->inCache() ? m_cache.at(it.cacheIndex) : 0;
 
+    if (!cacheItem && m_reusableItemsPool.size() > 0) {
+        // Recycle a pooled object created from the same delegate. It has already been
+        // incubated, otherwise it would not be in the pool, so it can be returned directly.
+        QQmlComponent *delegate = resolveDelegate(index);
+        if (!delegate)
+            return nullptr;
+        const int modelIndex = it.modelIndex();
+        cacheItem = m_reusableItemsPool.takeItem(delegate, modelIndex);
+        if (cacheItem) {
+            // Adding the item to the cache moves the iterator, so read it first
+            const int groups = it->flags;
+            addCacheItem(cacheItem, it);
+            reuseItem(cacheItem, modelIndex, groups);
+            cacheItem->referenceObject();
+
+            if (index == m_compositor.count(group) - 1)
+                requestMoreIfNecessary();
+
+            Q_EMIT q_func()->itemReused(index, cacheItem->object);
+            return cacheItem->object;
+        }
+    }
+
     if (!cacheItem) {
         cacheItem = m_adaptorModel.createItem(m_cacheMetaType, it.modelIndex());
         if (!cacheItem)
@@ -1029,22 +1135,20 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
             cacheItem->incubationTask->forceCompletion();
         }
     } else if (!cacheItem->object) {
-        QQmlComponent *delegate = m_delegate;
-        if (m_delegateChooser) {
-            QQmlAbstractDelegateComponent *chooser = m_delegateChooser;
-            do {
-                delegate = chooser->delegate(&m_adaptorModel, index);
-                chooser = qobject_cast<QQmlAbstractDelegateComponent *>(delegate);
-            } while (chooser);
-            if (!delegate)
-                return nullptr;
-        }
+        QQmlComponent *delegate = resolveDelegate(index);
+        if (!delegate)
+            return nullptr;
+        cacheItem->delegate = delegate;
 
         QQmlContext *creationContext = delegate->creationContext();
 
         cacheItem->scriptRef += 1;
 
         cacheItem->incubationTask = new QQDMIncubationTask(this, incubationMode);
+        // Delegates that are only asynchronous because the view itself is being
+        // incubated are needed for display, unlike those created ahead of time.
+        if (incubationMode == QQmlIncubator::AsynchronousIfNested)
+            cacheItem->incubationTask->setPriority(QQmlIncubator::HighPriority);
         cacheItem->incubationTask->incubating = cacheItem;
         cacheItem->incubationTask->clear();
 
@@ -3185,6 +3289,86 @@ void QQmlDelegateModelGroup::move(QQmlV4Function *args)
 
 //============================================================================
 
+static int qml_reusable_items_pool_max_size()
+{
+    static const int maxSize = qMax(0, qEnvironmentVariableIntValue("QML_REUSABLE_ITEMS_POOL_SIZE"));
+    return maxSize;
+}
+
+QQmlReusableDelegateModelItemsPool::QQmlReusableDelegateModelItemsPool()
+    : m_maxSize(qml_reusable_items_pool_max_size())
+{
+}
+
+/*
+  Adds \a modelItem to the pool, unless the pool already holds maxSize()
+  items, in which case false is returned and the caller should destroy the
+  item. A maxSize() of 0 means that the pool is not limited.
+*/
+bool QQmlReusableDelegateModelItemsPool::insertItem(QQmlDelegateModelItem *modelItem)
+{
+    Q_ASSERT(modelItem->object);
+
+    if (m_maxSize > 0 && m_reusableItemsPool.size() >= m_maxSize)
+        return false;
+
+    modelItem->poolTime = 0;
+    m_reusableItemsPool.append(modelItem);
+    return true;
+}
+
+/*
+  Removes and returns a pooled item that was created from \a delegate. An item
+  that last showed \a newIndexHint is preferred, since its context then needs
+  no update (e.g when the same item is flicked out and back into a view).
+  Otherwise the oldest matching item is returned.
+*/
+QQmlDelegateModelItem *QQmlReusableDelegateModelItemsPool::takeItem(const QQmlComponent *delegate, int newIndexHint)
+{
+    auto match = m_reusableItemsPool.end();
+    for (auto it = m_reusableItemsPool.begin(); it != m_reusableItemsPool.end(); ++it) {
+        if ((*it)->delegate != delegate)
+            continue;
+        if (match == m_reusableItemsPool.end())
+            match = it;
+        if ((*it)->modelIndex() == newIndexHint) {
+            match = it;
+            break;
+        }
+    }
+
+    if (match == m_reusableItemsPool.end())
+        return nullptr;
+
+    QQmlDelegateModelItem *modelItem = *match;
+    m_reusableItemsPool.erase(match);
+    return modelItem;
+}
+
+/*
+  Rather than releasing all pooled items upon a call to this function, each
+  item has a poolTime. The poolTime specifies for how many loading cycles an item
+  has been resting in the pool. And for each invocation of this function, poolTime
+  will increase. If poolTime exceeds \a maxPoolTime, the item is removed from the
+  pool and handed to \a releaseItem. This way, the view can tweak for how long
+  items should stay in "circulation", even if they are not recycled right away.
+*/
+void QQmlReusableDelegateModelItemsPool::drain(int maxPoolTime, std::function<void(QQmlDelegateModelItem *cacheItem)> releaseItem)
+{
+    for (auto it = m_reusableItemsPool.begin(); it != m_reusableItemsPool.end();) {
+        QQmlDelegateModelItem *modelItem = *it;
+        modelItem->poolTime++;
+        if (modelItem->poolTime <= maxPoolTime) {
+            ++it;
+        } else {
+            it = m_reusableItemsPool.erase(it);
+            releaseItem(modelItem);
+        }
+    }
+}
+
+//============================================================================
+
 QQmlPartsModel::QQmlPartsModel(QQmlDelegateModel *model, const QString &part, QObject *parent)
     : QQmlInstanceModel(*new QObjectPrivate, parent)
     , m_model(model)
@@ -3335,7 +3519,7 @@ QObject *QQmlPartsModel::object(int index, QQmlIncubator::IncubationMode incubat
     return nullptr;
 }
 
-QQmlInstanceModel::ReleaseFlags QQmlPartsModel::release(QObject *item)
+QQmlInstanceModel::ReleaseFlags QQmlPartsModel::release(QObject *item, ReusableFlag)
 {
     QQmlInstanceModel::ReleaseFlags flags = nullptr;
 
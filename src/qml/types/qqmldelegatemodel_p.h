@@ -112,7 +112,7 @@ public:
     int count() const override;
     bool isValid() const override { return delegate() != nullptr; }
     QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
-    ReleaseFlags release(QObject *object) override;
+    ReleaseFlags release(QObject *object, ReusableFlag reusableFlag = NotReusable) override;
     void cancel(int index) override;
     QString stringValue(int index, const QString &role) override;
     void setWatchedRoles(const QList<QByteArray> &roles) override;
@@ -131,6 +131,9 @@ public:
 
     const QAbstractItemModel *abstractItemModel() const override;
 
+    void drainReusableItemsPool(int maxPoolTime) override;
+    int poolSize() override;
+
     bool event(QEvent *) override;
 
     static QQmlDelegateModelAttached *qmlAttachedProperties(QObject *obj);
@@ -49,6 +49,8 @@
 #include <private/qqmladaptormodel_p.h>
 #include <private/qqmlopenmetaobject_p.h>
 
+#include <functional>
+
 //
 //  W A R N I N G
 //  -------------
@@ -209,6 +211,24 @@ public:
     int index[QQmlListCompositor::MaximumGroupCount];
 };
 
+class QQmlReusableDelegateModelItemsPool
+{
+public:
+    QQmlReusableDelegateModelItemsPool();
+
+    bool insertItem(QQmlDelegateModelItem *modelItem);
+    QQmlDelegateModelItem *takeItem(const QQmlComponent *delegate, int newIndexHint);
+    void drain(int maxPoolTime, std::function<void(QQmlDelegateModelItem *cacheItem)> releaseItem);
+    int size() const { return m_reusableItemsPool.size(); }
+
+    int maxSize() const { return m_maxSize; }
+    void setMaxSize(int maxSize) { m_maxSize = maxSize; }
+
+private:
+    QList<QQmlDelegateModelItem *> m_reusableItemsPool;
+    int m_maxSize;
+};
+
 
 class QQmlDelegateModelGroupEmitter
 {
@@ -275,7 +295,7 @@ public:
 
     void requestMoreIfNecessary();
     QObject *object(Compositor::Group group, int index, QQmlIncubator::IncubationMode incubationMode);
-    QQmlDelegateModel::ReleaseFlags release(QObject *object);
+    QQmlDelegateModel::ReleaseFlags release(QObject *object, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable);
     QString stringValue(Compositor::Group group, int index, const QString &name);
     void emitCreatedPackage(QQDMIncubationTask *incubationTask, QQuickPackage *package);
     void emitInitPackage(QQDMIncubationTask *incubationTask, QQuickPackage *package);
@@ -287,6 +307,9 @@ public:
     void emitDestroyingItem(QObject *item) { Q_EMIT q_func()->destroyingItem(item); }
     void addCacheItem(QQmlDelegateModelItem *item, Compositor::iterator it);
     void removeCacheItem(QQmlDelegateModelItem *cacheItem);
+    void destroyCacheItem(QQmlDelegateModelItem *cacheItem);
+    void reuseItem(QQmlDelegateModelItem *item, int newModelIndex, int newGroups);
+    QQmlComponent *resolveDelegate(int index);
 
     void updateFilterGroup();
 
@@ -334,6 +357,7 @@ public:
     QQmlDelegateModelGroupEmitterList m_pendingParts;
 
     QList<QQmlDelegateModelItem *> m_cache;
+    QQmlReusableDelegateModelItemsPool m_reusableItemsPool;
     QList<QQDMIncubationTask *> m_finishedIncubating;
     QList<QByteArray> m_watchedRoles;
 
@@ -377,7 +401,7 @@ public:
     int count() const override;
     bool isValid() const override;
     QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
-    ReleaseFlags release(QObject *item) override;
+    ReleaseFlags release(QObject *item, ReusableFlag reusableFlag = NotReusable) override;
     QString stringValue(int index, const QString &role) override;
     QList<QByteArray> watchedRoles() const { return m_watchedRoles; }
     void setWatchedRoles(const QList<QByteArray> &roles) override;
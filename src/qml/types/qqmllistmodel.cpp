@@ -63,6 +63,8 @@
 #include <QtCore/qdatetime.h>
 #include <QScopedValueRollback>
 
+#include <algorithm>
+
 Q_DECLARE_METATYPE(const QV4::CompiledData::Binding*);
 
 QT_BEGIN_NAMESPACE
@@ -127,8 +129,9 @@ const ListLayout::Role &ListLayout::getRoleOrCreate(QV4::String *key, Role::Data
 
 const ListLayout::Role &ListLayout::createRole(const QString &key, ListLayout::Role::DataType type)
 {
-    const int dataSizes[] = { sizeof(StringOrTranslation), sizeof(double), sizeof(bool), sizeof(ListModel *), sizeof(QPointer<QObject>), sizeof(QVariantMap), sizeof(QDateTime), sizeof(QJSValue) };
-    const int dataAlignments[] = { sizeof(StringOrTranslation), sizeof(double), sizeof(bool), sizeof(ListModel *), sizeof(QObject *), sizeof(QVariantMap), sizeof(QDateTime), sizeof(QJSValue) };
+    // String, Number and Bool roles live in the columns of the model and take no block space
+    const int dataSizes[] = { 0, 0, 0, sizeof(ListModel *), sizeof(QPointer<QObject>), sizeof(QVariantMap), sizeof(QDateTime), sizeof(QJSValue) };
+    const int dataAlignments[] = { 1, 1, 1, sizeof(ListModel *), sizeof(QObject *), sizeof(QVariantMap), sizeof(QDateTime), sizeof(QJSValue) };
 
     Role *r = new Role;
     r->name = key;
@@ -140,6 +143,12 @@ const ListLayout::Role &ListLayout::createRole(const QString &key, ListLayout::R
         r->subLayout = nullptr;
     }
 
+    if (isColumnType(type)) {
+        // Scalar roles are stored in the columns of the model, not in the element blocks
+        r->column = currentColumn++;
+        return appendRole(r);
+    }
+
     int dataSize = dataSizes[type];
     int dataAlignment = dataAlignments[type];
 
@@ -154,16 +163,20 @@ const ListLayout::Role &ListLayout::createRole(const QString &key, ListLayout::R
         currentBlockOffset = dataOffset + dataSize;
     }
 
-    int roleIndex = roles.count();
-    r->index = roleIndex;
+    return appendRole(r);
+}
+
+const ListLayout::Role &ListLayout::appendRole(Role *r)
+{
+    r->index = roles.count();
 
     roles.append(r);
-    roleHash.insert(key, r);
+    roleHash.insert(r->name, r);
 
     return *r;
 }
 
-ListLayout::ListLayout(const ListLayout *other) : currentBlock(0), currentBlockOffset(0)
+ListLayout::ListLayout(const ListLayout *other) : currentBlock(0), currentBlockOffset(0), currentColumn(0)
 {
     const int otherRolesCount = other->roles.count();
     roles.reserve(otherRolesCount);
@@ -174,6 +187,7 @@ ListLayout::ListLayout(const ListLayout *other) : currentBlock(0), currentBlockO
     }
     currentBlockOffset = other->currentBlockOffset;
     currentBlock = other->currentBlock;
+    currentColumn = other->currentColumn;
 }
 
 ListLayout::~ListLayout()
@@ -194,6 +208,7 @@ void ListLayout::sync(ListLayout *src, ListLayout *target)
 
     target->currentBlockOffset = src->currentBlockOffset;
     target->currentBlock = src->currentBlock;
+    target->currentColumn = src->currentColumn;
 }
 
 ListLayout::Role::Role(const Role *other)
@@ -202,6 +217,7 @@ ListLayout::Role::Role(const Role *other)
     type = other->type;
     blockIndex = other->blockIndex;
     blockOffset = other->blockOffset;
+    column = other->column;
     index = other->index;
     if (other->subLayout)
         subLayout = new ListLayout(other->subLayout);
@@ -268,73 +284,67 @@ const ListLayout::Role *ListLayout::getExistingRole(QV4::String *key) const
     return r;
 }
 
-StringOrTranslation::StringOrTranslation(const QString &s)
+int ListStringPool::allocate()
 {
-    d.setFlag();
-    setString(s);
+    if (!m_freeIds.isEmpty())
+        return m_freeIds.takeLast();
+    m_entries.append(Entry());
+    return m_entries.count() - 1;
 }
 
-StringOrTranslation::StringOrTranslation(const QV4::CompiledData::Binding *binding)
+int ListStringPool::intern(const QString &s)
 {
-    d.setFlag();
-    clear();
-    d = binding;
-}
+    QHash<QString, int>::const_iterator it = m_stringIds.constFind(s);
+    if (it != m_stringIds.constEnd()) {
+        ++m_entries[*it].refCount;
+        return *it;
+    }
 
-StringOrTranslation::~StringOrTranslation()
-{
-    clear();
+    const int id = allocate();
+    Entry &e = m_entries[id];
+    e.string = s;
+    e.refCount = 1;
+    m_stringIds.insert(s, id);
+    return id;
 }
 
-void StringOrTranslation::setString(const QString &s)
+int ListStringPool::intern(const QV4::CompiledData::Binding *translation)
 {
-    d.setFlag();
-    clear();
-    QStringData *stringData = const_cast<QString &>(s).data_ptr();
-    d = stringData;
-    if (stringData)
-        stringData->ref.ref();
-}
+    QHash<const QV4::CompiledData::Binding *, int>::const_iterator it = m_translationIds.constFind(translation);
+    if (it != m_translationIds.constEnd()) {
+        ++m_entries[*it].refCount;
+        return *it;
+    }
 
-void StringOrTranslation::setTranslation(const QV4::CompiledData::Binding *binding)
-{
-    d.setFlag();
-    clear();
-    d = binding;
+    const int id = allocate();
+    Entry &e = m_entries[id];
+    e.translation = translation;
+    e.refCount = 1;
+    m_translationIds.insert(translation, id);
+    return id;
 }
 
-QString StringOrTranslation::toString(const QQmlListModel *owner) const
+int ListStringPool::intern(const ListStringPool &other, int id)
 {
-    if (d.isNull())
-        return QString();
-    if (d.isT1()) {
-        QStringDataPtr holder = { d.asT1() };
-        holder.ptr->ref.ref();
-        return QString(holder);
-    }
-    if (!owner)
-        return QString();
-    return d.asT2()->valueAsString(owner->m_compilationUnit.data());
+    const Entry &e = other.m_entries.at(id);
+    if (e.translation)
+        return intern(e.translation);
+    return intern(e.string);
 }
 
-QString StringOrTranslation::asString() const
+void ListStringPool::deref(int id)
 {
-    if (d.isNull())
-        return QString();
-    if (!d.isT1())
-        return QString();
-    QStringDataPtr holder = { d.asT1() };
-    holder.ptr->ref.ref();
-    return QString(holder);
-}
+    Entry &e = m_entries[id];
+    Q_ASSERT(e.refCount > 0);
+    if (--e.refCount)
+        return;
 
-void StringOrTranslation::clear()
-{
-    if (QStringData *strData = d.isT1() ? d.asT1() : nullptr) {
-        if (!strData->ref.deref())
-            QStringData::deallocate(strData);
-    }
-    d = static_cast<QStringData *>(nullptr);
+    if (e.translation)
+        m_translationIds.remove(e.translation);
+    else
+        m_stringIds.remove(e.string);
+    e = Entry();
+    m_freeIds.append(id);
 }
 
 QObject *ListModel::getOrCreateModelObject(QQmlListModel *model, int elementIndex)
@@ -402,6 +412,7 @@ bool ListModel::sync(ListModel *src, ListModel *target)
                 targetModel->beginRemoveRows(QModelIndex(), i, i);
             s.target->destroy(target->m_layout);
             target->elements.removeOne(s.target);
+            target->removeColumnRows(i, 1);
             delete s.target;
             if (targetModel)
                 targetModel->endRemoveRows();
@@ -415,6 +426,8 @@ bool ListModel::sync(ListModel *src, ListModel *target)
     ListLayout::sync(src->m_layout, target->m_layout);
 
     // Clear the target list, and append in correct order from the source
+    QVector<ElementSync *> rows;
+    rows.reserve(src->elements.count());
     target->elements.clear();
     for (int i = 0; i < src->elements.count(); ++i) {
         ListElement *srcElement = src->elements.at(i);
@@ -426,8 +439,11 @@ bool ListModel::sync(ListModel *src, ListModel *target)
         }
         s.changedRoles = ListElement::sync(srcElement, src->m_layout, targetElement, target->m_layout);
         target->elements.append(targetElement);
+        rows.append(&s);
     }
 
+    target->syncColumns(src, rows);
+
     target->updateCacheIndices();
 
     // Update values stored in target meta objects
@@ -518,6 +534,22 @@ void ListModel::move(int from, int to, int n)
     for (int i=0 ; i < store.count() ; ++i)
         elements[from+i] = store[i];
 
+    for (ListColumn &c : m_columns) {
+        switch (c.type) {
+        case ListLayout::Role::Number:
+            std::rotate(c.numbers.begin() + from, c.numbers.begin() + from + n, c.numbers.begin() + to + n);
+            break;
+        case ListLayout::Role::Bool:
+            std::rotate(c.bools.begin() + from, c.bools.begin() + from + n, c.bools.begin() + to + n);
+            break;
+        case ListLayout::Role::String:
+            std::rotate(c.strings.begin() + from, c.strings.begin() + from + n, c.strings.begin() + to + n);
+            break;
+        default:
+            break;
+        }
+    }
+
     updateCacheIndices(from, to + n);
 }
 
@@ -525,6 +557,27 @@ void ListModel::newElement(int index)
 {
     ListElement *e = new ListElement;
     elements.insert(index, e);
+    insertColumnRows(index, 1);
+}
+
+void ListModel::reserve(int count)
+{
+    elements.reserve(count);
+    for (ListColumn &c : m_columns) {
+        switch (c.type) {
+        case ListLayout::Role::Number:
+            c.numbers.reserve(count);
+            break;
+        case ListLayout::Role::Bool:
+            c.bools.reserve(count);
+            break;
+        case ListLayout::Role::String:
+            c.strings.reserve(count);
+            break;
+        default:
+            break;
+        }
+    }
 }
 
 void ListModel::updateCacheIndices(int start, int end)
@@ -545,8 +598,10 @@ QVariant ListModel::getProperty(int elementIndex, int roleIndex, const QQmlListM
 {
     if (roleIndex >= m_layout->roleCount())
         return QVariant();
-    ListElement *e = elements[elementIndex];
     const ListLayout::Role &r = m_layout->getExistingRole(roleIndex);
+    if (r.column >= 0)
+        return getColumnProperty(elementIndex, r, owner);
+    ListElement *e = elements[elementIndex];
     return e->getProperty(r, owner, eng);
 }
 
@@ -578,10 +633,10 @@ void ListModel::set(int elementIndex, QV4::Object *object, QVector<int> *roles)
         // Add the value now
         if (const QV4::String *s = propertyValue->as<QV4::String>()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::String);
-            roleIndex = e->setStringProperty(r, s->toQString());
+            roleIndex = setStringProperty(elementIndex, r, s->toQString());
         } else if (propertyValue->isNumber()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::Number);
-            roleIndex = e->setDoubleProperty(r, propertyValue->asDouble());
+            roleIndex = setDoubleProperty(elementIndex, r, propertyValue->asDouble());
         } else if (QV4::ArrayObject *a = propertyValue->as<QV4::ArrayObject>()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::List);
             ListModel *subModel = new ListModel(r.subLayout, nullptr);
@@ -595,7 +650,7 @@ void ListModel::set(int elementIndex, QV4::Object *object, QVector<int> *roles)
             roleIndex = e->setListProperty(r, subModel);
         } else if (propertyValue->isBoolean()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::Bool);
-            roleIndex = e->setBoolProperty(r, propertyValue->booleanValue());
+            roleIndex = setBoolProperty(elementIndex, r, propertyValue->booleanValue());
         } else if (QV4::DateObject *dd = propertyValue->as<QV4::DateObject>()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::DateTime);
             QDateTime dt = dd->toQDateTime();
@@ -622,7 +677,7 @@ void ListModel::set(int elementIndex, QV4::Object *object, QVector<int> *roles)
         } else if (propertyValue->isNullOrUndefined()) {
             const ListLayout::Role *r = m_layout->getExistingRole(propertyName);
             if (r)
-                e->clearProperty(*r);
+                clearProperty(elementIndex, *r);
         }
 
         if (roleIndex != -1)
@@ -656,11 +711,11 @@ void ListModel::set(int elementIndex, QV4::Object *object)
         if (QV4::String *s = propertyValue->stringValue()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::String);
             if (r.type == ListLayout::Role::String)
-                e->setStringPropertyFast(r, s->toQString());
+                setStringProperty(elementIndex, r, s->toQString());
         } else if (propertyValue->isNumber()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::Number);
             if (r.type == ListLayout::Role::Number) {
-                e->setDoublePropertyFast(r, propertyValue->asDouble());
+                setDoubleProperty(elementIndex, r, propertyValue->asDouble());
             }
         } else if (QV4::ArrayObject *a = propertyValue->as<QV4::ArrayObject>()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::List);
@@ -678,7 +733,7 @@ void ListModel::set(int elementIndex, QV4::Object *object)
         } else if (propertyValue->isBoolean()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::Bool);
             if (r.type == ListLayout::Role::Bool) {
-                e->setBoolPropertyFast(r, propertyValue->booleanValue());
+                setBoolProperty(elementIndex, r, propertyValue->booleanValue());
             }
         } else if (QV4::DateObject *date = propertyValue->as<QV4::DateObject>()) {
             const ListLayout::Role &r = m_layout->getRoleOrCreate(propertyName, ListLayout::Role::DateTime);
@@ -700,7 +755,7 @@ void ListModel::set(int elementIndex, QV4::Object *object)
         } else if (propertyValue->isNullOrUndefined()) {
             const ListLayout::Role *r = m_layout->getExistingRole(propertyName);
             if (r)
-                e->clearProperty(*r);
+                clearProperty(elementIndex, *r);
         }
     }
 }
@@ -717,6 +772,7 @@ QVector<std::function<void()>> ListModel::remove(int index, int count)
         });
     }
     elements.remove(index, count);
+    removeColumnRows(index, count);
     updateCacheIndices(index);
     return toDestroy;
 }
@@ -743,7 +799,7 @@ int ListModel::setOrCreateProperty(int elementIndex, const QString &key, const Q
 
         const ListLayout::Role *r = m_layout->getRoleOrCreate(key, data);
         if (r) {
-            roleIndex = e->setVariantProperty(*r, data);
+            roleIndex = setVariantProperty(elementIndex, *r, data);
 
             ModelNodeMetaObject *cache = e->objectCache();
 
@@ -760,15 +816,287 @@ int ListModel::setExistingProperty(int elementIndex, const QString &key, const Q
     int roleIndex = -1;
 
     if (elementIndex >= 0 && elementIndex < elements.count()) {
-        ListElement *e = elements[elementIndex];
         const ListLayout::Role *r = m_layout->getExistingRole(key);
         if (r)
-            roleIndex = e->setJsProperty(*r, data, eng);
+            roleIndex = setJsProperty(elementIndex, *r, data, eng);
     }
 
     return roleIndex;
 }
 
+ListColumn &ListModel::column(const ListLayout::Role &role)
+{
+    Q_ASSERT(role.column >= 0);
+    if (role.column >= m_columns.count())
+        m_columns.resize(role.column + 1);
+
+    ListColumn &c = m_columns[role.column];
+    if (c.type == ListLayout::Role::Invalid) {
+        // First write to this role, materialize the default value of every row
+        const int count = elements.count();
+        c.type = role.type;
+        switch (c.type) {
+        case ListLayout::Role::Number:
+            c.numbers.fill(0.0, count);
+            break;
+        case ListLayout::Role::Bool:
+            c.bools.fill(false, count);
+            break;
+        case ListLayout::Role::String:
+            c.strings.fill(-1, count);
+            break;
+        default:
+            Q_UNREACHABLE();
+            break;
+        }
+    }
+    return c;
+}
+
+const ListColumn *ListModel::existingColumn(const ListLayout::Role &role) const
+{
+    if (role.column < 0 || role.column >= m_columns.count())
+        return nullptr;
+    const ListColumn &c = m_columns.at(role.column);
+    return c.type == ListLayout::Role::Invalid ? nullptr : &c;
+}
+
+void ListModel::insertColumnRows(int index, int count)
+{
+    for (ListColumn &c : m_columns) {
+        switch (c.type) {
+        case ListLayout::Role::Number:
+            c.numbers.insert(index, count, 0.0);
+            break;
+        case ListLayout::Role::Bool:
+            c.bools.insert(index, count, false);
+            break;
+        case ListLayout::Role::String:
+            c.strings.insert(index, count, -1);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void ListModel::removeColumnRows(int index, int count)
+{
+    for (ListColumn &c : m_columns) {
+        switch (c.type) {
+        case ListLayout::Role::Number:
+            c.numbers.remove(index, count);
+            break;
+        case ListLayout::Role::Bool:
+            c.bools.remove(index, count);
+            break;
+        case ListLayout::Role::String:
+            for (int i = index; i < index + count; ++i) {
+                if (c.strings.at(i) != -1)
+                    m_strings.deref(c.strings.at(i));
+            }
+            c.strings.remove(index, count);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/*
+    Rebuilds the columns of the target from the ones of \a src. \a rows holds
+    the sync record of each row, in the new order; targetIndex refers to the
+    row in the current columns, or is -1 for a new row.
+*/
+void ListModel::syncColumns(ListModel *src, const QVector<ElementSync *> &rows)
+{
+    QVector<ListColumn> columns(m_layout->columnCount());
+
+    for (int r = 0; r < m_layout->roleCount(); ++r) {
+        const ListLayout::Role &role = m_layout->getExistingRole(r);
+        if (role.column < 0)
+            continue;
+
+        const ListColumn *srcColumn = src->existingColumn(role);
+        const ListColumn *oldColumn = existingColumn(role);
+        if (!srcColumn && !oldColumn)
+            continue;
+
+        ListColumn &c = columns[role.column];
+        c.type = role.type;
+
+        for (int i = 0; i < rows.count(); ++i) {
+            ElementSync *s = rows.at(i);
+            const int oldIndex = s->targetIndex;
+            bool changed = false;
+
+            switch (role.type) {
+            case ListLayout::Role::Number: {
+                const double value = srcColumn ? srcColumn->numbers.at(i) : 0.0;
+                c.numbers.append(value);
+                if (oldIndex != -1)
+                    changed = (oldColumn ? oldColumn->numbers.at(oldIndex) : 0.0) != value;
+                break;
+            }
+            case ListLayout::Role::Bool: {
+                const bool value = srcColumn ? srcColumn->bools.at(i) : false;
+                c.bools.append(value);
+                if (oldIndex != -1)
+                    changed = (oldColumn ? oldColumn->bools.at(oldIndex) : false) != value;
+                break;
+            }
+            case ListLayout::Role::String: {
+                // The old columns still hold their references, so an unchanged string keeps its id
+                const int srcId = srcColumn ? srcColumn->strings.at(i) : -1;
+                const int id = srcId != -1 ? m_strings.intern(src->m_strings, srcId) : -1;
+                c.strings.append(id);
+                if (oldIndex != -1)
+                    changed = (oldColumn ? oldColumn->strings.at(oldIndex) : -1) != id;
+                break;
+            }
+            default:
+                break;
+            }
+
+            if (changed)
+                s->changedRoles.append(role.index);
+        }
+    }
+
+    // Drop the references held by the previous columns
+    for (const ListColumn &c : qAsConst(m_columns)) {
+        for (int id : c.strings) {
+            if (id != -1)
+                m_strings.deref(id);
+        }
+    }
+    m_columns.swap(columns);
+}
+
+QVariant ListModel::getColumnProperty(int elementIndex, const ListLayout::Role &role, const QQmlListModel *owner) const
+{
+    const ListColumn *c = existingColumn(role);
+
+    switch (role.type) {
+    case ListLayout::Role::Number:
+        return c ? c->numbers.at(elementIndex) : 0.0;
+    case ListLayout::Role::Bool:
+        return c ? c->bools.at(elementIndex) : false;
+    case ListLayout::Role::String: {
+        const int id = c ? c->strings.at(elementIndex) : -1;
+        if (id == -1)
+            return QVariant();
+        if (const QV4::CompiledData::Binding *translation = m_strings.translation(id)) {
+            if (!owner)
+                return QString();
+            return translation->valueAsString(owner->m_compilationUnit.data());
+        }
+        return m_strings.string(id);
+    }
+    default:
+        break;
+    }
+
+    return QVariant();
+}
+
+int ListModel::setStringId(int elementIndex, const ListLayout::Role &role, int id)
+{
+    int &value = column(role).strings[elementIndex];
+    const int oldId = value;
+    value = id;
+    if (oldId != -1)
+        m_strings.deref(oldId);
+    return oldId != id ? role.index : -1;
+}
+
+int ListModel::setStringProperty(int elementIndex, const ListLayout::Role &role, const QString &s)
+{
+    if (role.type != ListLayout::Role::String)
+        return -1;
+    return setStringId(elementIndex, role, m_strings.intern(s));
+}
+
+int ListModel::setTranslationProperty(int elementIndex, const ListLayout::Role &role, const QV4::CompiledData::Binding *b)
+{
+    if (role.type != ListLayout::Role::String)
+        return -1;
+    setStringId(elementIndex, role, m_strings.intern(b));
+    return role.index;
+}
+
+int ListModel::setDoubleProperty(int elementIndex, const ListLayout::Role &role, double d)
+{
+    if (role.type != ListLayout::Role::Number)
+        return -1;
+    double &value = column(role).numbers[elementIndex];
+    const bool changed = value != d;
+    value = d;
+    return changed ? role.index : -1;
+}
+
+int ListModel::setBoolProperty(int elementIndex, const ListLayout::Role &role, bool b)
+{
+    if (role.type != ListLayout::Role::Bool)
+        return -1;
+    bool &value = column(role).bools[elementIndex];
+    const bool changed = value != b;
+    value = b;
+    return changed ? role.index : -1;
+}
+
+int ListModel::setVariantProperty(int elementIndex, const ListLayout::Role &role, const QVariant &d)
+{
+    switch (role.type) {
+    case ListLayout::Role::Number:
+        return setDoubleProperty(elementIndex, role, d.toDouble());
+    case ListLayout::Role::String:
+        if (d.userType() == qMetaTypeId<const QV4::CompiledData::Binding *>())
+            return setTranslationProperty(elementIndex, role, d.value<const QV4::CompiledData::Binding*>());
+        return setStringProperty(elementIndex, role, d.toString());
+    case ListLayout::Role::Bool:
+        return setBoolProperty(elementIndex, role, d.toBool());
+    default:
+        break;
+    }
+
+    return elements[elementIndex]->setVariantProperty(role, d);
+}
+
+int ListModel::setJsProperty(int elementIndex, const ListLayout::Role &role, const QV4::Value &d, QV4::ExecutionEngine *eng)
+{
+    if (d.isString())
+        return setStringProperty(elementIndex, role, d.toQString());
+    if (d.isNumber())
+        return setDoubleProperty(elementIndex, role, d.asDouble());
+    if (d.isBoolean())
+        return setBoolProperty(elementIndex, role, d.booleanValue());
+    if (d.isNullOrUndefined()) {
+        clearProperty(elementIndex, role);
+        return -1;
+    }
+
+    return elements[elementIndex]->setJsProperty(role, d, eng);
+}
+
+void ListModel::clearProperty(int elementIndex, const ListLayout::Role &role)
+{
+    switch (role.type) {
+    case ListLayout::Role::String:
+        setStringProperty(elementIndex, role, QString());
+        break;
+    case ListLayout::Role::Number:
+        setDoubleProperty(elementIndex, role, 0.0);
+        break;
+    case ListLayout::Role::Bool:
+        setBoolProperty(elementIndex, role, false);
+        break;
+    default:
+        elements[elementIndex]->clearProperty(role);
+        break;
+    }
+}
+
 inline char *ListElement::getPropertyMemory(const ListLayout::Role &role)
 {
     ListElement *e = this;
@@ -793,13 +1121,6 @@ ModelNodeMetaObject *ListElement::objectCache()
     return ModelNodeMetaObject::get(m_objectCache);
 }
 
-StringOrTranslation *ListElement::getStringProperty(const ListLayout::Role &role)
-{
-    char *mem = getPropertyMemory(role);
-    StringOrTranslation *s = reinterpret_cast<StringOrTranslation *>(mem);
-    return s;
-}
-
 QObject *ListElement::getQObjectProperty(const ListLayout::Role &role)
 {
     char *mem = getPropertyMemory(role);
@@ -874,25 +1195,6 @@ QVariant ListElement::getProperty(const ListLayout::Role &role, const QQmlListMo
     QVariant data;
 
     switch (role.type) {
-        case ListLayout::Role::Number:
-            {
-                double *value = reinterpret_cast<double *>(mem);
-                data = *value;
-            }
-            break;
-        case ListLayout::Role::String:
-            {
-                StringOrTranslation *value = reinterpret_cast<StringOrTranslation *>(mem);
-                if (value->isSet())
-                    data = value->toString(owner);
-            }
-            break;
-        case ListLayout::Role::Bool:
-            {
-                bool *value = reinterpret_cast<bool *>(mem);
-                data = *value;
-            }
-            break;
         case ListLayout::Role::List:
             {
                 ListModel **value = reinterpret_cast<ListModel **>(mem);
@@ -948,58 +1250,6 @@ QVariant ListElement::getProperty(const ListLayout::Role &role, const QQmlListMo
     return data;
 }
 
-int ListElement::setStringProperty(const ListLayout::Role &role, const QString &s)
-{
-    int roleIndex = -1;
-
-    if (role.type == ListLayout::Role::String) {
-        char *mem = getPropertyMemory(role);
-        StringOrTranslation *c = reinterpret_cast<StringOrTranslation *>(mem);
-        bool changed;
-        if (!c->isSet() || c->isTranslation())
-            changed = true;
-        else
-            changed = c->asString().compare(s) != 0;
-        c->setString(s);
-        if (changed)
-            roleIndex = role.index;
-    }
-
-    return roleIndex;
-}
-
-int ListElement::setDoubleProperty(const ListLayout::Role &role, double d)
-{
-    int roleIndex = -1;
-
-    if (role.type == ListLayout::Role::Number) {
-        char *mem = getPropertyMemory(role);
-        double *value = reinterpret_cast<double *>(mem);
-        bool changed = *value != d;
-        *value = d;
-        if (changed)
-            roleIndex = role.index;
-    }
-
-    return roleIndex;
-}
-
-int ListElement::setBoolProperty(const ListLayout::Role &role, bool b)
-{
-    int roleIndex = -1;
-
-    if (role.type == ListLayout::Role::Bool) {
-        char *mem = getPropertyMemory(role);
-        bool *value = reinterpret_cast<bool *>(mem);
-        bool changed = *value != b;
-        *value = b;
-        if (changed)
-            roleIndex = role.index;
-    }
-
-    return roleIndex;
-}
-
 int ListElement::setListProperty(const ListLayout::Role &role, ListModel *m)
 {
     int roleIndex = -1;
@@ -1122,41 +1372,6 @@ int ListElement::setFunctionProperty(const ListLayout::Role &role, const QJSValu
     return roleIndex;
 }
 
-int ListElement::setTranslationProperty(const ListLayout::Role &role, const QV4::CompiledData::Binding *b)
-{
-    int roleIndex = -1;
-
-    if (role.type == ListLayout::Role::String) {
-        char *mem = getPropertyMemory(role);
-        StringOrTranslation *s = reinterpret_cast<StringOrTranslation *>(mem);
-        s->setTranslation(b);
-        roleIndex = role.index;
-    }
-
-    return roleIndex;
-}
-
-
-void ListElement::setStringPropertyFast(const ListLayout::Role &role, const QString &s)
-{
-    char *mem = getPropertyMemory(role);
-    new (mem) StringOrTranslation(s);
-}
-
-void ListElement::setDoublePropertyFast(const ListLayout::Role &role, double d)
-{
-    char *mem = getPropertyMemory(role);
-    double *value = new (mem) double;
-    *value = d;
-}
-
-void ListElement::setBoolPropertyFast(const ListLayout::Role &role, bool b)
-{
-    char *mem = getPropertyMemory(role);
-    bool *value = new (mem) bool;
-    *value = b;
-}
-
 void ListElement::setQObjectPropertyFast(const ListLayout::Role &role, QObject *o)
 {
     char *mem = getPropertyMemory(role);
@@ -1192,15 +1407,6 @@ void ListElement::setFunctionPropertyFast(const ListLayout::Role &role, const QJ
 void ListElement::clearProperty(const ListLayout::Role &role)
 {
     switch (role.type) {
-    case ListLayout::Role::String:
-        setStringProperty(role, QString());
-        break;
-    case ListLayout::Role::Number:
-        setDoubleProperty(role, 0.0);
-        break;
-    case ListLayout::Role::Bool:
-        setBoolProperty(role, false);
-        break;
     case ListLayout::Role::List:
         setListProperty(role, nullptr);
         break;
@@ -1272,9 +1478,6 @@ QVector<int> ListElement::sync(ListElement *src, ListLayout *srcLayout, ListElem
                     roleIndex = target->setQObjectProperty(targetRole, object);
                 }
                 break;
-            case ListLayout::Role::String:
-            case ListLayout::Role::Number:
-            case ListLayout::Role::Bool:
             case ListLayout::Role::DateTime:
             case ListLayout::Role::Function:
                 {
@@ -1305,13 +1508,6 @@ void ListElement::destroy(ListLayout *layout)
             const ListLayout::Role &r = layout->getExistingRole(i);
 
             switch (r.type) {
-                case ListLayout::Role::String:
-                    {
-                        StringOrTranslation *string = getStringProperty(r);
-                        if (string)
-                            string->~StringOrTranslation();
-                    }
-                    break;
                 case ListLayout::Role::List:
                     {
                         ListModel *model = getListProperty(r);
@@ -1371,18 +1567,6 @@ int ListElement::setVariantProperty(const ListLayout::Role &role, const QVariant
     int roleIndex = -1;
 
     switch (role.type) {
-        case ListLayout::Role::Number:
-            roleIndex = setDoubleProperty(role, d.toDouble());
-            break;
-        case ListLayout::Role::String:
-            if (d.userType() == qMetaTypeId<const QV4::CompiledData::Binding *>())
-                roleIndex = setTranslationProperty(role, d.value<const QV4::CompiledData::Binding*>());
-            else
-                roleIndex = setStringProperty(role, d.toString());
-            break;
-        case ListLayout::Role::Bool:
-            roleIndex = setBoolProperty(role, d.toBool());
-            break;
         case ListLayout::Role::List:
             roleIndex = setListProperty(role, d.value<ListModel *>());
             break;
@@ -1411,13 +1595,8 @@ int ListElement::setJsProperty(const ListLayout::Role &role, const QV4::Value &d
 
     QV4::Scope scope(eng);
 
-    // Add the value now
-    if (d.isString()) {
-        QString qstr = d.toQString();
-        roleIndex = setStringProperty(role, qstr);
-    } else if (d.isNumber()) {
-        roleIndex = setDoubleProperty(role, d.asDouble());
-    } else if (d.as<QV4::ArrayObject>()) {
+    // Add the value now. Scalars and null are handled by ListModel::setJsProperty
+    if (d.as<QV4::ArrayObject>()) {
         QV4::ScopedArrayObject a(scope, d);
         if (role.type == ListLayout::Role::List) {
             QV4::Scope scope(a->engine());
@@ -1433,8 +1612,6 @@ int ListElement::setJsProperty(const ListLayout::Role &role, const QV4::Value &d
         } else {
             qmlWarning(nullptr) << QStringLiteral("Can't assign to existing role '%1' of different type [%2 -> %3]").arg(role.name).arg(roleTypeName(role.type)).arg(roleTypeName(ListLayout::Role::List));
         }
-    } else if (d.isBoolean()) {
-        roleIndex = setBoolProperty(role, d.booleanValue());
     } else if (d.as<QV4::DateObject>()) {
         QV4::Scoped<QV4::DateObject> dd(scope, d);
         QDateTime dt = dd->toQDateTime();
@@ -1453,8 +1630,6 @@ int ListElement::setJsProperty(const ListLayout::Role &role, const QV4::Value &d
         } else if (role.type == ListLayout::Role::VariantMap) {
             roleIndex = setVariantMapProperty(role, o);
         }
-    } else if (d.isNullOrUndefined()) {
-        clearProperty(role);
     }
 
     return roleIndex;
@@ -1917,6 +2092,11 @@ QQmlListModel::QQmlListModel(QObject *parent)
     m_listModel = new ListModel(m_layout, this);
 
     m_engine = nullptr;
+
+    m_batchDepth = 0;
+    m_batchEmitCount = -1;
+    m_batchAllRoles = false;
+    m_batchGuardPending = false;
 }
 
 QQmlListModel::QQmlListModel(const QQmlListModel *owner, ListModel *data, QV4::ExecutionEngine *engine, QObject *parent)
@@ -1933,6 +2113,11 @@ QQmlListModel::QQmlListModel(const QQmlListModel *owner, ListModel *data, QV4::E
 
     m_engine = engine;
     m_compilationUnit = owner->m_compilationUnit;
+
+    m_batchDepth = 0;
+    m_batchEmitCount = -1;
+    m_batchAllRoles = false;
+    m_batchGuardPending = false;
 }
 
 QQmlListModel::QQmlListModel(QQmlListModel *orig, QQmlListModelWorkerAgent *agent)
@@ -1953,6 +2138,11 @@ QQmlListModel::QQmlListModel(QQmlListModel *orig, QQmlListModelWorkerAgent *agen
 
     m_engine = nullptr;
     m_compilationUnit = orig->m_compilationUnit;
+
+    m_batchDepth = 0;
+    m_batchEmitCount = -1;
+    m_batchAllRoles = false;
+    m_batchGuardPending = false;
 }
 
 QQmlListModel::~QQmlListModel()
@@ -2107,6 +2297,19 @@ void QQmlListModel::emitItemsChanged(int index, int count, const QVector<int> &r
     if (count <= 0)
         return;
 
+    if (isBatching()) {
+        m_batchChanges.change(index, count);
+        if (roles.isEmpty()) {
+            m_batchAllRoles = true;
+        } else if (!m_batchAllRoles) {
+            for (int role : roles) {
+                if (!m_batchRoles.contains(role))
+                    m_batchRoles.append(role);
+            }
+        }
+        return;
+    }
+
     if (m_mainThread)
         emit dataChanged(createIndex(index, 0), createIndex(index + count - 1, 0), roles);;
 }
@@ -2114,18 +2317,81 @@ void QQmlListModel::emitItemsChanged(int index, int count, const QVector<int> &r
 void QQmlListModel::emitItemsAboutToBeInserted(int index, int count)
 {
     Q_ASSERT(index >= 0 && count >= 0);
-    if (m_mainThread)
+    if (isBatching())
+        m_batchChanges.insert(index, count);
+    else if (m_mainThread)
         beginInsertRows(QModelIndex(), index, index + count - 1);
 }
 
 void QQmlListModel::emitItemsInserted()
 {
-    if (m_mainThread) {
+    if (m_mainThread && !isBatching()) {
         endInsertRows();
         emit countChanged();
     }
 }
 
+/*
+    Emits the changes recorded since the batch began. The change set is
+    compacted, so the removals and insertions are replayed one range at a
+    time, with rowCount() reporting the number of rows of each intermediate
+    state. The changed ranges are emitted last, against the final list.
+*/
+void QQmlListModel::emitBatchedChanges()
+{
+    if (m_batchChanges.isEmpty())
+        return;
+
+    const QQmlChangeSet changes = m_batchChanges;
+    const QVector<int> roles = m_batchAllRoles ? QVector<int>() : m_batchRoles;
+    m_batchChanges.clear();
+    m_batchRoles.clear();
+    m_batchAllRoles = false;
+
+    const int finalCount = count();
+    const int initialCount = finalCount - changes.difference();
+
+    int rows = initialCount;
+    for (const QQmlChangeSet::Change &remove : changes.removes()) {
+        m_batchEmitCount = rows;
+        beginRemoveRows(QModelIndex(), remove.start(), remove.end() - 1);
+        rows -= remove.count;
+        m_batchEmitCount = rows;
+        endRemoveRows();
+    }
+    for (const QQmlChangeSet::Change &insert : changes.inserts()) {
+        m_batchEmitCount = rows;
+        beginInsertRows(QModelIndex(), insert.start(), insert.end() - 1);
+        rows += insert.count;
+        m_batchEmitCount = rows;
+        endInsertRows();
+    }
+    Q_ASSERT(rows == finalCount);
+    m_batchEmitCount = -1;
+
+    for (const QQmlChangeSet::Change &change : changes.changes())
+        emit dataChanged(createIndex(change.start(), 0), createIndex(change.end() - 1, 0), roles);
+
+    if (initialCount != finalCount)
+        emit countChanged();
+}
+
+/*
+    Commits a batch that was not committed before returning to the event
+    loop, for example because a script threw between beginBatch() and
+    commitBatch().
+*/
+void QQmlListModel::recoverBatch()
+{
+    m_batchGuardPending = false;
+    if (m_batchDepth == 0)
+        return;
+
+    qmlWarning(this) << tr("beginBatch: batch not committed, committing it now");
+    m_batchDepth = 0;
+    emitBatchedChanges();
+}
+
 QQmlListModelWorkerAgent *QQmlListModel::agent()
 {
     if (m_agent)
@@ -2144,7 +2410,9 @@ QModelIndex QQmlListModel::index(int row, int column, const QModelIndex &parent)
 
 int QQmlListModel::rowCount(const QModelIndex &parent) const
 {
-    return !parent.isValid() ? count() : 0;
+    if (parent.isValid())
+        return 0;
+    return m_batchEmitCount >= 0 ? m_batchEmitCount : count();
 }
 
 QVariant QQmlListModel::data(const QModelIndex &index, int role) const
@@ -2309,7 +2577,10 @@ void QQmlListModel::removeElements(int index, int removeCount)
     if (!removeCount)
         return;
 
-    if (m_mainThread)
+    const bool batching = isBatching();
+    if (batching)
+        m_batchChanges.remove(index, removeCount);
+    else if (m_mainThread)
         beginRemoveRows(QModelIndex(), index, index + removeCount - 1);
 
     QVector<std::function<void()>> toDestroy;
@@ -2325,7 +2596,7 @@ void QQmlListModel::removeElements(int index, int removeCount)
         toDestroy = m_listModel->remove(index, removeCount);
     }
 
-    if (m_mainThread) {
+    if (m_mainThread && !batching) {
         endRemoveRows();
         emit countChanged();
     }
@@ -2419,6 +2690,10 @@ void QQmlListModel::move(int from, int to, int n)
         return;
     }
 
+    // Moves keep their delegates, so they are not folded into a batch
+    if (isBatching())
+        emitBatchedChanges();
+
     if (m_mainThread)
         beginMoveRows(QModelIndex(), from, from + n - 1, QModelIndex(), to > from ? to + n : to);
 
@@ -2480,6 +2755,9 @@ void QQmlListModel::append(QQmlV4Function *args)
                 int index = count();
                 emitItemsAboutToBeInserted(index, objectArrayLength);
 
+                if (!m_dynamicRoles)
+                    m_listModel->reserve(index + objectArrayLength);
+
                 for (int i=0 ; i < objectArrayLength ; ++i) {
                     argObject = objectArray->get(i);
 
@@ -2676,6 +2954,74 @@ void QQmlListModel::sync()
     qmlWarning(this) << "List sync() can only be called from a WorkerScript";
 }
 
+/*!
+    \qmlmethod ListModel::beginBatch()
+    \since 5.13
+
+    Starts collecting the changes made to the list model instead of
+    notifying the views of each of them as it happens. The changes are
+    reported when the matching commitBatch() is called. This keeps views
+    from relayouting for every single update when a large number of
+    appends, inserts, removals or value changes are applied in one go:
+
+    \code
+        onMessageReceived: {
+            fruitModel.beginBatch()
+            for (var i = 0; i < message.updates.length; ++i)
+                fruitModel.set(message.updates[i].index, message.updates[i].fruit)
+            fruitModel.remove(0, message.expired)
+            fruitModel.commitBatch()
+        }
+    \endcode
+
+    The changes of a batch are merged before they are reported: items that
+    were inserted and removed again within the batch are not reported at
+    all, and adjacent insertions, removals and value changes are reported
+    as one range each. Views keep the delegates of the items that were
+    neither inserted nor removed.
+
+    Batches can be nested; the changes are reported when the outermost
+    batch is committed. A call to move() reports the changes collected so
+    far before moving the items, so that the views keep the delegates of the
+    moved items. The \l count property is only updated for the views when the
+    batch is committed, but reading it from a script always returns the
+    current number of items.
+
+    A batch must be committed before returning to the event loop. If it is
+    not, for instance because an exception was thrown before commitBatch()
+    was reached, a warning is printed and the batch is committed then.
+
+    \sa commitBatch()
+*/
+void QQmlListModel::beginBatch()
+{
+    ++m_batchDepth;
+    if (m_mainThread && !m_batchGuardPending) {
+        m_batchGuardPending = true;
+        QMetaObject::invokeMethod(this, &QQmlListModel::recoverBatch, Qt::QueuedConnection);
+    }
+}
+
+/*!
+    \qmlmethod ListModel::commitBatch()
+    \since 5.13
+
+    Ends a batch started with beginBatch(). When the outermost batch ends,
+    the changes made since it began are reported to the views.
+
+    \sa beginBatch()
+*/
+void QQmlListModel::commitBatch()
+{
+    if (m_batchDepth == 0) {
+        qmlWarning(this) << tr("commitBatch: no batch in progress");
+        return;
+    }
+
+    if (--m_batchDepth == 0 && m_mainThread)
+        emitBatchedChanges();
+}
+
 bool QQmlListModelParser::verifyProperty(const QQmlRefPointer<QV4::CompiledData::CompilationUnit> &compilationUnit, const QV4::CompiledData::Binding *binding)
 {
     if (binding->type >= QV4::CompiledData::Binding::Type_Object) {
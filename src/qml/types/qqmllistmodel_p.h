@@ -63,6 +63,7 @@
 
 #include <private/qv4engine_p.h>
 #include <private/qpodvector_p.h>
+#include <private/qqmlchangeset_p.h>
 
 QT_REQUIRE_CONFIG(qml_list_model);
 
@@ -106,6 +107,9 @@ public:
     Q_INVOKABLE void move(int from, int to, int count);
     Q_INVOKABLE void sync();
 
+    Q_REVISION(13) Q_INVOKABLE void beginBatch();
+    Q_REVISION(13) Q_INVOKABLE void commitBatch();
+
     QQmlListModelWorkerAgent *agent();
 
     bool dynamicRoles() const { return m_dynamicRoles; }
@@ -124,7 +128,6 @@ private:
     friend class ListElement;
     friend class DynamicRoleModelNode;
     friend class DynamicRoleModelNodeMetaObject;
-    friend struct StringOrTranslation;
 
     // Constructs a flat list model for a worker agent
     QQmlListModel(QQmlListModel *orig, QQmlListModelWorkerAgent *agent);
@@ -163,8 +166,19 @@ private:
     void emitItemsChanged(int index, int count, const QVector<int> &roles);
     void emitItemsAboutToBeInserted(int index, int count);
     void emitItemsInserted();
+    void emitBatchedChanges();
+    void recoverBatch();
 
     void removeElements(int index, int removeCount);
+
+    bool isBatching() const { return m_batchDepth > 0 && m_mainThread; }
+
+    int m_batchDepth;
+    int m_batchEmitCount;
+    bool m_batchAllRoles;
+    bool m_batchGuardPending;
+    QQmlChangeSet m_batchChanges;
+    QVector<int> m_batchRoles;
 };
 
 // ### FIXME
@@ -191,7 +191,7 @@ protected:
 class ListLayout
 {
 public:
-    ListLayout() : currentBlock(0), currentBlockOffset(0) {}
+    ListLayout() : currentBlock(0), currentBlockOffset(0), currentColumn(0) {}
     ListLayout(const ListLayout *other);
     ~ListLayout();
 
@@ -199,7 +199,7 @@ public:
     {
     public:
 
-        Role() : type(Invalid), blockIndex(-1), blockOffset(-1), index(-1), subLayout(0) {}
+        Role() : type(Invalid), blockIndex(-1), blockOffset(-1), column(-1), index(-1), subLayout(0) {}
         explicit Role(const Role *other);
         ~Role();
 
@@ -224,6 +224,7 @@ public:
         DataType type;
         int blockIndex;
         int blockOffset;
+        int column;
         int index;
         ListLayout *subLayout;
     };
@@ -237,32 +238,74 @@ public:
     const Role *getExistingRole(QV4::String *key) const;
 
     int roleCount() const { return roles.count(); }
+    int columnCount() const { return currentColumn; }
+
+    static bool isColumnType(Role::DataType type)
+    {
+        return type == Role::String || type == Role::Number || type == Role::Bool;
+    }
 
     static void sync(ListLayout *src, ListLayout *target);
 
 private:
     const Role &createRole(const QString &key, Role::DataType type);
+    const Role &appendRole(Role *r);
 
     int currentBlock;
     int currentBlockOffset;
+    int currentColumn;
     QVector<Role *> roles;
     QStringHash<Role *> roleHash;
 };
 
-struct StringOrTranslation
+/*!
+\internal
+
+Interns the values of the string roles of a ListModel, so that all the rows
+holding the same string share a single copy of it. Translation bindings are
+interned alongside the plain strings.
+*/
+class ListStringPool
 {
-    explicit StringOrTranslation(const QString &s);
-    explicit StringOrTranslation(const QV4::CompiledData::Binding *binding);
-    ~StringOrTranslation();
-    bool isSet() const { return d.flag(); }
-    bool isTranslation() const { return d.isT2(); }
-    void setString(const QString &s);
-    void setTranslation(const QV4::CompiledData::Binding *binding);
-    QString toString(const QQmlListModel *owner) const;
-    QString asString() const;
+public:
+    int intern(const QString &s);
+    int intern(const QV4::CompiledData::Binding *translation);
+    int intern(const ListStringPool &other, int id);
+    void deref(int id);
+
+    QString string(int id) const { return m_entries.at(id).string; }
+    const QV4::CompiledData::Binding *translation(int id) const { return m_entries.at(id).translation; }
+
 private:
-    void clear();
-    QBiPointer<QStringData, const QV4::CompiledData::Binding> d;
+    int allocate();
+
+    struct Entry
+    {
+        QString string;
+        const QV4::CompiledData::Binding *translation = nullptr;
+        int refCount = 0;
+    };
+
+    QVector<Entry> m_entries;
+    QVector<int> m_freeIds;
+    QHash<QString, int> m_stringIds;
+    QHash<const QV4::CompiledData::Binding *, int> m_translationIds;
+};
+
+/*!
+\internal
+
+The values of one String, Number or Bool role, stored contiguously for all
+the rows of a ListModel. Strings are stored as ids into the ListStringPool of
+the model, or -1 when unset. A column with an Invalid type has not been
+written to yet and holds the default value for every row.
+*/
+struct ListColumn
+{
+    ListLayout::Role::DataType type = ListLayout::Role::Invalid;
+    QVector<double> numbers;
+    QVector<bool> bools;
+    QVector<int> strings;
 };
 
 /*!
@@ -291,20 +334,13 @@ private:
 
     int setJsProperty(const ListLayout::Role &role, const QV4::Value &d, QV4::ExecutionEngine *eng);
 
-    int setStringProperty(const ListLayout::Role &role, const QString &s);
-    int setDoubleProperty(const ListLayout::Role &role, double n);
-    int setBoolProperty(const ListLayout::Role &role, bool b);
     int setListProperty(const ListLayout::Role &role, ListModel *m);
     int setQObjectProperty(const ListLayout::Role &role, QObject *o);
     int setVariantMapProperty(const ListLayout::Role &role, QV4::Object *o);
     int setVariantMapProperty(const ListLayout::Role &role, QVariantMap *m);
     int setDateTimeProperty(const ListLayout::Role &role, const QDateTime &dt);
     int setFunctionProperty(const ListLayout::Role &role, const QJSValue &f);
-    int setTranslationProperty(const ListLayout::Role &role, const QV4::CompiledData::Binding *b);
 
-    void setStringPropertyFast(const ListLayout::Role &role, const QString &s);
-    void setDoublePropertyFast(const ListLayout::Role &role, double n);
-    void setBoolPropertyFast(const ListLayout::Role &role, bool b);
     void setQObjectPropertyFast(const ListLayout::Role &role, QObject *o);
     void setListPropertyFast(const ListLayout::Role &role, ListModel *m);
     void setVariantMapFast(const ListLayout::Role &role, QV4::Object *o);
@@ -315,7 +351,6 @@ private:
 
     QVariant getProperty(const ListLayout::Role &role, const QQmlListModel *owner, QV4::ExecutionEngine *eng);
     ListModel *getListProperty(const ListLayout::Role &role);
-    StringOrTranslation *getStringProperty(const ListLayout::Role &role);
     QObject *getQObjectProperty(const ListLayout::Role &role);
     QPointer<QObject> *getGuardProperty(const ListLayout::Role &role);
     QVariantMap *getVariantMapProperty(const ListLayout::Role &role);
@@ -380,6 +415,8 @@ public:
         return elements.count();
     }
 
+    void reserve(int count);
+
     void set(int elementIndex, QV4::Object *object, QVector<int> *roles);
     void set(int elementIndex, QV4::Object *object);
 
@@ -416,6 +453,26 @@ private:
 
     void updateCacheIndices(int start = 0, int end = -1);
 
+    ListColumn &column(const ListLayout::Role &role);
+    const ListColumn *existingColumn(const ListLayout::Role &role) const;
+    void insertColumnRows(int index, int count);
+    void removeColumnRows(int index, int count);
+    void syncColumns(ListModel *src, const QVector<ElementSync *> &rows);
+
+    QVariant getColumnProperty(int elementIndex, const ListLayout::Role &role, const QQmlListModel *owner) const;
+    int setStringProperty(int elementIndex, const ListLayout::Role &role, const QString &s);
+    int setTranslationProperty(int elementIndex, const ListLayout::Role &role, const QV4::CompiledData::Binding *b);
+    int setDoubleProperty(int elementIndex, const ListLayout::Role &role, double d);
+    int setBoolProperty(int elementIndex, const ListLayout::Role &role, bool b);
+    int setStringId(int elementIndex, const ListLayout::Role &role, int id);
+
+    int setVariantProperty(int elementIndex, const ListLayout::Role &role, const QVariant &d);
+    int setJsProperty(int elementIndex, const ListLayout::Role &role, const QV4::Value &d, QV4::ExecutionEngine *eng);
+    void clearProperty(int elementIndex, const ListLayout::Role &role);
+
+    QVector<ListColumn> m_columns;
+    ListStringPool m_strings;
+
     friend class ListElement;
     friend class QQmlListModelWorkerAgent;
     friend class QQmlListModelParser;
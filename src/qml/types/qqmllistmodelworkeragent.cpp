@@ -46,6 +46,7 @@
 #include <QtCore/qcoreevent.h>
 #include <QtCore/qcoreapplication.h>
 #include <QtCore/qdebug.h>
+#include <QtCore/qthread.h>
 
 
 QT_BEGIN_NAMESPACE
@@ -66,9 +67,18 @@ QQmlListModelWorkerAgent::~QQmlListModelWorkerAgent()
     mutex.unlock();
 }
 
-void QQmlListModelWorkerAgent::setEngine(QV4::ExecutionEngine *eng)
+/*
+    The copy of the model is not locked, so all scripts that use it have to
+    run on the worker thread that received it first. Returns false if \a eng
+    belongs to another thread.
+*/
+bool QQmlListModelWorkerAgent::setEngine(QV4::ExecutionEngine *eng)
 {
+    QThread *thread = QThread::currentThread();
+    if (!m_thread.testAndSetOrdered(nullptr, thread) && m_thread.load() != thread)
+        return false;
     m_copy->m_engine = eng;
+    return true;
 }
 
 void QQmlListModelWorkerAgent::addref()
@@ -152,6 +162,9 @@ bool QQmlListModelWorkerAgent::event(QEvent *e)
         if (m_orig) {
             Sync *s = static_cast<Sync *>(e);
 
+            // Report the changes batched so far, the sync notifies the views directly
+            m_orig->emitBatchedChanges();
+
             cc = (m_orig->count() != s->list->count());
 
             Q_ASSERT(m_orig->m_dynamicRoles == s->list->m_dynamicRoles);
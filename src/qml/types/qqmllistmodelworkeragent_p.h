@@ -74,7 +74,7 @@ class QQmlListModelWorkerAgent : public QObject
 public:
     QQmlListModelWorkerAgent(QQmlListModel *);
     ~QQmlListModelWorkerAgent();
-    void setEngine(QV4::ExecutionEngine *eng);
+    bool setEngine(QV4::ExecutionEngine *eng);
 
     void addref();
     void release();
@@ -126,6 +126,7 @@ private:
     };
 
     QAtomicInt m_ref;
+    QAtomicPointer<QThread> m_thread;
     QQmlListModel *m_orig;
     QQmlListModel *m_copy;
     QMutex mutex;
@@ -47,6 +47,7 @@
 #include <private/qqmldelegatecomponent_p.h>
 #endif
 #include <private/qqmlobjectmodel_p.h>
+#include <private/qqmlsortfiltermodel_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -57,6 +58,7 @@ void QQmlModelsModule::defineModule()
 #if QT_CONFIG(qml_list_model)
     qmlRegisterType<QQmlListElement>(uri, 2, 1, "ListElement");
     qmlRegisterCustomType<QQmlListModel>(uri, 2, 1, "ListModel", new QQmlListModelParser);
+    qmlRegisterCustomType<QQmlListModel, 13>(uri, 2, 13, "ListModel", new QQmlListModelParser);
 #endif
 #if QT_CONFIG(qml_delegate_model)
     qmlRegisterType<QQmlDelegateModel>(uri, 2, 1, "DelegateModel");
@@ -64,6 +66,7 @@ void QQmlModelsModule::defineModule()
 #endif
     qmlRegisterType<QQmlObjectModel>(uri, 2, 1, "ObjectModel");
     qmlRegisterType<QQmlObjectModel,3>(uri, 2, 3, "ObjectModel");
+    qmlRegisterType<QQmlSortFilterModel>(uri, 2, 13, "SortFilterModel");
 
     qmlRegisterType<QItemSelectionModel>(uri, 2, 2, "ItemSelectionModel");
 }
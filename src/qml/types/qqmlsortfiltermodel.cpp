@@ -0,0 +1,928 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qqmlsortfiltermodel_p.h"
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qpair.h>
+
+#include <algorithm>
+#include <numeric>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Data changes and insertions touching more rows than this re-sort the
+    whole model rather than repositioning the rows one at a time.
+*/
+static const int maximumRepositionCount = 32;
+
+/*
+    Returns where \a row ends up when the source rows \a start to \a end are
+    moved to before \a destination.
+*/
+static int movedRow(int row, int start, int end, int destination)
+{
+    const int count = end - start + 1;
+    if (row >= start && row <= end)
+        return destination > end ? row + destination - end - 1 : row - start + destination;
+    if (destination > end && row > end && row < destination)
+        return row - count;
+    if (destination < start && row >= destination && row < start)
+        return row + count;
+    return row;
+}
+
+template <typename T>
+static void moveRows(QVector<T> &values, int start, int end, int destination)
+{
+    if (values.isEmpty())
+        return;
+    if (destination > end)
+        std::rotate(values.begin() + start, values.begin() + end + 1, values.begin() + destination);
+    else
+        std::rotate(values.begin() + destination, values.begin() + start, values.begin() + end + 1);
+}
+
+/*!
+    \qmltype SortFilterModel
+    \instantiates QQmlSortFilterModel
+    \inqmlmodule QtQml.Models
+    \ingroup qtquick-models
+    \since 5.13
+    \brief Sorts and filters the rows of another model.
+
+    A SortFilterModel presents the rows of its \l sourceModel ordered by the
+    value of \l sortRole and restricted to the rows whose \l filterRole value
+    matches \l filterString.  Sort keys and filter values are read once and
+    cached, and the comparisons are evaluated without calling into
+    JavaScript, so the model stays responsive for large sources.
+
+    Changes to the source model are applied incrementally: a changed sort
+    value moves the affected row to its new position, and a changed filter
+    string inserts or removes just the rows whose acceptance changed.  Views
+    and \l DelegateModel therefore keep the delegates of unaffected rows.
+
+    \code
+    import QtQuick 2.13
+    import QtQml.Models 2.13
+
+    ListView {
+        model: SortFilterModel {
+            sourceModel: ContactModel {}
+            sortRole: "name"
+            filterRole: "name"
+            filterString: searchField.text
+        }
+        delegate: Text { text: name }
+    }
+    \endcode
+
+    Only list models are supported; the children of tree models are ignored.
+*/
+
+QQmlSortFilterModel::QQmlSortFilterModel(QObject *parent)
+    : QAbstractListModel(parent)
+    , m_sortOrder(Qt::AscendingOrder)
+    , m_filterSyntax(Contains)
+    , m_caseSensitivity(Qt::CaseInsensitive)
+    , m_sortRoleId(-1)
+    , m_filterRoleId(-1)
+    , m_complete(true)
+{
+}
+
+QQmlSortFilterModel::~QQmlSortFilterModel()
+{
+}
+
+/*!
+    \qmlproperty model QtQml.Models::SortFilterModel::sourceModel
+
+    The model whose rows are sorted and filtered.
+*/
+QAbstractItemModel *QQmlSortFilterModel::sourceModel() const
+{
+    return m_source;
+}
+
+void QQmlSortFilterModel::setSourceModel(QAbstractItemModel *model)
+{
+    if (m_source == model)
+        return;
+
+    if (m_source)
+        disconnect(m_source, nullptr, this, nullptr);
+
+    m_source = model;
+    m_sortRoleId = -1;
+    m_filterRoleId = -1;
+
+    if (m_source) {
+        connect(m_source, &QAbstractItemModel::dataChanged,
+                this, &QQmlSortFilterModel::sourceDataChanged);
+        connect(m_source, &QAbstractItemModel::rowsInserted,
+                this, &QQmlSortFilterModel::sourceRowsInserted);
+        connect(m_source, &QAbstractItemModel::rowsAboutToBeRemoved,
+                this, &QQmlSortFilterModel::sourceRowsAboutToBeRemoved);
+        connect(m_source, &QAbstractItemModel::rowsRemoved,
+                this, &QQmlSortFilterModel::sourceRowsRemoved);
+        connect(m_source, &QAbstractItemModel::rowsMoved,
+                this, &QQmlSortFilterModel::sourceRowsMoved);
+        connect(m_source, &QAbstractItemModel::modelAboutToBeReset,
+                this, &QQmlSortFilterModel::sourceAboutToBeReset);
+        connect(m_source, &QAbstractItemModel::modelReset,
+                this, &QQmlSortFilterModel::sourceReset);
+        connect(m_source, &QAbstractItemModel::layoutAboutToBeChanged,
+                this, &QQmlSortFilterModel::sourceAboutToBeReset);
+        connect(m_source, &QAbstractItemModel::layoutChanged,
+                this, &QQmlSortFilterModel::sourceReset);
+        connect(m_source, &QObject::destroyed,
+                this, &QQmlSortFilterModel::sourceDestroyed);
+    }
+
+    reset();
+    emit sourceModelChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::SortFilterModel::sortRole
+
+    The name of the role the rows are sorted by.  Numbers and dates are
+    compared by value and sort before all other values, which are compared
+    as strings.  Rows with equal values keep their order in the source model.
+
+    If no sort role is set the rows keep their source order.
+*/
+void QQmlSortFilterModel::setSortRole(const QString &role)
+{
+    if (m_sortRole == role)
+        return;
+
+    m_sortRole = role;
+    if (m_complete && m_source) {
+        const int filterRoleId = m_filterRoleId;
+        resolveRoles();
+        loadSortKeys();
+        relayout();
+        if (m_filterRoleId != filterRoleId) {
+            loadFilterValues();
+            refilter(false);
+        }
+    }
+    emit sortRoleChanged();
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::SortFilterModel::sortOrder
+
+    The order the rows are sorted in, either \c Qt.AscendingOrder (the
+    default) or \c Qt.DescendingOrder.
+*/
+void QQmlSortFilterModel::setSortOrder(Qt::SortOrder order)
+{
+    if (m_sortOrder == order)
+        return;
+
+    m_sortOrder = order;
+    if (m_complete && m_source && isSorting())
+        relayout();
+    emit sortOrderChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::SortFilterModel::filterRole
+
+    The name of the role whose value is matched against \l filterString.
+*/
+void QQmlSortFilterModel::setFilterRole(const QString &role)
+{
+    if (m_filterRole == role)
+        return;
+
+    m_filterRole = role;
+    if (m_complete && m_source) {
+        const int sortRoleId = m_sortRoleId;
+        resolveRoles();
+        loadFilterValues();
+        if (m_sortRoleId != sortRoleId) {
+            loadSortKeys();
+            relayout();
+        }
+        refilter(false);
+    }
+    emit filterRoleChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::SortFilterModel::filterString
+
+    The string the \l filterRole values are matched against, as specified by
+    \l filterSyntax.  All rows are accepted while the string is empty.
+
+    When the new string only narrows down the previous one, for example when
+    the user types another character into a search field, only the rows that
+    were accepted before are tested again.
+*/
+void QQmlSortFilterModel::setFilterString(const QString &string)
+{
+    if (m_filterString == string)
+        return;
+
+    const QString previous = m_filterString;
+    m_filterString = string;
+    updatePattern();
+
+    const bool refine = !previous.isEmpty()
+            && ((m_filterSyntax == Contains && string.contains(previous, m_caseSensitivity))
+                || (m_filterSyntax == StartsWith && string.startsWith(previous, m_caseSensitivity)));
+    refilter(refine);
+    emit filterStringChanged();
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::SortFilterModel::filterSyntax
+
+    How \l filterString is matched against the \l filterRole values:
+
+    \list
+    \li SortFilterModel.Contains - the value contains the string (default)
+    \li SortFilterModel.StartsWith - the value starts with the string
+    \li SortFilterModel.ExactMatch - the value is equal to the string
+    \li SortFilterModel.RegularExpression - the string is a regular expression
+        that matches the value
+    \endlist
+*/
+void QQmlSortFilterModel::setFilterSyntax(FilterSyntax syntax)
+{
+    if (m_filterSyntax == syntax)
+        return;
+
+    m_filterSyntax = syntax;
+    updatePattern();
+    refilter(false);
+    emit filterSyntaxChanged();
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::SortFilterModel::caseSensitivity
+
+    Whether string values are sorted and filtered case sensitively
+    (\c Qt.CaseSensitive) or not (\c Qt.CaseInsensitive, the default).
+*/
+void QQmlSortFilterModel::setCaseSensitivity(Qt::CaseSensitivity sensitivity)
+{
+    if (m_caseSensitivity == sensitivity)
+        return;
+
+    m_caseSensitivity = sensitivity;
+    updatePattern();
+    if (m_complete && m_source) {
+        loadSortKeys();
+        loadFilterValues();
+        if (isSorting())
+            relayout();
+        refilter(false);
+    }
+    emit caseSensitivityChanged();
+}
+
+/*!
+    \qmlproperty int QtQml.Models::SortFilterModel::count
+
+    The number of rows accepted by the filter.  This property is readonly.
+*/
+
+/*!
+    \qmlmethod int QtQml.Models::SortFilterModel::mapToSource(int row)
+
+    Returns the source model row presented at \a row, or -1 if \a row is out
+    of range.
+*/
+int QQmlSortFilterModel::mapToSource(int row) const
+{
+    return row >= 0 && row < m_proxyToSource.count() ? m_proxyToSource.at(row) : -1;
+}
+
+/*!
+    \qmlmethod int QtQml.Models::SortFilterModel::mapFromSource(int sourceRow)
+
+    Returns the row at which the source model row \a sourceRow is presented,
+    or -1 if it is filtered out.
+*/
+int QQmlSortFilterModel::mapFromSource(int sourceRow) const
+{
+    return sourceRow >= 0 && sourceRow < m_sourceToProxy.count() ? m_sourceToProxy.at(sourceRow) : -1;
+}
+
+int QQmlSortFilterModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_proxyToSource.count();
+}
+
+QVariant QQmlSortFilterModel::data(const QModelIndex &index, int role) const
+{
+    if (!m_source || !index.isValid() || index.row() >= m_proxyToSource.count())
+        return QVariant();
+    return m_source->data(m_source->index(m_proxyToSource.at(index.row()), 0), role);
+}
+
+bool QQmlSortFilterModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (!m_source || !index.isValid() || index.row() >= m_proxyToSource.count())
+        return false;
+    return m_source->setData(m_source->index(m_proxyToSource.at(index.row()), 0), value, role);
+}
+
+Qt::ItemFlags QQmlSortFilterModel::flags(const QModelIndex &index) const
+{
+    if (!m_source || !index.isValid() || index.row() >= m_proxyToSource.count())
+        return Qt::NoItemFlags;
+    return m_source->flags(m_source->index(m_proxyToSource.at(index.row()), 0));
+}
+
+QHash<int, QByteArray> QQmlSortFilterModel::roleNames() const
+{
+    return m_source ? m_source->roleNames() : QHash<int, QByteArray>();
+}
+
+void QQmlSortFilterModel::classBegin()
+{
+    m_complete = false;
+}
+
+void QQmlSortFilterModel::componentComplete()
+{
+    m_complete = true;
+    reset();
+}
+
+bool QQmlSortFilterModel::lessThan(int left, int right) const
+{
+    if (isSorting()) {
+        const SortKey &a = m_sortKeys.at(left);
+        const SortKey &b = m_sortKeys.at(right);
+        int order;
+        if (a.isNumber != b.isNumber)
+            order = a.isNumber ? -1 : 1;
+        else if (a.isNumber)
+            order = a.number < b.number ? -1 : (b.number < a.number ? 1 : 0);
+        else
+            order = a.string.compare(b.string);
+
+        if (order != 0)
+            return m_sortOrder == Qt::AscendingOrder ? order < 0 : order > 0;
+    }
+    // Keep equal rows in source order so that sorting is stable.
+    return left < right;
+}
+
+/*
+    Looks up the ids of the sort and filter roles, and returns true if either
+    of them changed.  A ListModel only reports its roles once it has data, so
+    this is repeated as rows are inserted until both roles are found.
+*/
+bool QQmlSortFilterModel::resolveRoles()
+{
+    int sortRoleId = -1;
+    int filterRoleId = -1;
+    if (m_source) {
+        const QByteArray sortRole = m_sortRole.toUtf8();
+        const QByteArray filterRole = m_filterRole.toUtf8();
+        const QHash<int, QByteArray> names = m_source->roleNames();
+        for (auto it = names.cbegin(), end = names.cend(); it != end; ++it) {
+            if (!sortRole.isEmpty() && it.value() == sortRole)
+                sortRoleId = it.key();
+            if (!filterRole.isEmpty() && it.value() == filterRole)
+                filterRoleId = it.key();
+        }
+    }
+
+    const bool changed = sortRoleId != m_sortRoleId || filterRoleId != m_filterRoleId;
+    m_sortRoleId = sortRoleId;
+    m_filterRoleId = filterRoleId;
+    return changed;
+}
+
+QQmlSortFilterModel::SortKey QQmlSortFilterModel::sortKey(int sourceRow) const
+{
+    const QVariant value = m_source->data(m_source->index(sourceRow, 0), m_sortRoleId);
+
+    SortKey key;
+    switch (value.userType()) {
+    case QMetaType::Bool:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Double:
+    case QMetaType::Float:
+        key.isNumber = true;
+        key.number = value.toDouble();
+        break;
+    case QMetaType::QDateTime:
+        key.isNumber = true;
+        key.number = double(value.toDateTime().toMSecsSinceEpoch());
+        break;
+    default:
+        key.string = m_caseSensitivity == Qt::CaseSensitive
+                ? value.toString() : value.toString().toCaseFolded();
+        break;
+    }
+    return key;
+}
+
+QString QQmlSortFilterModel::filterValue(int sourceRow) const
+{
+    const QString value = m_source->data(m_source->index(sourceRow, 0), m_filterRoleId).toString();
+    return m_caseSensitivity == Qt::CaseSensitive ? value : value.toCaseFolded();
+}
+
+bool QQmlSortFilterModel::accepts(int sourceRow) const
+{
+    if (!isFiltering())
+        return true;
+
+    const QString &value = m_filterValues.at(sourceRow);
+    switch (m_filterSyntax) {
+    case Contains:
+        return value.contains(m_pattern);
+    case StartsWith:
+        return value.startsWith(m_pattern);
+    case ExactMatch:
+        return value == m_pattern;
+    case RegularExpression:
+        return m_regularExpression.match(value).hasMatch();
+    }
+    return true;
+}
+
+void QQmlSortFilterModel::loadSortKeys()
+{
+    m_sortKeys.clear();
+    if (!isSorting())
+        return;
+
+    const int rows = m_accepted.count();
+    m_sortKeys.resize(rows);
+    for (int row = 0; row < rows; ++row)
+        m_sortKeys[row] = sortKey(row);
+}
+
+void QQmlSortFilterModel::loadFilterValues()
+{
+    m_filterValues.clear();
+    if (m_filterRoleId == -1)
+        return;
+
+    const int rows = m_accepted.count();
+    m_filterValues.resize(rows);
+    for (int row = 0; row < rows; ++row)
+        m_filterValues[row] = filterValue(row);
+}
+
+void QQmlSortFilterModel::updatePattern()
+{
+    if (m_filterSyntax == RegularExpression) {
+        m_pattern.clear();
+        m_regularExpression = QRegularExpression(m_filterString, m_caseSensitivity == Qt::CaseSensitive
+                ? QRegularExpression::NoPatternOption
+                : QRegularExpression::CaseInsensitiveOption);
+        m_regularExpression.optimize();
+    } else {
+        m_pattern = m_caseSensitivity == Qt::CaseSensitive
+                ? m_filterString : m_filterString.toCaseFolded();
+        m_regularExpression = QRegularExpression();
+    }
+}
+
+void QQmlSortFilterModel::rebuild()
+{
+    resolveRoles();
+
+    const int rows = m_source ? m_source->rowCount() : 0;
+    m_accepted.fill(false, rows);
+    loadSortKeys();
+    loadFilterValues();
+    for (int row = 0; row < rows; ++row)
+        m_accepted[row] = accepts(row);
+
+    m_sorted.resize(rows);
+    std::iota(m_sorted.begin(), m_sorted.end(), 0);
+    if (isSorting())
+        std::sort(m_sorted.begin(), m_sorted.end(), [this](int left, int right) { return lessThan(left, right); });
+
+    m_proxyToSource.clear();
+    for (int row : qAsConst(m_sorted)) {
+        if (m_accepted.at(row))
+            m_proxyToSource.append(row);
+    }
+    updateSourceToProxy();
+}
+
+void QQmlSortFilterModel::reset()
+{
+    if (!m_complete)
+        return;
+
+    const int previousCount = count();
+    beginResetModel();
+    rebuild();
+    endResetModel();
+    if (count() != previousCount)
+        emit countChanged();
+}
+
+/*
+    Re-evaluates the filter.  If \a refine is true the filter is known to be
+    narrower than before and only the rows that are currently accepted are
+    tested.
+*/
+void QQmlSortFilterModel::refilter(bool refine)
+{
+    if (!m_complete || !m_source)
+        return;
+
+    for (int row = 0; row < m_accepted.count(); ++row) {
+        if (!refine || m_accepted.at(row))
+            m_accepted[row] = accepts(row);
+    }
+    applyAccepted();
+}
+
+/*
+    Brings the proxy rows in line with m_accepted, emitting a removal for each
+    run of rows that are no longer accepted and an insertion for each run of
+    rows that are newly accepted.  Both the current and the new proxy rows
+    follow the order of m_sorted, so a single merge pass finds the runs.
+*/
+void QQmlSortFilterModel::applyAccepted()
+{
+    const int previousCount = count();
+
+    QVector<int> rank(m_sorted.count());
+    for (int i = 0; i < m_sorted.count(); ++i)
+        rank[m_sorted.at(i)] = i;
+
+    QVector<int> accepted;
+    accepted.reserve(m_sorted.count());
+    for (int row : qAsConst(m_sorted)) {
+        if (m_accepted.at(row))
+            accepted.append(row);
+    }
+
+    QVector<QPair<int, int>> removes;
+    QVector<QPair<int, int>> inserts;
+    const QVector<int> &current = m_proxyToSource;
+    for (int i = 0, j = 0; i < current.count() || j < accepted.count();) {
+        if (i < current.count() && j < accepted.count() && current.at(i) == accepted.at(j)) {
+            ++i;
+            ++j;
+        } else if (j == accepted.count()
+                || (i < current.count() && rank.at(current.at(i)) < rank.at(accepted.at(j)))) {
+            if (!removes.isEmpty() && removes.last().first + removes.last().second == i)
+                ++removes.last().second;
+            else
+                removes.append(qMakePair(i, 1));
+            ++i;
+        } else {
+            if (!inserts.isEmpty() && inserts.last().first + inserts.last().second == j)
+                ++inserts.last().second;
+            else
+                inserts.append(qMakePair(j, 1));
+            ++j;
+        }
+    }
+
+    for (int i = removes.count() - 1; i >= 0; --i) {
+        const QPair<int, int> &remove = removes.at(i);
+        beginRemoveRows(QModelIndex(), remove.first, remove.first + remove.second - 1);
+        m_proxyToSource.remove(remove.first, remove.second);
+        endRemoveRows();
+    }
+    for (const QPair<int, int> &insert : qAsConst(inserts)) {
+        beginInsertRows(QModelIndex(), insert.first, insert.first + insert.second - 1);
+        m_proxyToSource.insert(insert.first, insert.second, -1);
+        std::copy(accepted.cbegin() + insert.first, accepted.cbegin() + insert.first + insert.second,
+                  m_proxyToSource.begin() + insert.first);
+        endInsertRows();
+    }
+    Q_ASSERT(m_proxyToSource == accepted);
+
+    updateSourceToProxy();
+    if (count() != previousCount)
+        emit countChanged();
+}
+
+/*
+    Moves \a sourceRow, whose sort key has changed, to its new position in
+    m_sorted and, if it is accepted, in the proxy rows.
+*/
+void QQmlSortFilterModel::reposition(int sourceRow)
+{
+    const auto less = [this](int left, int right) { return lessThan(left, right); };
+
+    m_sorted.removeOne(sourceRow);
+    m_sorted.insert(std::lower_bound(m_sorted.begin(), m_sorted.end(), sourceRow, less), sourceRow);
+
+    const int from = m_sourceToProxy.at(sourceRow);
+    if (from == -1)
+        return;
+
+    // The other proxy rows are still in order, so search either side of the old position.
+    const auto begin = m_proxyToSource.begin();
+    int to = std::lower_bound(begin, begin + from, sourceRow, less) - begin;
+    if (to == from)
+        to = std::lower_bound(begin + from + 1, m_proxyToSource.end(), sourceRow, less) - begin - 1;
+    if (to == from)
+        return;
+
+    beginMoveRows(QModelIndex(), from, from, QModelIndex(), to > from ? to + 1 : to);
+    m_proxyToSource.remove(from);
+    m_proxyToSource.insert(to, sourceRow);
+    endMoveRows();
+
+    for (int row = qMin(from, to), last = qMax(from, to); row <= last; ++row)
+        m_sourceToProxy[m_proxyToSource.at(row)] = row;
+}
+
+/*
+    Re-sorts all rows as a layout change.  If \a moveStart is not -1 the
+    source rows \a moveStart to \a moveEnd have been moved to before
+    \a moveDestination, and the cached values are moved along with them.
+*/
+void QQmlSortFilterModel::relayout(int moveStart, int moveEnd, int moveDestination)
+{
+    emit layoutAboutToBeChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+
+    const QModelIndexList persistent = persistentIndexList();
+    QVector<int> sourceRows;
+    sourceRows.reserve(persistent.count());
+    for (const QModelIndex &index : persistent) {
+        const int row = m_proxyToSource.at(index.row());
+        sourceRows.append(moveStart == -1 ? row : movedRow(row, moveStart, moveEnd, moveDestination));
+    }
+
+    if (moveStart != -1) {
+        moveRows(m_sortKeys, moveStart, moveEnd, moveDestination);
+        moveRows(m_filterValues, moveStart, moveEnd, moveDestination);
+        moveRows(m_accepted, moveStart, moveEnd, moveDestination);
+    }
+
+    std::iota(m_sorted.begin(), m_sorted.end(), 0);
+    if (isSorting())
+        std::sort(m_sorted.begin(), m_sorted.end(), [this](int left, int right) { return lessThan(left, right); });
+
+    m_proxyToSource.clear();
+    for (int row : qAsConst(m_sorted)) {
+        if (m_accepted.at(row))
+            m_proxyToSource.append(row);
+    }
+    updateSourceToProxy();
+
+    QModelIndexList updated;
+    updated.reserve(sourceRows.count());
+    for (int row : qAsConst(sourceRows))
+        updated.append(index(m_sourceToProxy.at(row), 0));
+    changePersistentIndexList(persistent, updated);
+
+    emit layoutChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+}
+
+void QQmlSortFilterModel::updateSourceToProxy()
+{
+    m_sourceToProxy.fill(-1, m_accepted.count());
+    for (int row = 0; row < m_proxyToSource.count(); ++row)
+        m_sourceToProxy[m_proxyToSource.at(row)] = row;
+}
+
+void QQmlSortFilterModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    if (!m_complete || topLeft.parent().isValid())
+        return;
+
+    if (hasUnresolvedRoles() && resolveRoles()) {
+        reset();
+        return;
+    }
+
+    const int first = topLeft.row();
+    const int last = bottomRight.row();
+
+    if (isSorting() && (roles.isEmpty() || roles.contains(m_sortRoleId))) {
+        QVector<QPair<int, SortKey>> changed;
+        for (int row = first; row <= last; ++row) {
+            const SortKey key = sortKey(row);
+            if (key != m_sortKeys.at(row))
+                changed.append(qMakePair(row, key));
+        }
+        if (changed.count() > maximumRepositionCount) {
+            for (const auto &change : qAsConst(changed))
+                m_sortKeys[change.first] = change.second;
+            relayout();
+        } else {
+            // Update the keys one at a time so that only the row being repositioned is out of order.
+            for (const auto &change : qAsConst(changed)) {
+                m_sortKeys[change.first] = change.second;
+                reposition(change.first);
+            }
+        }
+    }
+
+    if (m_filterRoleId != -1 && (roles.isEmpty() || roles.contains(m_filterRoleId))) {
+        bool changed = false;
+        for (int row = first; row <= last; ++row) {
+            m_filterValues[row] = filterValue(row);
+            const bool accepted = accepts(row);
+            if (accepted != m_accepted.at(row)) {
+                m_accepted[row] = accepted;
+                changed = true;
+            }
+        }
+        if (changed)
+            applyAccepted();
+    }
+
+    // Forward the change for the rows that are still visible, in runs of adjacent rows.
+    QVector<int> rows;
+    for (int row = first; row <= last; ++row) {
+        if (m_sourceToProxy.at(row) != -1)
+            rows.append(m_sourceToProxy.at(row));
+    }
+    std::sort(rows.begin(), rows.end());
+    for (int i = 0; i < rows.count();) {
+        int j = i + 1;
+        while (j < rows.count() && rows.at(j) == rows.at(j - 1) + 1)
+            ++j;
+        emit dataChanged(index(rows.at(i), 0), index(rows.at(j - 1), 0), roles);
+        i = j;
+    }
+}
+
+void QQmlSortFilterModel::sourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (!m_complete || parent.isValid())
+        return;
+
+    if (hasUnresolvedRoles() && resolveRoles()) {
+        reset();
+        return;
+    }
+
+    const int count = last - first + 1;
+    for (int &row : m_proxyToSource) {
+        if (row >= first)
+            row += count;
+    }
+
+    m_accepted.insert(first, count, false);
+    if (isSorting()) {
+        m_sortKeys.insert(first, count, SortKey());
+        for (int row = first; row <= last; ++row)
+            m_sortKeys[row] = sortKey(row);
+    }
+    if (m_filterRoleId != -1) {
+        m_filterValues.insert(first, count, QString());
+        for (int row = first; row <= last; ++row)
+            m_filterValues[row] = filterValue(row);
+    }
+    for (int row = first; row <= last; ++row)
+        m_accepted[row] = accepts(row);
+
+    if (isSorting() && count <= maximumRepositionCount) {
+        for (int &row : m_sorted) {
+            if (row >= first)
+                row += count;
+        }
+        const auto less = [this](int left, int right) { return lessThan(left, right); };
+        for (int row = first; row <= last; ++row)
+            m_sorted.insert(std::lower_bound(m_sorted.begin(), m_sorted.end(), row, less), row);
+    } else {
+        m_sorted.resize(m_accepted.count());
+        std::iota(m_sorted.begin(), m_sorted.end(), 0);
+        if (isSorting())
+            std::sort(m_sorted.begin(), m_sorted.end(), [this](int left, int right) { return lessThan(left, right); });
+    }
+
+    applyAccepted();
+}
+
+void QQmlSortFilterModel::sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (!m_complete || parent.isValid())
+        return;
+
+    bool changed = false;
+    for (int row = first; row <= last; ++row) {
+        if (m_accepted.at(row)) {
+            m_accepted[row] = false;
+            changed = true;
+        }
+    }
+    if (changed)
+        applyAccepted();
+}
+
+void QQmlSortFilterModel::sourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (!m_complete || parent.isValid())
+        return;
+
+    const int count = last - first + 1;
+    int sorted = 0;
+    for (int i = 0; i < m_sorted.count(); ++i) {
+        const int row = m_sorted.at(i);
+        if (row < first)
+            m_sorted[sorted++] = row;
+        else if (row > last)
+            m_sorted[sorted++] = row - count;
+    }
+    m_sorted.resize(sorted);
+
+    for (int &row : m_proxyToSource) {
+        if (row > last)
+            row -= count;
+    }
+
+    m_accepted.remove(first, count);
+    if (isSorting())
+        m_sortKeys.remove(first, count);
+    if (m_filterRoleId != -1)
+        m_filterValues.remove(first, count);
+    updateSourceToProxy();
+}
+
+void QQmlSortFilterModel::sourceRowsMoved(const QModelIndex &parent, int start, int end, const QModelIndex &destination, int row)
+{
+    if (!m_complete)
+        return;
+
+    if (parent.isValid() || destination.isValid()) {
+        if (!parent.isValid() || !destination.isValid())
+            reset();
+        return;
+    }
+    relayout(start, end, row);
+}
+
+void QQmlSortFilterModel::sourceAboutToBeReset()
+{
+    if (m_complete)
+        beginResetModel();
+}
+
+void QQmlSortFilterModel::sourceReset()
+{
+    if (!m_complete)
+        return;
+
+    const int previousCount = count();
+    rebuild();
+    endResetModel();
+    if (count() != previousCount)
+        emit countChanged();
+}
+
+void QQmlSortFilterModel::sourceDestroyed()
+{
+    reset();
+    emit sourceModelChanged();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,206 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QQMLSORTFILTERMODEL_P_H
+#define QQMLSORTFILTERMODEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtqmlglobal_p.h>
+#include <QtQml/qqml.h>
+#include <QtQml/qqmlparserstatus.h>
+#include <QtCore/qabstractitemmodel.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qregularexpression.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QML_PRIVATE_EXPORT QQmlSortFilterModel : public QAbstractListModel, public QQmlParserStatus
+{
+    Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
+
+    Q_PROPERTY(QAbstractItemModel *sourceModel READ sourceModel WRITE setSourceModel NOTIFY sourceModelChanged)
+    Q_PROPERTY(QString sortRole READ sortRole WRITE setSortRole NOTIFY sortRoleChanged)
+    Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder NOTIFY sortOrderChanged)
+    Q_PROPERTY(QString filterRole READ filterRole WRITE setFilterRole NOTIFY filterRoleChanged)
+    Q_PROPERTY(QString filterString READ filterString WRITE setFilterString NOTIFY filterStringChanged)
+    Q_PROPERTY(FilterSyntax filterSyntax READ filterSyntax WRITE setFilterSyntax NOTIFY filterSyntaxChanged)
+    Q_PROPERTY(Qt::CaseSensitivity caseSensitivity READ caseSensitivity WRITE setCaseSensitivity NOTIFY caseSensitivityChanged)
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    enum FilterSyntax {
+        Contains,
+        StartsWith,
+        ExactMatch,
+        RegularExpression
+    };
+    Q_ENUM(FilterSyntax)
+
+    QQmlSortFilterModel(QObject *parent = nullptr);
+    ~QQmlSortFilterModel();
+
+    QAbstractItemModel *sourceModel() const;
+    void setSourceModel(QAbstractItemModel *model);
+
+    QString sortRole() const { return m_sortRole; }
+    void setSortRole(const QString &role);
+
+    Qt::SortOrder sortOrder() const { return m_sortOrder; }
+    void setSortOrder(Qt::SortOrder order);
+
+    QString filterRole() const { return m_filterRole; }
+    void setFilterRole(const QString &role);
+
+    QString filterString() const { return m_filterString; }
+    void setFilterString(const QString &string);
+
+    FilterSyntax filterSyntax() const { return m_filterSyntax; }
+    void setFilterSyntax(FilterSyntax syntax);
+
+    Qt::CaseSensitivity caseSensitivity() const { return m_caseSensitivity; }
+    void setCaseSensitivity(Qt::CaseSensitivity sensitivity);
+
+    int count() const { return m_proxyToSource.count(); }
+
+    Q_INVOKABLE int mapToSource(int row) const;
+    Q_INVOKABLE int mapFromSource(int sourceRow) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    void classBegin() override;
+    void componentComplete() override;
+
+Q_SIGNALS:
+    void sourceModelChanged();
+    void sortRoleChanged();
+    void sortOrderChanged();
+    void filterRoleChanged();
+    void filterStringChanged();
+    void filterSyntaxChanged();
+    void caseSensitivityChanged();
+    void countChanged();
+
+private Q_SLOTS:
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+    void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last);
+    void sourceRowsRemoved(const QModelIndex &parent, int first, int last);
+    void sourceRowsMoved(const QModelIndex &parent, int start, int end, const QModelIndex &destination, int row);
+    void sourceAboutToBeReset();
+    void sourceReset();
+    void sourceDestroyed();
+
+private:
+    struct SortKey
+    {
+        QString string;
+        double number = 0;
+        bool isNumber = false;
+
+        bool operator ==(const SortKey &other) const {
+            return isNumber == other.isNumber && (isNumber ? number == other.number : string == other.string); }
+        bool operator !=(const SortKey &other) const { return !(*this == other); }
+    };
+
+    bool isSorting() const { return m_sortRoleId != -1; }
+    bool isFiltering() const { return m_filterRoleId != -1 && !m_filterString.isEmpty(); }
+    bool hasUnresolvedRoles() const {
+        return (m_sortRoleId == -1 && !m_sortRole.isEmpty())
+                || (m_filterRoleId == -1 && !m_filterRole.isEmpty()); }
+    bool lessThan(int left, int right) const;
+
+    bool resolveRoles();
+    SortKey sortKey(int sourceRow) const;
+    QString filterValue(int sourceRow) const;
+    bool accepts(int sourceRow) const;
+    void loadSortKeys();
+    void loadFilterValues();
+    void updatePattern();
+
+    void rebuild();
+    void reset();
+    void refilter(bool refine);
+    void applyAccepted();
+    void reposition(int sourceRow);
+    void relayout(int moveStart = -1, int moveEnd = -1, int moveDestination = -1);
+    void updateSourceToProxy();
+
+    QPointer<QAbstractItemModel> m_source;
+    QString m_sortRole;
+    QString m_filterRole;
+    QString m_filterString;
+    QString m_pattern;
+    QRegularExpression m_regularExpression;
+    Qt::SortOrder m_sortOrder;
+    FilterSyntax m_filterSyntax;
+    Qt::CaseSensitivity m_caseSensitivity;
+    int m_sortRoleId;
+    int m_filterRoleId;
+    bool m_complete;
+
+    QVector<int> m_sorted;          // All source rows, in sort order
+    QVector<int> m_proxyToSource;   // The accepted subset of m_sorted
+    QVector<int> m_sourceToProxy;   // -1 for rows that are filtered out
+    QVector<SortKey> m_sortKeys;
+    QVector<QString> m_filterValues;
+    QVector<bool> m_accepted;
+};
+
+QT_END_NAMESPACE
+
+QML_DECLARE_TYPE(QQmlSortFilterModel)
+
+#endif // QQMLSORTFILTERMODEL_P_H
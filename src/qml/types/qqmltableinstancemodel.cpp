@@ -141,7 +141,7 @@ QQmlDelegateModelItem *QQmlTableInstanceModel::resolveModelItem(int index)
         return nullptr;
 
     // Check if the pool contains an item that can be reused
-    modelItem = takeFromReusableItemsPool(delegate);
+    modelItem = m_reusableItemsPool.takeItem(delegate, index);
     if (modelItem) {
         reuseItem(modelItem, index);
         m_modelItems.insert(index, modelItem);
@@ -224,10 +224,8 @@ QQmlInstanceModel::ReleaseFlags QQmlTableInstanceModel::release(QObject *object,
     // The item is not referenced by anyone
     m_modelItems.remove(modelItem->index);
 
-    if (reusable == Reusable) {
-        insertIntoReusableItemsPool(modelItem);
+    if (reusable == Reusable && insertIntoReusableItemsPool(modelItem))
         return QQmlInstanceModel::Referenced;
-    }
 
     // The item is not reused or referenced by anyone, so just delete it
     modelItem->destroyObject();
@@ -257,7 +255,7 @@ void QQmlTableInstanceModel::cancel(int index)
     delete modelItem;
 }
 
-void QQmlTableInstanceModel::insertIntoReusableItemsPool(QQmlDelegateModelItem *modelItem)
+bool QQmlTableInstanceModel::insertIntoReusableItemsPool(QQmlDelegateModelItem *modelItem)
 {
     // Currently, the only way for a view to reuse items is to call QQmlTableInstanceModel::release()
     // with the second argument explicitly set to QQmlTableInstanceModel::Reusable. If the released
@@ -290,52 +288,32 @@ void QQmlTableInstanceModel::insertIntoReusableItemsPool(QQmlDelegateModelItem *
     // items in the pool for a bit longer, effectively keeping more items in circulation.
     // A recommended maxPoolTime would be equal to the number of dimenstions in the view, which
     // means 1 for a list view and 2 for a table view. If you specify 0, all items will be drained.
+    // The pool itself is shared with QQmlDelegateModel, which recycles items the same way for
+    // ListView and GridView. If the pool is limited in size and already full, the item is not
+    // inserted, and the caller should destroy it instead.
     Q_ASSERT(!modelItem->incubationTask);
     Q_ASSERT(!modelItem->isObjectReferenced());
     Q_ASSERT(!modelItem->isReferenced());
     Q_ASSERT(modelItem->object);
 
-    modelItem->poolTime = 0;
-    m_reusableItemsPool.append(modelItem);
-    emit itemPooled(modelItem->index, modelItem->object);
-}
-
-QQmlDelegateModelItem *QQmlTableInstanceModel::takeFromReusableItemsPool(const QQmlComponent *delegate)
-{
-    // Find the oldest item in the pool that was made from the same delegate as
-    // the given argument, remove it from the pool, and return it.
-    if (m_reusableItemsPool.isEmpty())
-        return nullptr;
-
-    for (auto it = m_reusableItemsPool.begin(); it != m_reusableItemsPool.end(); ++it) {
-        if ((*it)->delegate != delegate)
-            continue;
-        auto modelItem = *it;
-        m_reusableItemsPool.erase(it);
-        return modelItem;
-    }
+    if (!m_reusableItemsPool.insertItem(modelItem))
+        return false;
 
-    return nullptr;
+    emit itemPooled(modelItem->index, modelItem->object);
+    return true;
 }
 
 void QQmlTableInstanceModel::drainReusableItemsPool(int maxPoolTime)
 {
-    // Rather than releasing all pooled items upon a call to this function, each
-    // item has a poolTime. The poolTime specifies for how many loading cycles an item
-    // has been resting in the pool. And for each invocation of this function, poolTime
-    // will increase. If poolTime is equal to, or exceeds, maxPoolTime, it will be removed
-    // from the pool and released. This way, the view can tweak a bit for how long
-    // items should stay in "circulation", even if they are not recycled right away.
-    for (auto it = m_reusableItemsPool.begin(); it != m_reusableItemsPool.end();) {
-        auto modelItem = *it;
-        modelItem->poolTime++;
-        if (modelItem->poolTime <= maxPoolTime) {
-            ++it;
-        } else {
-            it = m_reusableItemsPool.erase(it);
-            release(modelItem->object, NotReusable);
-        }
-    }
+    // Pooled items are no longer referenced by anyone (their object ref count
+    // dropped to zero when they were released into the pool), so destroy them
+    // directly rather than releasing them a second time.
+    m_reusableItemsPool.drain(maxPoolTime, [this](QQmlDelegateModelItem *modelItem) {
+        QObject *object = modelItem->object;
+        modelItem->destroyObject();
+        emit destroyingItem(object);
+        delete modelItem;
+    });
 }
 
 void QQmlTableInstanceModel::reuseItem(QQmlDelegateModelItem *item, int newModelIndex)
@@ -84,12 +84,6 @@ class Q_QML_PRIVATE_EXPORT QQmlTableInstanceModel : public QQmlInstanceModel
     Q_OBJECT
 
 public:
-
-    enum ReusableFlag {
-        NotReusable,
-        Reusable
-    };
-
     QQmlTableInstanceModel(QQmlContext *qmlContext, QObject *parent = nullptr);
     ~QQmlTableInstanceModel() override;
 
@@ -110,14 +104,12 @@ public:
     const QAbstractItemModel *abstractItemModel() const override;
 
     QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
-    ReleaseFlags release(QObject *object) override { return release(object, NotReusable); }
-    ReleaseFlags release(QObject *object, ReusableFlag reusable);
+    ReleaseFlags release(QObject *object, ReusableFlag reusable = NotReusable) override;
     void cancel(int) override;
 
-    void insertIntoReusableItemsPool(QQmlDelegateModelItem *modelItem);
-    QQmlDelegateModelItem *takeFromReusableItemsPool(const QQmlComponent *delegate);
-    void drainReusableItemsPool(int maxPoolTime);
-    int poolSize() { return m_reusableItemsPool.size(); }
+    bool insertIntoReusableItemsPool(QQmlDelegateModelItem *modelItem);
+    void drainReusableItemsPool(int maxPoolTime) override;
+    int poolSize() override { return m_reusableItemsPool.size(); }
     void reuseItem(QQmlDelegateModelItem *item, int newModelIndex);
 
     QQmlIncubator::Status incubationStatus(int index) override;
@@ -126,10 +118,6 @@ public:
     void setWatchedRoles(const QList<QByteArray> &) override { Q_UNREACHABLE(); }
     int indexOf(QObject *, QObject *) const override { Q_UNREACHABLE(); return 0; }
 
-Q_SIGNALS:
-    void itemPooled(int index, QObject *object);
-    void itemReused(int index, QObject *object);
-
 private:
     QQmlComponent *resolveDelegate(int index);
 
@@ -140,7 +128,7 @@ private:
     QQmlDelegateModelItemMetaType *m_metaType;
 
     QHash<int, QQmlDelegateModelItem *> m_modelItems;
-    QList<QQmlDelegateModelItem *> m_reusableItemsPool;
+    QQmlReusableDelegateModelItemsPool m_reusableItemsPool;
     QList<QQmlIncubator *> m_finishedIncubationTasks;
 
     void incubateModelItem(QQmlDelegateModelItem *modelItem, QQmlIncubator::IncubationMode incubationMode);
@@ -51,6 +51,7 @@
 #include <QtCore/qdebug.h>
 #include <QtQml/qjsengine.h>
 #include <QtCore/qmutex.h>
+#include <QtCore/qatomic.h>
 #include <QtCore/qwaitcondition.h>
 #include <QtCore/qfile.h>
 #include <QtCore/qdatetime.h>
@@ -159,9 +160,11 @@ public:
         QScopedPointer<QNetworkAccessManager> accessManager;
 #endif
         int id = -1;
+        QAtomicInt pendingMessages;
     };
 
     QHash<int, WorkerScript *> workers;
+    QAtomicInt m_pendingMessages;
     QV4::ReturnedValue getWorker(WorkerScript *);
 
     int m_nextId;
@@ -192,11 +195,16 @@ QV4::ReturnedValue QQuickWorkerScriptEnginePrivate::method_sendMessage(const QV4
     WorkerScript *script = static_cast<WorkerScript *>(scope.engine->v8Engine);
 
     QV4::ScopedValue v(scope, argc > 0 ? argv[0] : QV4::Value::undefinedValue());
-    QByteArray data = QV4::Serialize::serialize(v, scope.engine);
+    QV4::ScopedValue transferList(scope, argc > 1 ? argv[1] : QV4::Value::undefinedValue());
+    QByteArray data = QV4::Serialize::serialize(v, transferList, scope.engine);
+    if (scope.engine->hasException)
+        return QV4::Encode::undefined();
 
     QMutexLocker locker(&script->p->m_lock);
     if (script && script->owner)
         QCoreApplication::postEvent(script->owner, new WorkerDataEvent(0, data));
+    else
+        QV4::Serialize::release(data);
 
     return QV4::Encode::undefined();
 }
@@ -205,6 +213,7 @@ bool QQuickWorkerScriptEnginePrivate::event(QEvent *event)
 {
     if (event->type() == (QEvent::Type)WorkerDataEvent::WorkerData) {
         WorkerDataEvent *workerEvent = static_cast<WorkerDataEvent *>(event);
+        m_pendingMessages.deref();
         processMessage(workerEvent->workerId(), workerEvent->data());
         return true;
     } else if (event->type() == (QEvent::Type)WorkerLoadEvent::WorkerLoad) {
@@ -234,6 +243,8 @@ void QQuickWorkerScriptEnginePrivate::processMessage(int id, const QByteArray &d
     if (!script)
         return;
 
+    script->pendingMessages.deref();
+
     QV4::ExecutionEngine *v4 = QV8Engine::getV4(script);
     QV4::Scope scope(v4);
     QV4::ScopedString v(scope);
@@ -316,6 +327,8 @@ WorkerDataEvent::WorkerDataEvent(int workerId, const QByteArray &data)
 
 WorkerDataEvent::~WorkerDataEvent()
 {
+    // Also releases messages that were never delivered
+    QV4::Serialize::release(m_data);
 }
 
 int WorkerDataEvent::workerId() const
@@ -363,12 +376,13 @@ QQmlError WorkerErrorEvent::error() const
     return m_error;
 }
 
-QQuickWorkerScriptEngine::QQuickWorkerScriptEngine(QQmlEngine *parent)
-: QThread(parent), d(new QQuickWorkerScriptEnginePrivate(parent))
+QQuickWorkerScriptEngine::QQuickWorkerScriptEngine(QQmlEngine *engine, QThread::Priority priority,
+                                                   QObject *parent)
+: QThread(parent ? parent : engine), d(new QQuickWorkerScriptEnginePrivate(engine)), m_scriptCount(0)
 {
     d->m_lock.lock();
     connect(d, SIGNAL(stopThread()), this, SLOT(quit()), Qt::DirectConnection);
-    start(QThread::LowestPriority);
+    start(priority);
     d->m_wait.wait(&d->m_lock);
     d->moveToThread(this);
     d->m_lock.unlock();
@@ -440,6 +454,7 @@ int QQuickWorkerScriptEngine::registerWorkerScript(QQuickWorkerScript *owner)
     d->workers.insert(script->id, script);
     d->m_lock.unlock();
 
+    ++m_scriptCount;
     return script->id;
 }
 
@@ -448,6 +463,7 @@ void QQuickWorkerScriptEngine::removeWorkerScript(int id)
     QQuickWorkerScriptEnginePrivate::WorkerScript* script = d->workers.value(id);
     if (script) {
         script->owner = nullptr;
+        --m_scriptCount;
         QCoreApplication::postEvent(d, new WorkerRemoveEvent(id));
     }
 }
@@ -459,9 +475,31 @@ void QQuickWorkerScriptEngine::executeUrl(int id, const QUrl &url)
 
 void QQuickWorkerScriptEngine::sendMessage(int id, const QByteArray &data)
 {
+    d->m_lock.lock();
+    if (QQuickWorkerScriptEnginePrivate::WorkerScript *script = d->workers.value(id))
+        script->pendingMessages.ref();
+    d->m_lock.unlock();
+
+    d->m_pendingMessages.ref();
     QCoreApplication::postEvent(d, new WorkerDataEvent(id, data));
 }
 
+/*
+    Returns the number of messages posted to this thread that have not been
+    delivered to their worker script yet, summed over all scripts.
+*/
+int QQuickWorkerScriptEngine::pendingMessageCount() const
+{
+    return d->m_pendingMessages.load();
+}
+
+int QQuickWorkerScriptEngine::pendingMessageCount(int id) const
+{
+    QMutexLocker locker(&d->m_lock);
+    QQuickWorkerScriptEnginePrivate::WorkerScript *script = d->workers.value(id);
+    return script ? script->pendingMessages.load() : 0;
+}
+
 void QQuickWorkerScriptEngine::run()
 {
     d->m_lock.lock();
@@ -476,6 +514,62 @@ void QQuickWorkerScriptEngine::run()
     d->workers.clear();
 }
 
+/*
+    The pool owns the worker script threads of one QQmlEngine. Threads are
+    started on demand, up to maximumThreadCount(), and each new script is
+    assigned to the least loaded thread running at the requested priority.
+    Once the pool is full, scripts asking for a priority no thread runs at
+    share the least loaded thread instead.
+*/
+QQuickWorkerScriptEnginePool::QQuickWorkerScriptEnginePool(QQmlEngine *parent)
+: QObject(parent), m_qmlEngine(parent), m_maximumThreadCount(defaultMaximumThreadCount())
+{
+}
+
+QQuickWorkerScriptEnginePool::~QQuickWorkerScriptEnginePool()
+{
+    // Stop the threads in order; each destructor drains the pending events
+    qDeleteAll(m_engines);
+}
+
+int QQuickWorkerScriptEnginePool::defaultMaximumThreadCount()
+{
+    static const int count = [] {
+        bool ok = false;
+        const int value = qEnvironmentVariableIntValue("QML_WORKERSCRIPT_MAX_THREADS", &ok);
+        return qMax(1, ok ? value : QThread::idealThreadCount());
+    }();
+    return count;
+}
+
+QQuickWorkerScriptEngine *QQuickWorkerScriptEnginePool::engineForPriority(QThread::Priority priority)
+{
+    QQuickWorkerScriptEngine *best = nullptr;
+    for (QQuickWorkerScriptEngine *engine : qAsConst(m_engines)) {
+        if (engine->priority() == priority && (!best || engine->scriptCount() < best->scriptCount()))
+            best = engine;
+    }
+
+    if ((!best || best->scriptCount() > 0) && m_engines.count() < maximumThreadCount()) {
+        best = new QQuickWorkerScriptEngine(m_qmlEngine, priority, this);
+        m_engines.append(best);
+    } else if (!best) {
+        for (QQuickWorkerScriptEngine *engine : qAsConst(m_engines)) {
+            if (!best || engine->scriptCount() < best->scriptCount())
+                best = engine;
+        }
+    }
+    return best;
+}
+
+int QQuickWorkerScriptEnginePool::pendingMessageCount() const
+{
+    int count = 0;
+    for (QQuickWorkerScriptEngine *engine : m_engines)
+        count += engine->pendingMessageCount();
+    return count;
+}
+
 
 /*!
     \qmltype WorkerScript
@@ -516,6 +610,10 @@ void QQuickWorkerScriptEngine::run()
     isolation and thread-safety. If the impact of that results in a memory consumption that is too
     high for your environment, then consider sharing a WorkerScript element.
 
+    Since Qt 5.12 the WorkerScript elements of an engine are spread over a pool of threads, so
+    that CPU-heavy scripts do not serialize against each other. See \l priority for details.
+    A ListModel should only be passed to one worker script.
+
     \section3 Restrictions
 
     Since the \c WorkerScript.onMessage() function is run in a separate thread, the
@@ -535,7 +633,8 @@ void QQuickWorkerScriptEngine::run()
         {Threaded ListModel Example}
 */
 QQuickWorkerScript::QQuickWorkerScript(QObject *parent)
-: QObject(parent), m_engine(nullptr), m_scriptId(-1), m_componentComplete(true)
+: QObject(parent), m_engine(nullptr), m_scriptId(-1), m_priority(LowestPriority)
+, m_componentComplete(true)
 {
 }
 
@@ -573,7 +672,67 @@ void QQuickWorkerScript::setSource(const QUrl &source)
 }
 
 /*!
-    \qmlmethod WorkerScript::sendMessage(jsobject message)
+    \qmlproperty enumeration WorkerScript::priority
+    \since 5.13
+
+    This property holds the priority of the thread the script runs in.
+
+    Worker scripts of the same engine are distributed over a pool of
+    threads, so that independent scripts can run in parallel. Each script
+    is placed on the least loaded thread running at the requested priority.
+    The size of the pool defaults to the number of processor cores and can
+    be limited with the \c QML_WORKERSCRIPT_MAX_THREADS environment variable.
+    Once all threads of the pool are in use, a script asking for a priority
+    no thread runs at shares the least loaded thread of another priority.
+
+    A ListModel sent to a worker script can only be used by the scripts of
+    one thread. Sending the same model to a script running on another thread
+    prints a warning, and the script receives \c undefined instead.
+
+    The priority is applied when the worker script is established, at the
+    end of its creation. Changing it afterwards has no effect.
+
+    \value WorkerScript.IdlePriority
+    \value WorkerScript.LowestPriority (default)
+    \value WorkerScript.LowPriority
+    \value WorkerScript.NormalPriority
+    \value WorkerScript.HighPriority
+    \value WorkerScript.HighestPriority
+    \value WorkerScript.TimeCriticalPriority
+
+    \sa QThread::Priority
+*/
+QQuickWorkerScript::Priority QQuickWorkerScript::priority() const
+{
+    return m_priority;
+}
+
+void QQuickWorkerScript::setPriority(Priority priority)
+{
+    if (m_priority == priority)
+        return;
+
+    if (m_engine)
+        qmlWarning(this) << "priority cannot be changed once the worker script is established";
+
+    m_priority = priority;
+    emit priorityChanged();
+}
+
+/*!
+    \qmlmethod int WorkerScript::pendingMessageCount()
+    \since 5.13
+
+    Returns the number of messages sent to the worker script with
+    sendMessage() that it has not started to handle yet.
+*/
+int QQuickWorkerScript::pendingMessageCount() const
+{
+    return m_engine ? m_engine->pendingMessageCount(m_scriptId) : 0;
+}
+
+/*!
+    \qmlmethod WorkerScript::sendMessage(jsobject message, array transferList)
 
     Sends the given \a message to a worker script handler in another
     thread. The other worker script handler can receive this message
@@ -585,12 +744,29 @@ void QQuickWorkerScript::setSource(const QUrl &source)
     \list
     \li boolean, number, string
     \li JavaScript objects and arrays
+    \li ArrayBuffer and SharedArrayBuffer objects
     \li ListModel objects (any other type of QObject* is not allowed)
     \endlist
 
     All objects and arrays are copied to the \c message. With the exception
     of ListModel objects, any modifications by the other thread to an object
     passed in \c message will not be reflected in the original object.
+    A ListModel can only be passed to the worker scripts of one thread; see
+    \l priority.
+
+    The optional \a transferList is an array of ArrayBuffer objects whose
+    contents are moved to the other thread instead of being copied. Once the
+    message is sent, the transferred buffers are detached and have a
+    \c byteLength of 0 in the sending thread. A SharedArrayBuffer is never
+    copied: both threads access the same memory, and can coordinate through
+    the \c Atomics functions. The same optional argument is accepted by
+    \c WorkerScript.sendMessage() in the worker script.
+
+    \code
+    var samples = new Float32Array(1024 * 1024);
+    worker.sendMessage({ samples: samples.buffer }, [ samples.buffer ]);
+    // samples.buffer.byteLength is now 0
+    \endcode
 */
 void QQuickWorkerScript::sendMessage(QQmlV4Function *args)
 {
@@ -601,10 +777,17 @@ void QQuickWorkerScript::sendMessage(QQmlV4Function *args)
 
     QV4::Scope scope(args->v4engine());
     QV4::ScopedValue argument(scope, QV4::Value::undefinedValue());
+    QV4::ScopedValue transferList(scope, QV4::Value::undefinedValue());
     if (args->length() != 0)
         argument = (*args)[0];
+    if (args->length() > 1)
+        transferList = (*args)[1];
+
+    const QByteArray data = QV4::Serialize::serialize(argument, transferList, scope.engine);
+    if (scope.engine->hasException)
+        return;
 
-    m_engine->sendMessage(m_scriptId, QV4::Serialize::serialize(argument, scope.engine));
+    m_engine->sendMessage(m_scriptId, data);
 }
 
 void QQuickWorkerScript::classBegin()
@@ -622,7 +805,7 @@ QQuickWorkerScriptEngine *QQuickWorkerScript::engine()
             return nullptr;
         }
 
-        m_engine = QQmlEnginePrivate::get(engine)->getWorkerScriptEngine();
+        m_engine = QQmlEnginePrivate::get(engine)->getWorkerScriptEngine(QThread::Priority(m_priority));
         m_scriptId = m_engine->registerWorkerScript(this);
 
         if (m_source.isValid())
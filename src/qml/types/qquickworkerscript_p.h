@@ -57,6 +57,7 @@
 #include <QtCore/qthread.h>
 #include <QtQml/qjsvalue.h>
 #include <QtCore/qurl.h>
+#include <QtCore/qvector.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -67,7 +68,9 @@ class QQuickWorkerScriptEngine : public QThread
 {
 Q_OBJECT
 public:
-    QQuickWorkerScriptEngine(QQmlEngine *parent = nullptr);
+    QQuickWorkerScriptEngine(QQmlEngine *engine = nullptr,
+                             QThread::Priority priority = QThread::LowestPriority,
+                             QObject *parent = nullptr);
     ~QQuickWorkerScriptEngine();
 
     int registerWorkerScript(QQuickWorkerScript *);
@@ -75,11 +78,39 @@ public:
     void executeUrl(int, const QUrl &);
     void sendMessage(int, const QByteArray &);
 
+    int scriptCount() const { return m_scriptCount; }
+    int pendingMessageCount() const;
+    int pendingMessageCount(int) const;
+
 protected:
     void run() override;
 
 private:
     QQuickWorkerScriptEnginePrivate *d;
+    int m_scriptCount;
+};
+
+class QQuickWorkerScriptEnginePool : public QObject
+{
+Q_OBJECT
+public:
+    QQuickWorkerScriptEnginePool(QQmlEngine *parent);
+    ~QQuickWorkerScriptEnginePool();
+
+    QQuickWorkerScriptEngine *engineForPriority(QThread::Priority priority);
+
+    int threadCount() const { return m_engines.count(); }
+    int pendingMessageCount() const;
+
+    int maximumThreadCount() const { return m_maximumThreadCount; }
+    void setMaximumThreadCount(int count) { m_maximumThreadCount = qMax(1, count); }
+
+    static int defaultMaximumThreadCount();
+
+private:
+    QQmlEngine *m_qmlEngine;
+    int m_maximumThreadCount;
+    QVector<QQuickWorkerScriptEngine *> m_engines;
 };
 
 class QQmlV4Function;
@@ -88,20 +119,38 @@ class Q_AUTOTEST_EXPORT QQuickWorkerScript : public QObject, public QQmlParserSt
 {
     Q_OBJECT
     Q_PROPERTY(QUrl source READ source WRITE setSource NOTIFY sourceChanged)
+    Q_PROPERTY(Priority priority READ priority WRITE setPriority NOTIFY priorityChanged REVISION 13)
 
     Q_INTERFACES(QQmlParserStatus)
 public:
+    enum Priority {
+        IdlePriority = QThread::IdlePriority,
+        LowestPriority = QThread::LowestPriority,
+        LowPriority = QThread::LowPriority,
+        NormalPriority = QThread::NormalPriority,
+        HighPriority = QThread::HighPriority,
+        HighestPriority = QThread::HighestPriority,
+        TimeCriticalPriority = QThread::TimeCriticalPriority
+    };
+    Q_ENUM(Priority)
+
     QQuickWorkerScript(QObject *parent = nullptr);
     ~QQuickWorkerScript();
 
     QUrl source() const;
     void setSource(const QUrl &);
 
+    Priority priority() const;
+    void setPriority(Priority priority);
+
+    Q_REVISION(13) Q_INVOKABLE int pendingMessageCount() const;
+
 public Q_SLOTS:
     void sendMessage(QQmlV4Function*);
 
 Q_SIGNALS:
     void sourceChanged();
+    Q_REVISION(13) void priorityChanged();
     void message(const QQmlV4Handle &messageObject);
 
 protected:
@@ -114,6 +163,7 @@ private:
     QQuickWorkerScriptEngine *m_engine;
     int m_scriptId;
     QUrl m_source;
+    Priority m_priority;
     bool m_componentComplete;
 };
 
@@ -4,6 +4,7 @@ SOURCES += \
     $$PWD/qqmlmodelsmodule.cpp \
     $$PWD/qqmlmodelindexvaluetype.cpp \
     $$PWD/qqmlobjectmodel.cpp \
+    $$PWD/qqmlsortfiltermodel.cpp \
     $$PWD/qquickpackage.cpp \
     $$PWD/qqmlinstantiator.cpp \
     $$PWD/qqmltableinstancemodel.cpp
@@ -14,6 +15,7 @@ HEADERS += \
     $$PWD/qqmlmodelsmodule_p.h \
     $$PWD/qqmlmodelindexvaluetype_p.h \
     $$PWD/qqmlobjectmodel_p.h \
+    $$PWD/qqmlsortfiltermodel_p.h \
     $$PWD/qquickpackage_p.h \
     $$PWD/qqmlinstantiator_p.h \
     $$PWD/qqmlinstantiator_p_p.h \
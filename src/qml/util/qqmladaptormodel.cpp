@@ -39,6 +39,8 @@
 
 #include "qqmladaptormodel_p.h"
 
+#include <QtCore/qbitarray.h>
+
 #include <private/qqmldelegatemodel_p_p.h>
 #include <private/qmetaobjectbuilder_p.h>
 #include <private/qqmlproperty_p.h>
@@ -102,6 +104,7 @@ public:
 
     virtual QVariant value(int role) const = 0;
     virtual void setValue(int role, const QVariant &value) = 0;
+    virtual void invalidateValues(const QVector<int> &roles) { Q_UNUSED(roles); }
 
     void setValue(const QString &role, const QVariant &value) override;
     bool resolveIndex(const QQmlAdaptorModel &model, int idx) override;
@@ -163,8 +166,14 @@ public:
         }
 
         QVarLengthArray<QQmlGuard<QQmlDelegateModelItem>> guardedItems;
-        for (const auto item : items)
+        for (const auto item : items) {
+            const int idx = item->modelIndex();
+            if (idx >= index && idx < index + count) {
+                // Drop cached values before any binding can read them again
+                static_cast<QQmlDMCachedModelData *>(item)->invalidateValues(roles);
+            }
             guardedItems.append(item);
+        }
 
         for (const auto &item : qAsConst(guardedItems)) {
             if (item.isNull())
@@ -385,6 +394,8 @@ QV4::ReturnedValue QQmlDMCachedModelData::set_property(const QV4::FunctionObject
 // QAbstractItemModel
 //-----------------------------------------------------------------
 
+class VDMAbstractItemModelDataType;
+
 class QQmlDMAbstractItemModelData : public QQmlDMCachedModelData
 {
     Q_OBJECT
@@ -396,6 +407,8 @@ public:
             VDMModelDelegateDataType *dataType,
             int index, int row, int column)
         : QQmlDMCachedModelData(metaType, dataType, index, row, column)
+        , fetchedValues(dataType->propertyRoles.count())
+        , values(dataType->propertyRoles.count())
     {
     }
 
@@ -411,15 +424,50 @@ public:
 
     QVariant value(int role) const override
     {
-        return type->model->aim()->index(row, column, type->model->rootIndex).data(role);
+        const int propertyId = type->propertyRoles.indexOf(role);
+        if (propertyId == -1)
+            return type->model->aim()->index(row, column, type->model->rootIndex).data(role);
+        if (!fetchedValues.testBit(propertyId))
+            const_cast<QQmlDMAbstractItemModelData *>(this)->fetchValues(propertyId);
+        return values.at(propertyId);
     }
 
     void setValue(int role, const QVariant &value) override
     {
         type->model->aim()->setData(
                 type->model->aim()->index(row, column, type->model->rootIndex), value, role);
+        invalidateValues(QVector<int>() << role);
+    }
+
+    void invalidateValues(const QVector<int> &roles) override
+    {
+        if (roles.isEmpty()) {
+            fetchedValues.fill(false);
+            return;
+        }
+        for (int propertyId = 0; propertyId < fetchedValues.size(); ++propertyId) {
+            if (roles.contains(type->propertyRoles.at(propertyId)))
+                fetchedValues.clearBit(propertyId);
+        }
+    }
+
+    void setModelIndex(int idx, int newRow, int newColumn) override
+    {
+        if (newRow != row || newColumn != column)
+            fetchedValues.fill(false);
+        QQmlDMCachedModelData::setModelIndex(idx, newRow, newColumn);
+    }
+
+    void setFetchedValue(int propertyId, const QVariant &value)
+    {
+        values[propertyId] = value;
+        fetchedValues.setBit(propertyId);
     }
 
+    bool hasFetchedValue(int propertyId) const { return fetchedValues.testBit(propertyId); }
+
+    void fetchValues(int propertyId);
+
     QV4::ReturnedValue get() override
     {
         if (type->prototype.isUndefined()) {
@@ -433,6 +481,12 @@ public:
         ++scriptRef;
         return o.asReturnedValue();
     }
+
+private:
+    // Role values read from the model, by property id, until it reports
+    // that they have changed
+    QBitArray fetchedValues;
+    QVector<QVariant> values;
 };
 
 class VDMAbstractItemModelDataType : public VDMModelDelegateDataType
@@ -440,7 +494,27 @@ class VDMAbstractItemModelDataType : public VDMModelDelegateDataType
 public:
     VDMAbstractItemModelDataType(QQmlAdaptorModel *model)
         : VDMModelDelegateDataType(model)
+        , roleDataInterface(nullptr)
+        , lastFetchedRow(-1)
+    {
+    }
+
+    bool notify(
+            const QQmlAdaptorModel &model,
+            const QList<QQmlDelegateModelItem *> &items,
+            int index,
+            int count,
+            const QVector<int> &roles) const override
     {
+        QVector<PrefetchedRow> &rows = const_cast<VDMAbstractItemModelDataType *>(this)->prefetchedRows;
+        for (auto it = rows.begin(); it != rows.end();) {
+            const int idx = model.indexAt(it->index.row(), it->index.column());
+            if (!it->index.isValid() || (idx >= index && idx < index + count))
+                it = rows.erase(it);
+            else
+                ++it;
+        }
+        return VDMModelDelegateDataType::notify(model, items, index, count, roles);
     }
 
     int rowCount(const QQmlAdaptorModel &model) const override
@@ -532,9 +606,124 @@ public:
         metaObject.reset(builder.toMetaObject());
         *static_cast<QMetaObject *>(this) = *metaObject;
         propertyCache.adopt(new QQmlPropertyCache(metaObject.data(), model.modelItemRevision));
+
+        roleDataInterface = qobject_cast<QQmlAdaptorModelRoleDataInterface *>(model.aim());
+        usedProperties.resize(propertyRoles.count());
     }
+
+    void fetchValues(QQmlDMAbstractItemModelData *item, int propertyId);
+
+    // Role values fetched in a batch for rows that had no item yet
+    struct PrefetchedRow
+    {
+        QPersistentModelIndex index;
+        QBitArray fetched;
+        QVector<QVariant> values;
+    };
+
+    // How many rows to fetch at once through QQmlAdaptorModelRoleDataInterface
+    static const int RoleDataBatchSize = 16;
+
+    QQmlAdaptorModelRoleDataInterface *roleDataInterface;
+    QBitArray usedProperties;   // Properties that have been read by any delegate
+    QVector<PrefetchedRow> prefetchedRows;
+    int lastFetchedRow;
 };
 
+void QQmlDMAbstractItemModelData::fetchValues(int propertyId)
+{
+    static_cast<VDMAbstractItemModelDataType *>(type)->fetchValues(this, propertyId);
+}
+
+/*
+    Reads the value of \a propertyId for \a item into its cache.
+
+    Without QQmlAdaptorModelRoleDataInterface, this is a single call to
+    data().  With it, one call fetches every role that delegates have used
+    so far, for this row and the next rows in the direction the view is
+    moving, so that the delegates created for them need no further calls.
+*/
+void VDMAbstractItemModelDataType::fetchValues(QQmlDMAbstractItemModelData *item, int propertyId)
+{
+    const QAbstractItemModel *aim = model->aim();
+    const int row = item->modelRow();
+    const int column = item->modelColumn();
+    usedProperties.setBit(propertyId);
+
+    if (!roleDataInterface) {
+        item->setFetchedValue(propertyId, aim->index(row, column, model->rootIndex).data(propertyRoles.at(propertyId)));
+        return;
+    }
+
+    for (auto it = prefetchedRows.begin(); it != prefetchedRows.end(); ++it) {
+        if (it->index.row() == row && it->index.column() == column && it->index.parent() == model->rootIndex) {
+            for (int i = 0; i < it->fetched.size(); ++i) {
+                if (it->fetched.testBit(i) && !item->hasFetchedValue(i))
+                    item->setFetchedValue(i, it->values.at(i));
+            }
+            prefetchedRows.erase(it);
+            break;
+        }
+    }
+    if (item->hasFetchedValue(propertyId))
+        return;
+
+    QVector<int> propertyIds;
+    QVector<int> roles;
+    for (int i = 0; i < usedProperties.size(); ++i) {
+        if (usedProperties.testBit(i) && !item->hasFetchedValue(i)) {
+            propertyIds.append(i);
+            roles.append(propertyRoles.at(i));
+        }
+    }
+
+    int first = row;
+    int last = row;
+    if (row < lastFetchedRow)
+        first = qMax(0, row - RoleDataBatchSize + 1);
+    else
+        last = qMin(aim->rowCount(model->rootIndex) - 1, row + RoleDataBatchSize - 1);
+    lastFetchedRow = row;
+
+    const QVector<QVariant> data = roleDataInterface->roleData(model->rootIndex, column, first, last, roles);
+    if (data.count() != (last - first + 1) * roles.count()) {
+        item->setFetchedValue(propertyId, aim->index(row, column, model->rootIndex).data(propertyRoles.at(propertyId)));
+        return;
+    }
+
+    // Keep what was fetched earlier for the rows in this batch, since it may
+    // hold roles that were not requested this time, and drop the rest
+    QVector<PrefetchedRow> rows;
+    for (int r = first; r <= last; ++r) {
+        const QVariant *rowData = data.constData() + (r - first) * roles.count();
+        if (r == row) {
+            for (int i = 0; i < propertyIds.count(); ++i)
+                item->setFetchedValue(propertyIds.at(i), rowData[i]);
+            continue;
+        }
+
+        PrefetchedRow prefetched;
+        for (auto it = prefetchedRows.begin(); it != prefetchedRows.end(); ++it) {
+            if (it->index.row() == r && it->index.column() == column && it->index.parent() == model->rootIndex) {
+                prefetched = *it;
+                prefetchedRows.erase(it);
+                break;
+            }
+        }
+        if (!prefetched.index.isValid()) {
+            prefetched.index = aim->index(r, column, model->rootIndex);
+            prefetched.fetched.resize(propertyRoles.count());
+            prefetched.values.resize(propertyRoles.count());
+        }
+        for (int i = 0; i < propertyIds.count(); ++i) {
+            prefetched.fetched.setBit(propertyIds.at(i));
+            prefetched.values[propertyIds.at(i)] = rowData[i];
+        }
+        rows.append(prefetched);
+    }
+    prefetchedRows = rows;
+}
+
 //-----------------------------------------------------------------
 // QQmlListAccessor
 //-----------------------------------------------------------------
@@ -174,6 +174,29 @@ public:
 
 Q_DECLARE_INTERFACE(QQmlAdaptorModelProxyInterface, QQmlAdaptorModelProxyInterface_iid)
 
+/*
+    Models for which each call to data() is expensive, such as ones backed by
+    a database or a remote cache, can implement this interface alongside
+    QAbstractItemModel to have delegates' role values fetched in batches.
+
+    roleData() returns the values of \a roles for each of the rows \a first
+    to \a last, inclusive, in \a column under \a parent.  The values are
+    ordered by row, then by role, so there are roles.count() values per row.
+    A result of any other length is ignored, and data() is used instead.
+*/
+class QQmlAdaptorModelRoleDataInterface
+{
+public:
+    virtual ~QQmlAdaptorModelRoleDataInterface() {}
+
+    virtual QVector<QVariant> roleData(
+            const QModelIndex &parent, int column, int first, int last, const QVector<int> &roles) const = 0;
+};
+
+#define QQmlAdaptorModelRoleDataInterface_iid "org.qt-project.Qt.QQmlAdaptorModelRoleDataInterface"
+
+Q_DECLARE_INTERFACE(QQmlAdaptorModelRoleDataInterface, QQmlAdaptorModelRoleDataInterface_iid)
+
 QT_END_NAMESPACE
 
 #endif
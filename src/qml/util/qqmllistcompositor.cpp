@@ -92,12 +92,14 @@ QT_BEGIN_NAMESPACE
     Internally the index mapping is stored as a list of Range objects, each has a list identifier,
     a start index, a count, and a set of flags which represent group membership and some other
     properties.  The group index of a range is the sum of all preceding ranges that are members of
-    that group.  To avoid the inefficiency of iterating over potentially all ranges when looking
-    for a specific index, each time a lookup is done the range and its indexes are cached and the
-    next lookup is done relative to this.   This works out to near constant time in most relevant
-    use cases because successive index lookups are most frequently adjacent.  The total number of
-    ranges is often quite small, which helps as well. If there is a need for faster random access
-    then a skip list like index may be an appropriate addition.
+    that group.  Each time a lookup is done the range and its indexes are cached, and a following
+    lookup of an index within the same range is done relative to this.  Other lookups descend a
+    balanced tree (a treap) threaded through the ranges in list order, where every range holds
+    the number of items per group in its subtree, so finding the range at a group index takes
+    O(log n) time regardless of the number of ranges.  The functions that edit ranges around an
+    iterator keep the tree up to date as they go.  The functions that process changes to a source
+    list visit every range anyway, so they instead discard the tree and it is rebuilt in linear
+    time on the next lookup that needs it.
 
     \sa DelegateModel
 */
@@ -291,6 +293,9 @@ QQmlListCompositor::QQmlListCompositor()
     , m_defaultFlags(PrependFlag | DefaultFlag)
     , m_removeFlags(AppendFlag | PrependFlag | GroupMask)
     , m_moveId(0)
+    , m_root(nullptr)
+    , m_seed(0x9e3779b9)
+    , m_treeValid(true)
 {
 }
 
@@ -314,7 +319,15 @@ QQmlListCompositor::~QQmlListCompositor()
 inline QQmlListCompositor::Range *QQmlListCompositor::insert(
         Range *before, void *list, int index, int count, uint flags)
 {
-    return new Range(before, list, index, count, flags);
+    Range *range = new Range(before, list, index, count, flags);
+    // xorshift32, the priorities only need to be well distributed to keep the tree balanced.
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+    range->priority = m_seed;
+    if (m_treeValid)
+        treeInsert(range);
+    return range;
 }
 
 /*!
@@ -326,6 +339,8 @@ inline QQmlListCompositor::Range *QQmlListCompositor::insert(
 inline QQmlListCompositor::Range *QQmlListCompositor::erase(
         Range *range)
 {
+    if (m_treeValid)
+        treeErase(range);
     Range *next = range->next;
     next->previous = range->previous;
     next->previous->next = range->next;
@@ -333,6 +348,200 @@ inline QQmlListCompositor::Range *QQmlListCompositor::erase(
     return next;
 }
 
+/*!
+    Recalculates the subtree counts of \a range from its own count and those of its children.
+*/
+
+inline void QQmlListCompositor::treeUpdateCounts(Range *range)
+{
+    for (int i = 0; i < m_groupCount; ++i) {
+        range->subtreeCounts[i] = (range->inGroup(i) ? range->count : 0)
+                + (range->left ? range->left->subtreeCounts[i] : 0)
+                + (range->right ? range->right->subtreeCounts[i] : 0);
+    }
+}
+
+/*!
+    Updates the subtree counts of the tree after the count or flags of \a range changed.
+*/
+
+inline void QQmlListCompositor::treeUpdate(Range *range)
+{
+    if (!m_treeValid)
+        return;
+    for (; range; range = range->parent)
+        treeUpdateCounts(range);
+}
+
+/*!
+    Rotates \a range into the position of its parent.
+*/
+
+void QQmlListCompositor::treeRotate(Range *range)
+{
+    Range *parent = range->parent;
+    Range *grandParent = parent->parent;
+
+    if (parent->left == range) {
+        parent->left = range->right;
+        if (range->right)
+            range->right->parent = parent;
+        range->right = parent;
+    } else {
+        parent->right = range->left;
+        if (range->left)
+            range->left->parent = parent;
+        range->left = parent;
+    }
+    parent->parent = range;
+    range->parent = grandParent;
+
+    if (!grandParent)
+        m_root = range;
+    else if (grandParent->left == parent)
+        grandParent->left = range;
+    else
+        grandParent->right = range;
+
+    treeUpdateCounts(parent);
+    treeUpdateCounts(range);
+}
+
+/*!
+    Adds a \a range that has just been linked into the list of ranges to the tree.
+*/
+
+void QQmlListCompositor::treeInsert(Range *range)
+{
+    range->left = nullptr;
+    range->right = nullptr;
+
+    // Either the next range has no left child, or the previous range is the rightmost node of
+    // that left subtree and has no right child.
+    if (!m_root) {
+        range->parent = nullptr;
+        m_root = range;
+    } else if (range->next != &m_ranges && !range->next->left) {
+        range->parent = range->next;
+        range->next->left = range;
+    } else {
+        range->parent = range->previous;
+        range->previous->right = range;
+    }
+    treeUpdate(range);
+
+    while (range->parent && range->parent->priority < range->priority)
+        treeRotate(range);
+}
+
+/*!
+    Removes a \a range from the tree, it is still linked into the list of ranges.
+*/
+
+void QQmlListCompositor::treeErase(Range *range)
+{
+    while (range->left && range->right)
+        treeRotate(range->left->priority > range->right->priority ? range->left : range->right);
+
+    Range *child = range->left ? range->left : range->right;
+    Range *parent = range->parent;
+    if (child)
+        child->parent = parent;
+    if (!parent)
+        m_root = child;
+    else if (parent->left == range)
+        parent->left = child;
+    else
+        parent->right = child;
+
+    treeUpdate(parent);
+}
+
+/*!
+    Builds the tree from the list of ranges in linear time.
+*/
+
+void QQmlListCompositor::treeRebuild()
+{
+    // The ranges are visited in order, so the tree is a cartesian tree of their priorities and
+    // the stack holds its right spine.
+    QVarLengthArray<Range *, 64> spine;
+    for (Range *range = m_ranges.next; range != &m_ranges; range = range->next) {
+        Range *left = nullptr;
+        while (!spine.isEmpty() && spine.last()->priority < range->priority) {
+            left = spine.last();
+            spine.removeLast();
+            treeUpdateCounts(left);
+        }
+        range->parent = spine.isEmpty() ? nullptr : spine.last();
+        range->left = left;
+        range->right = nullptr;
+        if (left)
+            left->parent = range;
+        if (range->parent)
+            range->parent->right = range;
+        spine.append(range);
+    }
+    m_root = spine.isEmpty() ? nullptr : spine.first();
+    while (!spine.isEmpty()) {
+        treeUpdateCounts(spine.last());
+        spine.removeLast();
+    }
+    m_treeValid = true;
+}
+
+/*!
+    Returns an iterator representing the item at \a index in a \a group, or the end of the
+    compositor if \a index is equal to count(group).
+
+    The iterator is resolved the same way as when advancing an iterator to that index, which is
+    at the first range in \a group with items at or after \a index.
+*/
+
+QQmlListCompositor::iterator QQmlListCompositor::treeFind(Group group, int index)
+{
+    if (!m_treeValid)
+        treeRebuild();
+
+    iterator it(&m_ranges, 0, group, m_groupCount);
+    for (Range *range = m_root; range;) {
+        if (Range *left = range->left) {
+            if (index < left->subtreeCounts[group]) {
+                range = left;
+                continue;
+            }
+            index -= left->subtreeCounts[group];
+            for (int i = 0; i < m_groupCount; ++i)
+                it.index[i] += left->subtreeCounts[i];
+        }
+        if (range->inGroup(group)) {
+            if (index < range->count) {
+                it.range = range;
+                it.offset = index;
+                it.incrementIndexes(index);
+                return it;
+            }
+            index -= range->count;
+        }
+        it.incrementIndexes(range->count, range->flags);
+        range = range->right;
+    }
+    return it;
+}
+
+/*!
+    Returns true if the item at \a index in a \a group is in the range of the cached iterator,
+    in which case it can be found by adjusting the offset of that iterator.
+*/
+
+inline bool QQmlListCompositor::isCached(Group group, int index) const
+{
+    if (m_cacheIt == m_end || !m_cacheIt->inGroup(group))
+        return false;
+    const int start = m_cacheIt.index[group] - m_cacheIt.offset;
+    return index >= start && index < start + m_cacheIt->count;
+}
+
 /*!
     Sets the number (\a count) of possible groups that items may belong to in a compositor.
 */
@@ -342,6 +551,7 @@ void QQmlListCompositor::setGroupCount(int count)
     m_groupCount = count;
     m_end = iterator(&m_ranges, 0, Default, m_groupCount);
     m_cacheIt = m_end;
+    treeInvalidate();
 }
 
 /*!
@@ -363,13 +573,13 @@ QQmlListCompositor::iterator QQmlListCompositor::find(Group group, int index)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< group << index)
     Q_ASSERT(index >=0 && index < count(group));
-    if (m_cacheIt == m_end) {
-        m_cacheIt = iterator(m_ranges.next, 0, group, m_groupCount);
-        m_cacheIt += index;
-    } else {
-        const int offset = index - m_cacheIt.index[group];
+    if (isCached(group, index)) {
         m_cacheIt.setGroup(group);
-        m_cacheIt += offset;
+        m_cacheIt.decrementIndexes(m_cacheIt.offset);
+        m_cacheIt.offset = index - m_cacheIt.index[group];
+        m_cacheIt.incrementIndexes(m_cacheIt.offset);
+    } else {
+        m_cacheIt = treeFind(group, index);
     }
     Q_ASSERT(m_cacheIt.index[group] == index);
     Q_ASSERT(m_cacheIt->inGroup(group));
@@ -405,14 +615,20 @@ QQmlListCompositor::insert_iterator QQmlListCompositor::findInsertPosition(Group
     QT_QML_TRACE_LISTCOMPOSITOR(<< group << index)
     Q_ASSERT(index >=0 && index <= count(group));
     insert_iterator it;
-    if (m_cacheIt == m_end) {
-        it = iterator(m_ranges.next, 0, group, m_groupCount);
-        it += index;
-    } else {
-        const int offset = index - m_cacheIt.index[group];
+    if (isCached(group, index)) {
         it = m_cacheIt;
         it.setGroup(group);
-        it += offset;
+        it.decrementIndexes(it.offset);
+        it.offset = index - it.index[group];
+        it.incrementIndexes(it.offset);
+    } else {
+        it = treeFind(group, index);
+    }
+
+    // Resolve the position the same way as insert_iterator::operator +=().
+    if (it.offset == 0 && it->previous->append()) {
+        it.range = it->previous;
+        it.offset = it->inGroup() ? it->count : 0;
     }
     Q_ASSERT(it.index[group] == index);
     return it;
@@ -470,6 +686,7 @@ QQmlListCompositor::iterator QQmlListCompositor::insert(
                 *before, before->list, before->index, before.offset, before->flags & ~AppendFlag)->next;
         before->index += before.offset;
         before->count -= before.offset;
+        treeUpdate(*before);
         before.offset = 0;
     }
 
@@ -481,6 +698,7 @@ QQmlListCompositor::iterator QQmlListCompositor::insert(
         // The insert arguments represent a continuation of the previous range so increment
         // its count instead of inserting a new range.
         before->previous->count += count;
+        treeUpdate(before->previous);
         before.incrementIndexes(count, flags);
     } else {
         *before = insert(*before, list, index, count, flags);
@@ -494,6 +712,7 @@ QQmlListCompositor::iterator QQmlListCompositor::insert(
         // The current range and the next are continuous so add their counts and delete one.
         before->next->index = before->index;
         before->next->count += before->count;
+        treeUpdate(before->next);
         *before = erase(*before);
     }
 
@@ -541,6 +760,7 @@ void QQmlListCompositor::setFlags(
         *from = insert(*from, from->list, from->index, from.offset, from->flags & ~AppendFlag)->next;
         from->index += from.offset;
         from->count -= from.offset;
+        treeUpdate(*from);
         from.offset = 0;
     }
 
@@ -571,6 +791,8 @@ void QQmlListCompositor::setFlags(
             from->previous->count += difference;
             from->index += difference;
             from->count -= difference;
+            treeUpdate(from->previous);
+            treeUpdate(*from);
             if (from->count == 0) {
                 // Delete the current range if it is now empty, preserving the append flag
                 // in the previous range.
@@ -591,9 +813,11 @@ void QQmlListCompositor::setFlags(
             *from = insert(*from, from->list, from->index, difference, setFlags)->next;
             from->index += difference;
             from->count -= difference;
+            treeUpdate(*from);
         } else {
             // The whole range is affected so simply update the flags.
             from->flags |= flags;
+            treeUpdate(*from);
             continue;
         }
         from.incrementIndexes(from->count);
@@ -607,6 +831,7 @@ void QQmlListCompositor::setFlags(
         from.offset = from->previous->count;
         from->previous->count += from->count;
         from->previous->flags = from->flags;
+        treeUpdate(from->previous);
         *from = erase(*from)->previous;
     }
     m_cacheIt = from;
@@ -653,6 +878,7 @@ void QQmlListCompositor::clearFlags(
         *from = insert(*from, from->list, from->index, from.offset, from->flags & ~AppendFlag)->next;
         from->index += from.offset;
         from->count -= from.offset;
+        treeUpdate(*from);
         from.offset = 0;
     }
 
@@ -689,6 +915,8 @@ void QQmlListCompositor::clearFlags(
             from->previous->count += difference;
             from->index += difference;
             from->count -= difference;
+            treeUpdate(from->previous);
+            treeUpdate(*from);
             if (from->count == 0) {
                 // Delete the current range if it is now empty, preserving the append flag
                 if (from->append())
@@ -704,10 +932,12 @@ void QQmlListCompositor::clearFlags(
                 *from = insert(*from, from->list, from->index, difference, clearedFlags)->next;
             from->index += difference;
             from->count -= difference;
+            treeUpdate(*from);
             from.incrementIndexes(from->count);
         } else if (clearedFlags) {
             // The whole range is affected so simply update the flags.
             from->flags &= ~flags;
+            treeUpdate(*from);
         } else {
             // All flags have been removed from the range so remove it.
             *from = erase(*from)->previous;
@@ -722,6 +952,7 @@ void QQmlListCompositor::clearFlags(
         from.offset = from->previous->count;
         from->previous->count += from->count;
         from->previous->flags = from->flags;
+        treeUpdate(from->previous);
         *from = erase(*from)->previous;
     }
     m_cacheIt = from;
@@ -795,6 +1026,7 @@ void QQmlListCompositor::move(
                 *fromIt, fromIt->list, fromIt->index, fromIt.offset, fromIt->flags & ~AppendFlag)->next;
         fromIt->index += fromIt.offset;
         fromIt->count -= fromIt.offset;
+        treeUpdate(*fromIt);
         fromIt.offset = 0;
     }
 
@@ -821,6 +1053,7 @@ void QQmlListCompositor::move(
             removes->append(Remove(fromIt, difference, fromIt->flags, ++moveId));
         count -= difference;
         fromIt->count -= difference;
+        treeUpdate(*fromIt);
 
         // If the existing range contains the prepend flag replace the removed items with
         // a placeholder range for new items inserted into the source model.
@@ -832,6 +1065,7 @@ void QQmlListCompositor::move(
                 && fromIt->previous->end() == fromIt->index) {
             // Grow the previous range instead of creating a new one if possible.
             fromIt->previous->count += difference;
+            treeUpdate(fromIt->previous);
         } else if (fromIt->prepend()) {
             *fromIt = insert(*fromIt, fromIt->list, removeIndex, difference, PrependFlag)->next;
         }
@@ -851,6 +1085,7 @@ void QQmlListCompositor::move(
                     && fromIt->previous->end() == fromIt->index) {
                 fromIt.incrementIndexes(fromIt->count);
                 fromIt->previous->count += fromIt->count;
+                treeUpdate(fromIt->previous);
                 *fromIt = erase(*fromIt);
             }
         } else if (count > 0) {
@@ -869,15 +1104,13 @@ void QQmlListCompositor::move(
         fromIt.offset = fromIt->previous->count;
         fromIt->previous->count += fromIt->count;
         fromIt->previous->flags = fromIt->flags;
+        treeUpdate(fromIt->previous);
         *fromIt = erase(*fromIt)->previous;
     }
 
     // Find the destination position of the move.
-    insert_iterator toIt = fromIt;
-    toIt.setGroup(toGroup);
-
-    const int difference = to - toIt.index[toGroup];
-    toIt += difference;
+    m_cacheIt = fromIt;
+    insert_iterator toIt = findInsertPosition(toGroup, to);
 
     // If the insert position is part way through a range; split it and move the iterator to the
     // start of the second range.
@@ -885,6 +1118,7 @@ void QQmlListCompositor::move(
         *toIt = insert(*toIt, toIt->list, toIt->index, toIt.offset, toIt->flags & ~AppendFlag)->next;
         toIt->index += toIt.offset;
         toIt->count -= toIt.offset;
+        treeUpdate(*toIt);
         toIt.offset = 0;
     }
 
@@ -897,6 +1131,7 @@ void QQmlListCompositor::move(
                 && range->flags == (toIt->flags & ~AppendFlag)) {
             toIt->index -= range->count;
             toIt->count += range->count;
+            treeUpdate(*toIt);
         } else {
             *toIt = insert(*toIt, range->list, range->index, range->count, range->flags);
         }
@@ -909,6 +1144,7 @@ void QQmlListCompositor::move(
         toIt.offset = toIt->previous->count;
         toIt->previous->count += toIt->count;
         toIt->previous->flags = toIt->flags;
+        treeUpdate(toIt->previous);
         *toIt = erase(*toIt)->previous;
     }
     // Create insert notification for the ranges moved.
@@ -941,6 +1177,7 @@ void QQmlListCompositor::move(
 void QQmlListCompositor::clear()
 {
     QT_QML_TRACE_LISTCOMPOSITOR("")
+    treeInvalidate();
     for (Range *range = m_ranges.next; range != &m_ranges; range = erase(range)) {}
     m_end = iterator(m_ranges.next, 0, Default, m_groupCount);
     m_cacheIt = m_end;
@@ -953,6 +1190,8 @@ void QQmlListCompositor::listItemsInserted(
         const QVector<MovedFlags> *movedFlags)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< list << insertions)
+    // Every range is visited, so rebuild the tree on the next lookup rather than maintain it.
+    treeInvalidate();
     for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges; *it = it->next) {
         if (it->list != list || it->flags == CacheFlag) {
             // Skip ranges that don't reference list.
@@ -1077,6 +1316,8 @@ void QQmlListCompositor::listItemsRemoved(
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< list << *removals)
 
+    // Every range is visited, so rebuild the tree on the next lookup rather than maintain it.
+    treeInvalidate();
     for (iterator it(m_ranges.next, 0, Default, m_groupCount); *it != &m_ranges; *it = it->next) {
         if (it->list != list || it->flags == CacheFlag) {
             // Skip ranges that don't reference list.
@@ -99,6 +99,13 @@ public:
         int count = 0;
         uint flags = 0;
 
+        // Position in the tree indexing ranges by group position; see find().
+        Range *parent = nullptr;
+        Range *left = nullptr;
+        Range *right = nullptr;
+        uint priority = 0;
+        int subtreeCounts[MaximumGroupCount];
+
         inline int start() const { return index; }
         inline int end() const { return index + count; }
 
@@ -272,10 +279,23 @@ private:
     int m_defaultFlags;
     int m_removeFlags;
     int m_moveId;
+    Range *m_root;
+    uint m_seed;
+    bool m_treeValid;
 
     inline Range *insert(Range *before, void *list, int index, int count, uint flags);
     inline Range *erase(Range *range);
 
+    void treeInsert(Range *range);
+    void treeErase(Range *range);
+    void treeRotate(Range *range);
+    inline void treeUpdateCounts(Range *range);
+    inline void treeUpdate(Range *range);
+    void treeInvalidate() { m_treeValid = false; m_root = nullptr; }
+    void treeRebuild();
+    iterator treeFind(Group group, int index);
+    inline bool isCached(Group group, int index) const;
+
     struct MovedFlags
     {
         MovedFlags() {}
@@ -288,6 +288,20 @@ qreal QQuickFlickablePrivate::overShootDistance(qreal size) const
     return qMin(qreal(QML_FLICK_OVERSHOOT), size/3);
 }
 
+/*
+    Returns how far the content is expected to move along the axis of \a data
+    within the next \a msecs, signed like the velocity.  A flick is not
+    followed beyond the point where it comes to rest.
+*/
+qreal QQuickFlickablePrivate::predictedMovement(const AxisData &data, int msecs) const
+{
+    const qreal velocity = data.smoothVelocity.value();
+    qreal distance = qAbs(velocity) * msecs / 1000;
+    if (data.flicking && deceleration > 0)
+        distance = qMin(distance, velocity * velocity / (2 * deceleration));
+    return velocity < 0 ? -distance : distance;
+}
+
 void QQuickFlickablePrivate::AxisData::addVelocitySample(qreal v, qreal maxVelocity)
 {
     if (v > maxVelocity)
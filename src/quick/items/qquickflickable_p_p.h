@@ -69,6 +69,9 @@ QT_BEGIN_NAMESPACE
 // Really slow flicks can be annoying.
 const qreal MinimumFlickVelocity = 75.0;
 
+// How far ahead, in ms of movement, views prefetch delegates
+const int DelegatePrefetchInterval = 300;
+
 class QQuickFlickableVisibleArea;
 class QQuickTransition;
 class QQuickFlickableReboundTransition;
@@ -196,6 +199,7 @@ public:
     void setViewportY(qreal y);
 
     qreal overShootDistance(qreal size) const;
+    qreal predictedMovement(const AxisData &data, int msecs) const;
 
     void itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &) override;
 
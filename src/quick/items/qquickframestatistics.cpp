@@ -0,0 +1,211 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qquickframestatistics_p.h"
+
+#include <QtCore/qmath.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QQuickFrameStatistics
+    \brief Keeps timings and counters of the most recent frames of a window.
+
+    The render loops fill in one QQuickFrameRecord per frame. The polish and
+    animation times are recorded on the gui thread, the sync, render and swap
+    times and the renderer counters on the render thread, which finishes the
+    frame and adds it to a ring buffer of \c capacity frames.
+
+    With the threaded render loop, animations are advanced after the sync, so
+    a frame reports the animation tick of the previous frame.
+
+    The recorded frames and percentiles of their timings can be read from any
+    thread, which allows exporting frame pacing telemetry without the QML
+    profiler. The statistics are enabled per window with
+    QQuickWindow::enableFrameStatistics(), or for all windows with the
+    \c QSG_FRAME_STATISTICS environment variable, set to the number of frames
+    to keep.
+*/
+
+QQuickFrameStatistics::QQuickFrameStatistics(int capacity, qreal refreshRate)
+    : m_capacity(capacity > 0 ? capacity : 300)
+    , m_refreshInterval(qint64(1000000000 / (refreshRate > 0 ? refreshRate : 60)))
+{
+    m_frames.reserve(m_capacity);
+    m_clock.start();
+}
+
+void QQuickFrameStatistics::recordPolish(qint64 polishTime)
+{
+    QMutexLocker lock(&m_mutex);
+    m_polishTime = polishTime;
+}
+
+void QQuickFrameStatistics::recordAnimations(qint64 animationTime, bool running)
+{
+    QMutexLocker lock(&m_mutex);
+    m_animationTime = animationTime;
+    m_animating = running;
+}
+
+void QQuickFrameStatistics::recordRenderCounters(int batches, int uploadedBatches, qint64 uploadedBufferBytes,
+                                                 qint64 uploadedTextureBytes)
+{
+    m_current.batches = batches;
+    m_current.uploadedBatches = uploadedBatches;
+    m_current.uploadedBufferBytes = uploadedBufferBytes;
+    m_current.uploadedTextureBytes = uploadedTextureBytes;
+}
+
+void QQuickFrameStatistics::finishFrame(qint64 syncTime, qint64 renderTime, qint64 swapTime)
+{
+    const qint64 now = m_clock.nsecsElapsed();
+
+    QQuickFrameRecord frame = m_current;
+    m_current = QQuickFrameRecord();
+    frame.timestamp = now / 1000000;
+    frame.interval = m_lastFrameEnd < 0 ? 0 : now - m_lastFrameEnd;
+    frame.syncTime = syncTime;
+    frame.renderTime = renderTime;
+    frame.swapTime = swapTime;
+    m_lastFrameEnd = now;
+
+    QMutexLocker lock(&m_mutex);
+    frame.polishTime = m_polishTime;
+    frame.animationTime = m_animationTime;
+    // Idle gaps between frames are not missed frames, only count them while animating
+    frame.missed = m_animating && frame.interval > m_refreshInterval * 3 / 2;
+    m_polishTime = 0;
+
+    if (m_frames.size() < m_capacity)
+        m_frames.append(frame);
+    else
+        m_frames[m_next] = frame;
+    m_next = (m_next + 1) % m_capacity;
+}
+
+/*!
+    \internal
+    Returns the recorded frames, oldest first.
+*/
+QVector<QQuickFrameRecord> QQuickFrameStatistics::frames() const
+{
+    QMutexLocker lock(&m_mutex);
+    if (m_frames.size() < m_capacity)
+        return m_frames;
+
+    QVector<QQuickFrameRecord> ordered;
+    ordered.reserve(m_frames.size());
+    for (int i = 0; i < m_frames.size(); ++i)
+        ordered.append(m_frames.at((m_next + i) % m_frames.size()));
+    return ordered;
+}
+
+qint64 QQuickFrameStatistics::value(const QQuickFrameRecord &frame, Measure measure)
+{
+    switch (measure) {
+    case PolishTime:
+        return frame.polishTime;
+    case AnimationTime:
+        return frame.animationTime;
+    case SyncTime:
+        return frame.syncTime;
+    case RenderTime:
+        return frame.renderTime;
+    case SwapTime:
+        return frame.swapTime;
+    case FrameInterval:
+        return frame.interval;
+    }
+    return 0;
+}
+
+/*!
+    \internal
+    Returns the \a percent percentile of \a measure over the recorded frames,
+    in nanoseconds, using the nearest rank. The 50th percentile is the median
+    and the 100th the maximum. Returns 0 when no frames were recorded.
+*/
+qint64 QQuickFrameStatistics::percentile(Measure measure, qreal percent) const
+{
+    QVarLengthArray<qint64, 300> values;
+    {
+        QMutexLocker lock(&m_mutex);
+        values.reserve(m_frames.size());
+        for (const QQuickFrameRecord &frame : m_frames) {
+            // The first frame has no interval
+            if (measure == FrameInterval && frame.interval == 0)
+                continue;
+            values.append(value(frame, measure));
+        }
+    }
+    if (values.isEmpty())
+        return 0;
+
+    const int rank = qBound(1, qCeil(qBound(qreal(0), percent, qreal(100)) / 100 * values.size()), values.size());
+    std::nth_element(values.begin(), values.begin() + rank - 1, values.end());
+    return values.at(rank - 1);
+}
+
+int QQuickFrameStatistics::frameCount() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_frames.size();
+}
+
+int QQuickFrameStatistics::missedFrameCount() const
+{
+    QMutexLocker lock(&m_mutex);
+    return int(std::count_if(m_frames.cbegin(), m_frames.cend(),
+                             [](const QQuickFrameRecord &frame) { return frame.missed; }));
+}
+
+void QQuickFrameStatistics::reset()
+{
+    QMutexLocker lock(&m_mutex);
+    m_frames.clear();
+    m_next = 0;
+}
+
+QT_END_NAMESPACE
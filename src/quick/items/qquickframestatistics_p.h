@@ -0,0 +1,134 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QQUICKFRAMESTATISTICS_P_H
+#define QQUICKFRAMESTATISTICS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qtquickglobal_p.h>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+struct QQuickFrameRecord
+{
+    qint64 timestamp = 0;           // msecs since the statistics were created, when the frame was finished
+    qint64 interval = 0;            // nsecs since the previous frame was finished
+    qint64 polishTime = 0;          // nsecs
+    qint64 animationTime = 0;       // nsecs, of the latest animation tick on the gui thread
+    qint64 syncTime = 0;            // nsecs
+    qint64 renderTime = 0;          // nsecs
+    qint64 swapTime = 0;            // nsecs
+    int batches = 0;
+    int uploadedBatches = 0;
+    qint64 uploadedBufferBytes = 0;
+    qint64 uploadedTextureBytes = 0;
+    bool missed = false;            // animating, and later than 1.5 refresh intervals
+};
+
+class Q_QUICK_PRIVATE_EXPORT QQuickFrameStatistics
+{
+public:
+    enum Measure {
+        PolishTime,
+        AnimationTime,
+        SyncTime,
+        RenderTime,
+        SwapTime,
+        FrameInterval
+    };
+
+    explicit QQuickFrameStatistics(int capacity = 0, qreal refreshRate = 60);
+
+    int capacity() const { return m_capacity; }
+
+    // Called on the gui thread
+    void recordPolish(qint64 polishTime);
+    void recordAnimations(qint64 animationTime, bool running);
+
+    // Called on the render thread
+    void recordRenderCounters(int batches, int uploadedBatches, qint64 uploadedBufferBytes,
+                              qint64 uploadedTextureBytes);
+    void finishFrame(qint64 syncTime, qint64 renderTime, qint64 swapTime);
+
+    // Thread safe
+    QVector<QQuickFrameRecord> frames() const;
+    qint64 percentile(Measure measure, qreal percent) const;
+    int frameCount() const;
+    int missedFrameCount() const;
+    void reset();
+
+    static qint64 value(const QQuickFrameRecord &frame, Measure measure);
+
+private:
+    const int m_capacity;
+    const qint64 m_refreshInterval;
+
+    // written by the gui thread
+    qint64 m_polishTime = 0;
+    qint64 m_animationTime = 0;
+    bool m_animating = false;
+
+    // written by the render thread
+    QQuickFrameRecord m_current;
+    QElapsedTimer m_clock;
+    qint64 m_lastFrameEnd = -1;
+
+    mutable QMutex m_mutex;
+    QVector<QQuickFrameRecord> m_frames;
+    int m_next = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKFRAMESTATISTICS_P_H
@@ -182,10 +182,11 @@ public:
     bool addVisibleItems(qreal fillFrom, qreal fillTo, qreal bufferFrom, qreal bufferTo, bool doBuffer) override;
     bool removeNonVisibleItems(qreal bufferFrom, qreal bufferTo) override;
 
-    void removeItem(FxViewItem *item);
+    void removeItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable);
 
     FxViewItem *newViewItem(int index, QQuickItem *item) override;
     void initializeViewItem(FxViewItem *item) override;
+    QQuickItemViewAttached *getAttachedObject(const QObject *object) const override;
     void repositionItemAt(FxViewItem *item, int index, qreal sizeBuffer) override;
     void repositionPackageItemAt(QQuickItem *item, int index) override;
     void resetFirstItemPosition(qreal pos = 0.0) override;
@@ -474,6 +475,12 @@ void QQuickGridViewPrivate::initializeViewItem(FxViewItem *item)
     item->trackGeometry(true);
 }
 
+QQuickItemViewAttached *QQuickGridViewPrivate::getAttachedObject(const QObject *object) const
+{
+    QObject *attachedObject = qmlAttachedPropertiesObject<QQuickGridView>(object, false);
+    return static_cast<QQuickItemViewAttached *>(attachedObject);
+}
+
 bool QQuickGridViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal bufferFrom, qreal bufferTo, bool doBuffer)
 {
     qreal colPos = colPosAt(visibleIndex);
@@ -569,14 +576,14 @@ bool QQuickGridViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
     return changed;
 }
 
-void QQuickGridViewPrivate::removeItem(FxViewItem *item)
+void QQuickGridViewPrivate::removeItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     if (item->transitionScheduledOrRunning()) {
         qCDebug(lcItemViewDelegateLifecycle) << "\tnot releasing animating item:" << item->index << item->item->objectName();
         item->releaseAfterTransition = true;
         releasePendingTransition.append(item);
     } else {
-        releaseItem(item);
+        releaseItem(item, reusableFlag);
     }
 }
 
@@ -594,7 +601,7 @@ bool QQuickGridViewPrivate::removeNonVisibleItems(qreal bufferFrom, qreal buffer
         if (item->index != -1)
             visibleIndex++;
         visibleItems.removeFirst();
-        removeItem(item);
+        removeItem(item, reusableFlag);
         changed = true;
     }
     while (visibleItems.count() > 1
@@ -604,7 +611,7 @@ bool QQuickGridViewPrivate::removeNonVisibleItems(qreal bufferFrom, qreal buffer
             break;
         qCDebug(lcItemViewDelegateLifecycle) << "refill: remove last" << visibleIndex+visibleItems.count()-1;
         visibleItems.removeLast();
-        removeItem(item);
+        removeItem(item, reusableFlag);
         changed = true;
     }
 
@@ -1310,6 +1317,36 @@ void QQuickGridView::setHighlightFollowsCurrentItem(bool autoHighlight)
 */
 
 
+/*!
+    \qmlattachedsignal QtQuick::GridView::pooled()
+    \since 5.13
+
+    This attached signal is emitted after an item has been added to the reuse
+    pool. You can use it to pause ongoing timers or animations inside the item,
+    or free up resources that cannot be reused.
+
+    This signal is only emitted if the \l reuseItems property is \c true.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reuseItems, reused
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::GridView::reused()
+    \since 5.13
+
+    This attached signal is emitted after an item has been taken out of the
+    reuse pool and given a new position in the view. At this point, the
+    \c index and the model roles of the item have already been updated.
+
+    This signal is only emitted if the \l reuseItems property is \c true.
+
+    The corresponding handler is \c onReused.
+
+    \sa reuseItems, pooled
+*/
+
 /*!
     \qmlproperty model QtQuick::GridView::model
     This property holds the model providing data for the grid.
@@ -1559,6 +1596,62 @@ void QQuickGridView::setHighlightFollowsCurrentItem(bool autoHighlight)
     displayMarginBeginning or displayMarginEnd.
 */
 
+/*!
+    \qmlproperty bool QtQuick::GridView::reuseItems
+    \since 5.13
+
+    This property enables you to reuse items that are instantiated
+    from the \l delegate. If set to \c false, any currently
+    pooled items are destroyed.
+
+    When \c true, delegate items that are flicked out of the view, including
+    its \l cacheBuffer, are moved into a pool instead of being destroyed. When
+    new items need to be loaded on the other side of the grid, items created
+    from the same delegate are taken back out of the pool and given the new
+    \c index and model data, which avoids creating and destroying delegates
+    while flicking. Items that are not reused by the time the next item is
+    loaded are destroyed. Items that are referenced from JavaScript, for example
+    through \l DelegateModel groups, are never pooled.
+
+    Since a reused item keeps its state, you should avoid storing state inside
+    the delegate other than what is bound to the model data. The attached
+    \l pooled and \l reused signals can be used to reset any such state.
+
+    The number of items in the pool can be limited by setting the
+    \c QML_REUSABLE_ITEMS_POOL_SIZE environment variable. Items released
+    when the pool is full are destroyed as usual. The variable applies to
+    every view in the application, including \l TableView, whose pool is
+    unlimited otherwise.
+
+    The default value is \c false.
+
+    \sa pooled, reused
+*/
+
+/*!
+    \qmlproperty bool QtQuick::GridView::prefetch
+    \since 5.13
+
+    This property holds whether delegates are created ahead of the view
+    while it moves.
+
+    When \c true, the view extends its \l cacheBuffer in the direction of
+    movement by the distance it is expected to travel within the next few
+    frames, based on the current flick velocity. The delegates in that area
+    are incubated asynchronously in the time left over in each frame, so
+    that they are usually ready by the time they scroll into view, rather
+    than being created in the frame that needs them. A flick is not followed
+    beyond the point where it comes to rest, and the view prefetches at most
+    one view size ahead.
+
+    Prefetched delegates that are not scrolled into view are released like
+    any other buffered delegate, and are pooled if \l reuseItems is \c true.
+
+    The default value is \c false.
+
+    \sa cacheBuffer
+*/
+
 /*!
     \qmlproperty int QtQuick::GridView::displayMarginBeginning
     \qmlproperty int QtQuick::GridView::displayMarginEnd
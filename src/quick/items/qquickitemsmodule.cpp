@@ -474,6 +474,20 @@ static void qt_quickitems_defineModule(const char *uri, int major, int minor)
 #if QT_CONFIG(quick_tableview)
     qmlRegisterType<QQuickTableView>(uri, 2, 12, "TableView");
 #endif
+
+    // 5.13 revisions
+#if QT_CONFIG(quick_itemview)
+    qmlRegisterUncreatableType<QQuickItemView, 13>(uri, 2, 13, itemViewName, itemViewMessage);
+#endif
+#if QT_CONFIG(quick_listview)
+    qmlRegisterType<QQuickListView, 13>(uri, 2, 13, "ListView");
+#endif
+#if QT_CONFIG(quick_gridview)
+    qmlRegisterType<QQuickGridView, 13>(uri, 2, 13, "GridView");
+#endif
+#if QT_CONFIG(quick_tableview)
+    qmlRegisterType<QQuickTableView, 13>(uri, 2, 13, "TableView");
+#endif
 }
 
 static void initResources()
@@ -197,6 +197,8 @@ void QQuickItemView::setModel(const QVariant &m)
         disconnect(d->model, SIGNAL(initItem(int,QObject*)), this, SLOT(initItem(int,QObject*)));
         disconnect(d->model, SIGNAL(createdItem(int,QObject*)), this, SLOT(createdItem(int,QObject*)));
         disconnect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
+        QObjectPrivate::disconnect(d->model, &QQmlInstanceModel::itemPooled, d, &QQuickItemViewPrivate::itemPooledCallback);
+        QObjectPrivate::disconnect(d->model, &QQmlInstanceModel::itemReused, d, &QQuickItemViewPrivate::itemReusedCallback);
     }
 
     QQmlInstanceModel *oldModel = d->model;
@@ -232,6 +234,8 @@ void QQuickItemView::setModel(const QVariant &m)
         connect(d->model, SIGNAL(createdItem(int,QObject*)), this, SLOT(createdItem(int,QObject*)));
         connect(d->model, SIGNAL(initItem(int,QObject*)), this, SLOT(initItem(int,QObject*)));
         connect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
+        QObjectPrivate::connect(d->model, &QQmlInstanceModel::itemPooled, d, &QQuickItemViewPrivate::itemPooledCallback);
+        QObjectPrivate::connect(d->model, &QQmlInstanceModel::itemReused, d, &QQuickItemViewPrivate::itemReusedCallback);
         if (isComponentComplete()) {
             d->updateSectionCriteria();
             d->refill();
@@ -397,6 +401,45 @@ void QQuickItemView::setCacheBuffer(int b)
     }
 }
 
+bool QQuickItemView::reuseItems() const
+{
+    Q_D(const QQuickItemView);
+    return d->reusableFlag == QQmlInstanceModel::Reusable;
+}
+
+void QQuickItemView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickItemView);
+    if (reuseItems() == reuse)
+        return;
+
+    d->reusableFlag = reuse ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable;
+
+    if (!reuse && d->model) {
+        // When we're told to not reuse items, we
+        // immediately, as documented, drain the pool.
+        d->model->drainReusableItemsPool(0);
+    }
+
+    emit reuseItemsChanged();
+}
+
+bool QQuickItemView::prefetch() const
+{
+    Q_D(const QQuickItemView);
+    return d->prefetch;
+}
+
+void QQuickItemView::setPrefetch(bool prefetch)
+{
+    Q_D(QQuickItemView);
+    if (d->prefetch == prefetch)
+        return;
+
+    d->prefetch = prefetch;
+    emit prefetchChanged();
+}
+
 int QQuickItemView::displayMarginBeginning() const
 {
     Q_D(const QQuickItemView);
@@ -1482,14 +1525,15 @@ QQuickItemViewPrivate::QQuickItemViewPrivate()
     , highlightMoveDuration(150)
     , headerComponent(nullptr), header(nullptr), footerComponent(nullptr), footer(nullptr)
     , transitioner(nullptr)
+    , reusableFlag(QQmlInstanceModel::NotReusable)
     , minExtent(0), maxExtent(0)
     , ownModel(false), wrap(false)
     , keyNavigationEnabled(true)
     , explicitKeyNavigationEnabled(false)
     , inLayout(false), inViewportMoved(false), forceLayout(false), currentIndexCleared(false)
     , haveHighlightRange(false), autoHighlight(true), highlightRangeStartValid(false), highlightRangeEndValid(false)
-    , fillCacheBuffer(false), inRequest(false)
-    , runDelayedRemoveTransition(false), delegateValidated(false)
+    , fillCacheBuffer(false), inRequest(false), inApplyModelChanges(false)
+    , runDelayedRemoveTransition(false), delegateValidated(false), prefetch(false)
 {
     bufferPause.addAnimationChangeListener(this, QAbstractAnimationJob::Completion);
     bufferPause.setLoopCount(1);
@@ -1688,6 +1732,9 @@ void QQuickItemViewPrivate::clear()
     createHighlight();
     trackedItem = nullptr;
 
+    if (model)
+        model->drainReusableItemsPool(0);
+
     if (requestedIndex >= 0) {
         if (model)
             model->cancel(requestedIndex);
@@ -1735,6 +1782,7 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
         return;
     }
 
+    bool addedItems = false;
     do {
         bufferPause.stop();
         if (currentChanges.hasPendingChanges() || bufferedChanges.hasPendingChanges()) {
@@ -1750,11 +1798,21 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
         qreal fillFrom = from;
         qreal fillTo = to;
 
+        // While moving, extend the buffer in the direction of movement so that the
+        // delegates about to scroll into view are incubated before they are needed.
+        const qreal ahead = prefetchExtent();
+        if (bufferMode == BufferAfter)
+            bufferTo += ahead;
+        else if (bufferMode == BufferBefore)
+            bufferFrom -= ahead;
+
         bool added = addVisibleItems(fillFrom, fillTo, bufferFrom, bufferTo, false);
         bool removed = removeNonVisibleItems(bufferFrom, bufferTo);
 
-        if (requestedIndex == -1 && buffer && bufferMode != NoBuffer) {
-            if (added) {
+        if (requestedIndex == -1 && (buffer || ahead > 0) && bufferMode != NoBuffer) {
+            // Requesting a buffer item only starts its incubation, so when prefetching
+            // there is no need to wait for a frame without new visible items.
+            if (added && ahead <= 0) {
                 // We've already created a new delegate this frame.
                 // Just schedule a buffer refill.
                 bufferPause.start();
@@ -1767,6 +1825,8 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
             }
         }
 
+        addedItems |= added;
+
         if (added || removed) {
             markExtentsDirty();
             updateBeginningEnd();
@@ -1779,6 +1839,28 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
         if (prevCount != itemCount)
             emit q->countChanged();
     } while (currentChanges.hasPendingChanges() || bufferedChanges.hasPendingChanges());
+
+    if (addedItems && reusableFlag == QQmlInstanceModel::Reusable && model) {
+        // Items flicked out on one side of the view are normally reused when new items
+        // are loaded on the opposite side. So after each refill that loaded items, drain
+        // the ones that have rested in the pool since the previous such refill, while
+        // those released in this one stay available for the next.
+        model->drainReusableItemsPool(1);
+    }
+}
+
+/*
+  Returns how far beyond the cache buffer items are prefetched in the
+  direction of movement, which is the distance the view is expected to
+  move within the next few frames, but at most one view size.
+*/
+qreal QQuickItemViewPrivate::prefetchExtent() const
+{
+    if (!prefetch)
+        return 0;
+
+    const AxisData &data = layoutOrientation() == Qt::Vertical ? vData : hData;
+    return qMin(qAbs(predictedMovement(data, DelegatePrefetchInterval)), size());
 }
 
 void QQuickItemViewPrivate::regenerate(bool orientationChanged)
@@ -1934,6 +2016,8 @@ bool QQuickItemViewPrivate::applyModelChanges(ChangeResult *totalInsertionResult
     }
 
     updateUnrequestedIndexes();
+    aboutToApplyModelChanges(currentChanges.pendingChanges);
+    inApplyModelChanges = true;
 
     FxViewItem *prevVisibleItemsFirst = visibleItems.count() ? *visibleItems.constBegin() : 0;
     int prevItemCount = itemCount;
@@ -2067,6 +2151,7 @@ bool QQuickItemViewPrivate::applyModelChanges(ChangeResult *totalInsertionResult
 
     if (!visibleAffected)
         visibleAffected = !currentChanges.pendingChanges.changes().isEmpty();
+    inApplyModelChanges = false;
     currentChanges.reset();
 
     updateSections();
@@ -2369,7 +2454,7 @@ void QQuickItemView::destroyingItem(QObject *object)
     }
 }
 
-bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
+bool QQuickItemViewPrivate::releaseItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     Q_Q(QQuickItemView);
     if (!item || !model)
@@ -2378,7 +2463,7 @@ bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
         trackedItem = nullptr;
     item->trackGeometry(false);
 
-    QQmlInstanceModel::ReleaseFlags flags = model->release(item->item);
+    QQmlInstanceModel::ReleaseFlags flags = model->release(item->item, reusableFlag);
     if (item->item) {
         if (flags == 0) {
             // item was not destroyed, and we no longer reference it.
@@ -2386,12 +2471,36 @@ bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
             unrequestedItems.insert(item->item, model->indexOf(item->item, q));
         } else if (flags & QQmlInstanceModel::Destroyed) {
             item->item->setParentItem(nullptr);
+        } else if (flags & QQmlInstanceModel::Pooled) {
+            // item stays parented to the view until it is reused or drained from the pool
+            QQuickItemPrivate::get(item->item)->setCulled(true);
         }
     }
     delete item;
     return flags != QQmlInstanceModel::Referenced;
 }
 
+void QQuickItemViewPrivate::itemPooledCallback(int modelIndex, QObject *object)
+{
+    Q_Q(QQuickItemView);
+    Q_UNUSED(modelIndex);
+
+    // The model can be shared with other views, which are notified as well
+    QQuickItemViewAttached *attached = getAttachedObject(object);
+    if (attached && attached->view() == q)
+        attached->emitPooled();
+}
+
+void QQuickItemViewPrivate::itemReusedCallback(int modelIndex, QObject *object)
+{
+    Q_Q(QQuickItemView);
+    Q_UNUSED(modelIndex);
+
+    QQuickItemViewAttached *attached = getAttachedObject(object);
+    if (attached && attached->view() == q)
+        attached->emitReused();
+}
+
 QQuickItem *QQuickItemViewPrivate::createHighlightItem() const
 {
     return createComponentItem(highlightComponent, 0.0, true);
@@ -110,6 +110,9 @@ class Q_QUICK_PRIVATE_EXPORT QQuickItemView : public QQuickFlickable
     Q_PROPERTY(qreal preferredHighlightEnd READ preferredHighlightEnd WRITE setPreferredHighlightEnd NOTIFY preferredHighlightEndChanged RESET resetPreferredHighlightEnd)
     Q_PROPERTY(int highlightMoveDuration READ highlightMoveDuration WRITE setHighlightMoveDuration NOTIFY highlightMoveDurationChanged)
 
+    Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged REVISION 13)
+    Q_PROPERTY(bool prefetch READ prefetch WRITE setPrefetch NOTIFY prefetchChanged REVISION 13)
+
 public:
     // this holds all layout enum values so they can be referred to by other enums
     // to ensure consistent values - e.g. QML references to GridView.TopToBottom flow
@@ -159,6 +162,12 @@ public:
     int displayMarginEnd() const;
     void setDisplayMarginEnd(int);
 
+    bool reuseItems() const;
+    void setReuseItems(bool reuse);
+
+    bool prefetch() const;
+    void setPrefetch(bool prefetch);
+
     Qt::LayoutDirection layoutDirection() const;
     void setLayoutDirection(Qt::LayoutDirection);
     Qt::LayoutDirection effectiveLayoutDirection() const;
@@ -276,6 +285,9 @@ Q_SIGNALS:
     void preferredHighlightEndChanged();
     void highlightMoveDurationChanged();
 
+    Q_REVISION(13) void reuseItemsChanged();
+    Q_REVISION(13) void prefetchChanged();
+
 protected:
     void updatePolish() override;
     void componentComplete() override;
@@ -381,6 +393,8 @@ public:
 
     void emitAdd() { Q_EMIT add(); }
     void emitRemove() { Q_EMIT remove(); }
+    void emitPooled() { Q_EMIT pooled(); }
+    void emitReused() { Q_EMIT reused(); }
 
 Q_SIGNALS:
     void viewChanged();
@@ -390,6 +404,9 @@ Q_SIGNALS:
     void add();
     void remove();
 
+    void pooled();
+    void reused();
+
     void sectionChanged();
     void prevSectionChanged();
     void nextSectionChanged();
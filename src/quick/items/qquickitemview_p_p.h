@@ -174,7 +174,7 @@ public:
     void mirrorChange() override;
 
     FxViewItem *createItem(int modelIndex,QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested);
-    virtual bool releaseItem(FxViewItem *item);
+    virtual bool releaseItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable);
 
     QQuickItem *createHighlightItem() const;
     QQuickItem *createComponentItem(QQmlComponent *component, qreal zValue, bool createDefault = false) const;
@@ -210,6 +210,9 @@ public:
     void checkVisible() const;
     void showVisibleItems() const;
 
+    void itemPooledCallback(int modelIndex, QObject *object);
+    void itemReusedCallback(int modelIndex, QObject *object);
+
     void markExtentsDirty() {
         if (layoutOrientation() == Qt::Vertical)
             vData.markExtentsDirty();
@@ -289,6 +292,11 @@ public:
     QQuickItemViewTransitioner *transitioner;
     QVector<FxViewItem *> releasePendingTransition;
 
+    // Whether items scrolled out of the view are released into the model's pool
+    QQmlInstanceModel::ReusableFlag reusableFlag;
+
+    qreal prefetchExtent() const;
+
     mutable qreal minExtent;
     mutable qreal maxExtent;
 
@@ -306,8 +314,10 @@ public:
     bool highlightRangeEndValid : 1;
     bool fillCacheBuffer : 1;
     bool inRequest : 1;
+    bool inApplyModelChanges : 1;
     bool runDelayedRemoveTransition : 1;
     bool delegateValidated : 1;
+    bool prefetch : 1;
 
 protected:
     virtual Qt::Orientation layoutOrientation() const = 0;
@@ -351,10 +361,12 @@ protected:
     virtual bool applyInsertionChange(const QQmlChangeSet::Change &insert, ChangeResult *changeResult,
                 QList<FxViewItem *> *newItems, QList<MovedItem> *movingIntoView) = 0;
 
+    virtual void aboutToApplyModelChanges(const QQmlChangeSet &) {}
     virtual bool needsRefillForAddedOrRemovedIndex(int) const { return false; }
     virtual void translateAndTransitionItemsAfter(int afterIndex, const ChangeResult &insertionResult, const ChangeResult &removalResult) = 0;
 
     virtual void initializeViewItem(FxViewItem *) {}
+    virtual QQuickItemViewAttached *getAttachedObject(const QObject *) const { return nullptr; }
     virtual void initializeCurrentItem() {}
     virtual void updateSectionCriteria() {}
     virtual void updateSections() {}
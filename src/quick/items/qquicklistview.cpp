@@ -59,6 +59,138 @@ QT_BEGIN_NAMESPACE
 
 class FxListItemSG;
 
+/*
+    A Fenwick (binary indexed) tree over the extents of all items in the
+    model, each including the spacing that follows it.  It lets the view
+    map between model indexes and positions in O(log n), without creating
+    the delegates in between.
+*/
+class QQuickListViewItemExtents
+{
+public:
+    bool isValid() const { return m_valid; }
+    int count() const { return m_extents.count(); }
+
+    void clear()
+    {
+        m_extents.clear();
+        m_tree.clear();
+        m_valid = false;
+        m_spliced = false;
+    }
+
+    void reset(const QVector<qreal> &extents)
+    {
+        m_extents = extents;
+        rebuild();
+        m_valid = true;
+    }
+
+    qreal extent(int index) const { return m_extents.at(index); }
+
+    void append(qreal extent)
+    {
+        const int i = m_tree.count() + 1;
+        m_extents.append(extent);
+        m_tree.append(extent + extentBefore(i - 1) - extentBefore(i - (i & -i)));
+    }
+
+    // Each node only covers items before it, so dropping trailing items
+    // leaves the rest of the tree intact
+    void truncate(int count)
+    {
+        m_extents.resize(count);
+        m_tree.resize(count);
+    }
+
+    // Splicing items in or out anywhere else shifts all the items after
+    // them, so only the extents are updated and the tree is rebuilt from
+    // them by rebuildIfSpliced() once all the changes are applied.
+    void remove(int index, int count)
+    {
+        if (!m_spliced && index + count == m_extents.count()) {
+            truncate(index);
+        } else {
+            m_extents.remove(index, count);
+            m_spliced = true;
+        }
+    }
+
+    void insert(int index, const QVector<qreal> &extents)
+    {
+        if (!m_spliced && index == m_extents.count()) {
+            for (qreal extent : extents)
+                append(extent);
+        } else {
+            m_extents.insert(index, extents.count(), 0);
+            for (int i = 0; i < extents.count(); ++i)
+                m_extents[index + i] = extents.at(i);
+            m_spliced = true;
+        }
+    }
+
+    void rebuildIfSpliced()
+    {
+        if (m_spliced)
+            rebuild();
+    }
+
+    void setExtent(int index, qreal extent)
+    {
+        const qreal delta = extent - m_extents.at(index);
+        if (delta == 0)
+            return;
+        m_extents[index] = extent;
+        for (int i = index + 1; i <= m_tree.count(); i += i & -i)
+            m_tree[i - 1] += delta;
+    }
+
+    // The total extent of the items before \a index
+    qreal extentBefore(int index) const
+    {
+        qreal sum = 0;
+        for (int i = qMin(index, m_tree.count()); i > 0; i -= i & -i)
+            sum += m_tree.at(i - 1);
+        return sum;
+    }
+
+    // The number of leading items that end at or before \a pos, i.e.
+    // the index of the item that contains \a pos
+    int indexAt(qreal pos) const
+    {
+        const int n = m_tree.count();
+        int step = 1;
+        while (step * 2 <= n)
+            step *= 2;
+        int index = 0;
+        for (; step > 0; step /= 2) {
+            if (index + step <= n && m_tree.at(index + step - 1) <= pos) {
+                index += step;
+                pos -= m_tree.at(index - 1);
+            }
+        }
+        return index;
+    }
+
+private:
+    void rebuild()
+    {
+        m_tree = m_extents;
+        const int n = m_tree.count();
+        for (int i = 1; i <= n; ++i) {
+            const int parent = i + (i & -i);
+            if (parent <= n)
+                m_tree[parent - 1] += m_tree[i - 1];
+        }
+        m_spliced = false;
+    }
+
+    QVector<qreal> m_extents;
+    QVector<qreal> m_tree;
+    bool m_valid = false;
+    bool m_spliced = false;
+};
+
 class QQuickListViewPrivate : public QQuickItemViewPrivate
 {
     Q_DECLARE_PUBLIC(QQuickListView)
@@ -87,11 +219,12 @@ public:
     bool removeNonVisibleItems(qreal bufferFrom, qreal bufferTo) override;
     void visibleItemsChanged() override;
 
-    void removeItem(FxViewItem *item);
+    void removeItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable);
 
     FxViewItem *newViewItem(int index, QQuickItem *item) override;
     void initializeViewItem(FxViewItem *item) override;
-    bool releaseItem(FxViewItem *item) override;
+    QQuickItemViewAttached *getAttachedObject(const QObject *object) const override;
+    bool releaseItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable) override;
     void repositionItemAt(FxViewItem *item, int index, qreal sizeBuffer) override;
     void repositionPackageItemAt(QQuickItem *item, int index) override;
     void resetFirstItemPosition(qreal pos = 0.0) override;
@@ -132,6 +265,13 @@ public:
 
     void updateAverage();
 
+    bool hasSizeProvider() const { return model && !sizeRole.isEmpty(); }
+    qreal providedExtent(int modelIndex, bool *ok = nullptr) const;
+    void ensureItemExtents() const;
+    void updateItemExtents() const;
+    qreal estimatedExtent(int from, int to) const;
+    void aboutToApplyModelChanges(const QQmlChangeSet &changes) override;
+
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &oldGeometry) override;
     void fixupPosition() override;
     void fixup(AxisData &data, qreal minExtent, qreal maxExtent) override;
@@ -146,6 +286,9 @@ public:
     qreal spacing;
     QQuickListView::SnapMode snapMode;
 
+    QString sizeRole;
+    mutable QQuickListViewItemExtents itemExtents;
+
     QQuickListView::HeaderPositioning headerPositioning;
     QQuickListView::FooterPositioning footerPositioning;
 
@@ -437,7 +580,7 @@ qreal QQuickListViewPrivate::originPosition() const
     if (!visibleItems.isEmpty()) {
         pos = (*visibleItems.constBegin())->position();
         if (visibleIndex > 0)
-            pos -= visibleIndex * (averageSize + spacing);
+            pos -= estimatedExtent(0, visibleIndex);
     }
     return pos;
 }
@@ -464,9 +607,9 @@ qreal QQuickListViewPrivate::lastPosition() const
         }
         pos = (*(--visibleItems.constEnd()))->endPosition();
         if (invisibleCount > 0)
-            pos += invisibleCount * (averageSize + spacing);
+            pos += estimatedExtent(model->count() - invisibleCount, model->count());
     } else if (model && model->count()) {
-        pos = (model->count() * averageSize + (model->count()-1) * spacing);
+        pos = estimatedExtent(0, model->count()) - spacing;
     }
     return pos;
 }
@@ -478,16 +621,15 @@ qreal QQuickListViewPrivate::positionAt(int modelIndex) const
     }
     if (!visibleItems.isEmpty()) {
         if (modelIndex < visibleIndex) {
-            int count = visibleIndex - modelIndex;
             qreal cs = 0;
-            if (modelIndex == currentIndex && currentItem) {
+            if (modelIndex == currentIndex && currentItem)
                 cs = currentItem->size() + spacing;
-                --count;
-            }
-            return (*visibleItems.constBegin())->position() - count * (averageSize + spacing) - cs;
+            else
+                cs = estimatedExtent(modelIndex, modelIndex + 1);
+            return (*visibleItems.constBegin())->position() - estimatedExtent(modelIndex + 1, visibleIndex) - cs;
         } else {
-            int count = modelIndex - findLastVisibleIndex(visibleIndex) - 1;
-            return (*(--visibleItems.constEnd()))->endPosition() + spacing + count * (averageSize + spacing);
+            int lastVisibleIndex = findLastVisibleIndex(visibleIndex);
+            return (*(--visibleItems.constEnd()))->endPosition() + spacing + estimatedExtent(lastVisibleIndex + 1, modelIndex);
         }
     }
     return 0;
@@ -499,11 +641,10 @@ qreal QQuickListViewPrivate::endPositionAt(int modelIndex) const
         return item->endPosition();
     if (!visibleItems.isEmpty()) {
         if (modelIndex < visibleIndex) {
-            int count = visibleIndex - modelIndex;
-            return (*visibleItems.constBegin())->position() - (count - 1) * (averageSize + spacing) - spacing;
+            return (*visibleItems.constBegin())->position() - estimatedExtent(modelIndex + 1, visibleIndex) - spacing;
         } else {
-            int count = modelIndex - findLastVisibleIndex(visibleIndex) - 1;
-            return (*(--visibleItems.constEnd()))->endPosition() + count * (averageSize + spacing);
+            int lastVisibleIndex = findLastVisibleIndex(visibleIndex);
+            return (*(--visibleItems.constEnd()))->endPosition() + estimatedExtent(lastVisibleIndex + 1, modelIndex);
         }
     }
     return 0;
@@ -592,6 +733,7 @@ void QQuickListViewPrivate::clear()
         sectionCache[i] = nullptr;
     }
     visiblePos = 0;
+    itemExtents.clear();
     releaseSectionItem(currentSectionItem);
     currentSectionItem = nullptr;
     releaseSectionItem(nextSectionItem);
@@ -641,7 +783,13 @@ void QQuickListViewPrivate::initializeViewItem(FxViewItem *item)
     }
 }
 
-bool QQuickListViewPrivate::releaseItem(FxViewItem *item)
+QQuickItemViewAttached *QQuickListViewPrivate::getAttachedObject(const QObject *object) const
+{
+    QObject *attachedObject = qmlAttachedPropertiesObject<QQuickListView>(object, false);
+    return static_cast<QQuickItemViewAttached *>(attachedObject);
+}
+
+bool QQuickListViewPrivate::releaseItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     if (!item || !model)
         return true;
@@ -649,7 +797,7 @@ bool QQuickListViewPrivate::releaseItem(FxViewItem *item)
     QPointer<QQuickItem> it = item->item;
     QQuickListViewAttached *att = static_cast<QQuickListViewAttached*>(item->attached);
 
-    bool released = QQuickItemViewPrivate::releaseItem(item);
+    bool released = QQuickItemViewPrivate::releaseItem(item, reusableFlag);
     if (released && it && att && att->m_sectionItem) {
         // We hold no more references to this item
         int i = 0;
@@ -685,14 +833,24 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
         || bufferTo < visiblePos - averageSize - spacing)) {
         // We've jumped more than a page.  Estimate which items are now
         // visible and fill from there.
-        int count = (fillFrom - itemEnd) / (averageSize + spacing);
-        int newModelIdx = qBound(0, modelIndex + count, model->count());
-        count = newModelIdx - modelIndex;
+        int newModelIdx;
+        if (hasSizeProvider()) {
+            ensureItemExtents();
+            const qreal origin = itemEnd - estimatedExtent(0, modelIndex);
+            newModelIdx = itemExtents.indexAt(fillFrom - origin);
+        } else {
+            newModelIdx = modelIndex + int((fillFrom - itemEnd) / (averageSize + spacing));
+        }
+        newModelIdx = qBound(0, newModelIdx, model->count());
+        int count = newModelIdx - modelIndex;
         if (count) {
             releaseVisibleItems();
+            if (count > 0)
+                visiblePos = itemEnd + estimatedExtent(modelIndex, newModelIdx);
+            else
+                visiblePos = itemEnd - estimatedExtent(newModelIdx, modelIndex);
             modelIndex = newModelIdx;
             visibleIndex = modelIndex;
-            visiblePos = itemEnd + count * (averageSize + spacing);
             itemEnd = visiblePos;
         }
     }
@@ -736,7 +894,7 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
     return changed;
 }
 
-void QQuickListViewPrivate::removeItem(FxViewItem *item)
+void QQuickListViewPrivate::removeItem(FxViewItem *item, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
     if (item->transitionScheduledOrRunning()) {
         qCDebug(lcItemViewDelegateLifecycle) << "\tnot releasing animating item" << item->index << (QObject *)(item->item);
@@ -744,7 +902,7 @@ void QQuickListViewPrivate::removeItem(FxViewItem *item)
         releasePendingTransition.append(item);
     } else {
         qCDebug(lcItemViewDelegateLifecycle) << "\treleasing stationary item" << item->index << (QObject *)(item->item);
-        releaseItem(item);
+        releaseItem(item, reusableFlag);
     }
 }
 
@@ -770,7 +928,7 @@ bool QQuickListViewPrivate::removeNonVisibleItems(qreal bufferFrom, qreal buffer
                 if (item->index != -1)
                     visibleIndex++;
                 visibleItems.removeAt(index);
-                removeItem(item);
+                removeItem(item, reusableFlag);
                 if (index == 0)
                     break;
                 item = visibleItems.at(--index);
@@ -786,7 +944,7 @@ bool QQuickListViewPrivate::removeNonVisibleItems(qreal bufferFrom, qreal buffer
             break;
         qCDebug(lcItemViewDelegateLifecycle) << "refill: remove last" << visibleIndex+visibleItems.count()-1 << item->position() << (QObject *)(item->item);
         visibleItems.removeLast();
-        removeItem(item);
+        removeItem(item, reusableFlag);
         changed = true;
     }
 
@@ -830,6 +988,7 @@ void QQuickListViewPrivate::layoutVisibleItems(int fromModelIndex)
             fixedCurrent = fixedCurrent || (currentItem && item->item == currentItem->item);
         }
         averageSize = qRound(sum / visibleItems.count());
+        updateItemExtents();
 
         // move current item if it is not a visible item.
         if (currentIndex >= 0 && currentItem && !fixedCurrent)
@@ -1336,6 +1495,109 @@ void QQuickListViewPrivate::updateAverage()
     for (FxViewItem *item : qAsConst(visibleItems))
         sum += item->size();
     averageSize = qRound(sum / visibleItems.count());
+    updateItemExtents();
+}
+
+qreal QQuickListViewPrivate::providedExtent(int modelIndex, bool *ok) const
+{
+    bool valid = false;
+    qreal size = model->stringValue(modelIndex, sizeRole).toDouble(&valid);
+    if (ok)
+        *ok = valid;
+    if (!valid)
+        size = averageSize;
+    return qMax<qreal>(0, size + spacing);
+}
+
+/*
+    Builds the extent index from the size role if the model has changed
+    since it was last built.  This fetches the role for every item, but
+    does not create any delegates.
+*/
+void QQuickListViewPrivate::ensureItemExtents() const
+{
+    const int count = model->count();
+    if (itemExtents.isValid() && itemExtents.count() == count)
+        return;
+    QVector<qreal> extents;
+    extents.reserve(count);
+    for (int i = 0; i < count; ++i)
+        extents.append(providedExtent(i));
+    itemExtents.reset(extents);
+    updateItemExtents();
+}
+
+/*
+    Items that have been created know their real size, which also covers
+    any inline section delegate, so prefer it over the provided one.
+    While model changes are applied, the indexes of the visible items do
+    not yet match the extents, so they are recorded by the next layout.
+*/
+void QQuickListViewPrivate::updateItemExtents() const
+{
+    if (!itemExtents.isValid() || inApplyModelChanges)
+        return;
+    for (FxViewItem *item : visibleItems) {
+        if (item->index >= 0 && item->index < itemExtents.count())
+            itemExtents.setExtent(item->index, qMax<qreal>(0, item->size() + spacing));
+    }
+}
+
+/*
+    Returns the estimated extent of the items in [from, to), including
+    their spacing.
+*/
+qreal QQuickListViewPrivate::estimatedExtent(int from, int to) const
+{
+    if (to <= from)
+        return 0;
+    if (!hasSizeProvider())
+        return (to - from) * (averageSize + spacing);
+
+    ensureItemExtents();
+    const int count = itemExtents.count();
+    qreal extent = itemExtents.extentBefore(qMin(to, count)) - itemExtents.extentBefore(qMin(from, count));
+    if (to > count)
+        extent += (to - qMax(from, count)) * (averageSize + spacing);
+    return extent;
+}
+
+void QQuickListViewPrivate::aboutToApplyModelChanges(const QQmlChangeSet &changes)
+{
+    if (!itemExtents.isValid())
+        return;
+
+    // The extents of the items that are kept are moved to their new indexes,
+    // and the size role is only read for the inserted items.  Removes are in
+    // the order they are applied, and inserts are at their final indexes.
+    for (const QQmlChangeSet::Change &remove : changes.removes()) {
+        if (remove.end() > itemExtents.count()) {
+            itemExtents.clear();
+            return;
+        }
+        itemExtents.remove(remove.start(), remove.count);
+    }
+    for (const QQmlChangeSet::Change &insert : changes.inserts()) {
+        if (insert.start() > itemExtents.count()) {
+            itemExtents.clear();
+            return;
+        }
+        QVector<qreal> extents;
+        extents.reserve(insert.count);
+        for (int i = insert.start(); i < insert.end(); ++i)
+            extents.append(providedExtent(i));
+        itemExtents.insert(insert.start(), extents);
+    }
+    itemExtents.rebuildIfSpliced();
+
+    for (const QQmlChangeSet::Change &change : changes.changes()) {
+        for (int i = change.start(); i < qMin(change.end(), itemExtents.count()); ++i) {
+            bool ok = false;
+            const qreal extent = providedExtent(i, &ok);
+            if (ok)
+                itemExtents.setExtent(i, extent);
+        }
+    }
 }
 
 qreal QQuickListViewPrivate::headerSize() const
@@ -2130,6 +2392,36 @@ QQuickListView::~QQuickListView()
     The corresponding handler is \c onRemove.
 */
 
+/*!
+    \qmlattachedsignal QtQuick::ListView::pooled()
+    \since 5.13
+
+    This attached signal is emitted after an item has been added to the reuse
+    pool. You can use it to pause ongoing timers or animations inside the item,
+    or free up resources that cannot be reused.
+
+    This signal is only emitted if the \l reuseItems property is \c true.
+
+    The corresponding handler is \c onPooled.
+
+    \sa reuseItems, reused
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::ListView::reused()
+    \since 5.13
+
+    This attached signal is emitted after an item has been taken out of the
+    reuse pool and given a new position in the view. At this point, the
+    \c index and the model roles of the item have already been updated.
+
+    This signal is only emitted if the \l reuseItems property is \c true.
+
+    The corresponding handler is \c onReused.
+
+    \sa reuseItems, pooled
+*/
+
 /*!
     \qmlproperty model QtQuick::ListView::model
     This property holds the model providing data for the list.
@@ -2301,6 +2593,7 @@ void QQuickListView::setSpacing(qreal spacing)
     Q_D(QQuickListView);
     if (spacing != d->spacing) {
         d->spacing = spacing;
+        d->itemExtents.clear();
         d->forceLayoutPolish();
         emit spacingChanged();
     }
@@ -2467,6 +2760,62 @@ void QQuickListView::setOrientation(QQuickListView::Orientation orientation)
     displayMarginBeginning or displayMarginEnd.
 */
 
+/*!
+    \qmlproperty bool QtQuick::ListView::reuseItems
+    \since 5.13
+
+    This property enables you to reuse items that are instantiated
+    from the \l delegate. If set to \c false, any currently
+    pooled items are destroyed.
+
+    When \c true, delegate items that are flicked out of the view, including
+    its \l cacheBuffer, are moved into a pool instead of being destroyed. When
+    new items need to be loaded on the other side of the list, items created
+    from the same delegate are taken back out of the pool and given the new
+    \c index and model data, which avoids creating and destroying delegates
+    while flicking. Items that are not reused by the time the next item is
+    loaded are destroyed. Items that are referenced from JavaScript, for example
+    through \l DelegateModel groups, are never pooled.
+
+    Since a reused item keeps its state, you should avoid storing state inside
+    the delegate other than what is bound to the model data. The attached
+    \l pooled and \l reused signals can be used to reset any such state.
+
+    The number of items in the pool can be limited by setting the
+    \c QML_REUSABLE_ITEMS_POOL_SIZE environment variable. Items released
+    when the pool is full are destroyed as usual. The variable applies to
+    every view in the application, including \l TableView, whose pool is
+    unlimited otherwise.
+
+    The default value is \c false.
+
+    \sa pooled, reused
+*/
+
+/*!
+    \qmlproperty bool QtQuick::ListView::prefetch
+    \since 5.13
+
+    This property holds whether delegates are created ahead of the view
+    while it moves.
+
+    When \c true, the view extends its \l cacheBuffer in the direction of
+    movement by the distance it is expected to travel within the next few
+    frames, based on the current flick velocity. The delegates in that area
+    are incubated asynchronously in the time left over in each frame, so
+    that they are usually ready by the time they scroll into view, rather
+    than being created in the frame that needs them. A flick is not followed
+    beyond the point where it comes to rest, and the view prefetches at most
+    one view size ahead.
+
+    Prefetched delegates that are not scrolled into view are released like
+    any other buffered delegate, and are pooled if \l reuseItems is \c true.
+
+    The default value is \c false.
+
+    \sa cacheBuffer
+*/
+
 /*!
     \qmlproperty int QtQuick::ListView::displayMarginBeginning
     \qmlproperty int QtQuick::ListView::displayMarginEnd
@@ -2852,6 +3201,62 @@ void QQuickListView::setFooterPositioning(QQuickListView::FooterPositioning posi
     }
 }
 
+/*!
+    \qmlproperty string QtQuick::ListView::sizeRole
+    \since 5.13
+
+    This property holds the name of a model role that provides the size of
+    each delegate: its height in a vertical list, or its width in a
+    horizontal one.
+
+    By default, a ListView only knows the size of the delegates it has
+    created, and estimates the position of every other item from their
+    average size. When delegates vary in size, this makes the content size
+    change as the list is scrolled, and moving far through the list with
+    positionViewAtIndex() or a scroll bar lands on the wrong items.
+
+    When \c sizeRole is set, the view reads the role for every item in the
+    model, without creating their delegates, and uses it to position items
+    and to calculate the content size. The value should match the size of
+    the delegate; once a delegate has been created, its actual size is used
+    instead.
+
+    When the model changes, the role is only read again for the inserted and
+    changed items. Appending items to or removing them from the end of the
+    model is cheap; any other insertion, removal or move takes time
+    proportional to the number of items in the model.
+
+    \code
+    ListView {
+        model: messages // provides "message" and "rowHeight" roles
+        sizeRole: "rowHeight"
+        delegate: Text { text: message; height: rowHeight }
+    }
+    \endcode
+
+    The default value is an empty string, meaning that sizes are estimated.
+*/
+QString QQuickListView::sizeRole() const
+{
+    Q_D(const QQuickListView);
+    return d->sizeRole;
+}
+
+void QQuickListView::setSizeRole(const QString &role)
+{
+    Q_D(QQuickListView);
+    if (d->sizeRole != role) {
+        d->sizeRole = role;
+        d->itemExtents.clear();
+        d->updateSectionCriteria(); // updates the watched roles
+        if (isComponentComplete()) {
+            d->updateViewport();
+            d->forceLayoutPolish();
+        }
+        emit sizeRoleChanged();
+    }
+}
+
 /*!
     \qmlproperty Transition QtQuick::ListView::populate
 
@@ -3393,6 +3798,8 @@ void QQuickListViewPrivate::updateSectionCriteria()
         QList<QByteArray> roles;
         if (sectionCriteria && !sectionCriteria->property().isEmpty())
             roles << sectionCriteria->property().toUtf8();
+        if (!sizeRole.isEmpty())
+            roles << sizeRole.toUtf8();
         model->setWatchedRoles(roles);
         updateSections();
         if (itemCount)
@@ -3461,7 +3868,7 @@ bool QQuickListViewPrivate::applyInsertionChange(const QQmlChangeSet::Change &ch
         if (insertionIdx < visibleIndex) {
             if (pos >= from) {
                 // items won't be visible, just note the size for repositioning
-                insertResult->sizeChangesBeforeVisiblePos += count * (averageSize + spacing);
+                insertResult->sizeChangesBeforeVisiblePos += estimatedExtent(modelIndex, modelIndex + count);
             }
         } else {
             for (i = count-1; i >= 0 && pos >= from; --i) {
@@ -128,6 +128,7 @@ class Q_QUICK_PRIVATE_EXPORT QQuickListView : public QQuickItemView
 
     Q_PROPERTY(HeaderPositioning headerPositioning READ headerPositioning WRITE setHeaderPositioning NOTIFY headerPositioningChanged REVISION 2)
     Q_PROPERTY(FooterPositioning footerPositioning READ footerPositioning WRITE setFooterPositioning NOTIFY footerPositioningChanged REVISION 2)
+    Q_PROPERTY(QString sizeRole READ sizeRole WRITE setSizeRole NOTIFY sizeRoleChanged REVISION 13)
 
     Q_CLASSINFO("DefaultProperty", "data")
 
@@ -174,6 +175,9 @@ public:
     FooterPositioning footerPositioning() const;
     void setFooterPositioning(FooterPositioning positioning);
 
+    QString sizeRole() const;
+    void setSizeRole(const QString &role);
+
     static QQuickListViewAttached *qmlAttachedProperties(QObject *);
 
 public Q_SLOTS:
@@ -190,6 +194,7 @@ Q_SIGNALS:
     void snapModeChanged();
     Q_REVISION(2) void headerPositioningChanged();
     Q_REVISION(2) void footerPositioningChanged();
+    Q_REVISION(13) void sizeRoleChanged();
 
 protected:
     void viewportMoved(Qt::Orientations orient) override;
@@ -42,6 +42,7 @@
 
 #include <QtCore/qtimer.h>
 #include <QtCore/qdir.h>
+#include <QtCore/qset.h>
 #include <QtQml/private/qqmldelegatemodel_p.h>
 #include <QtQml/private/qqmldelegatemodel_p_p.h>
 #include <QtQml/private/qqmlincubator_p.h>
@@ -113,6 +114,11 @@
     If you don't want to reuse items or if the \l delegate cannot support it,
     you can set the \l reuseItems property to \c false.
 
+    The number of items in the pool is not limited, unless the
+    \c QML_REUSABLE_ITEMS_POOL_SIZE environment variable is set. It limits
+    the pools of all views in the application, including ListView and
+    GridView.
+
     \note While an item is in the pool, it might still be alive and respond
     to connected signals and bindings.
 
@@ -278,6 +284,27 @@
     \sa {Reusing items}, TableView::pooled, TableView::reused
 */
 
+/*!
+    \qmlproperty bool QtQuick::TableView::prefetch
+    \since 5.13
+
+    This property holds whether delegates are created ahead of the view
+    while it moves.
+
+    When \c true, the view requests the rows and columns it is expected to
+    move into within the next few frames, based on the current flick
+    velocity. Those delegates are incubated asynchronously in the time left
+    over in each frame, so that they are usually ready by the time they
+    scroll into view, rather than being created in the frame that needs
+    them. A flick is not followed beyond the point where it comes to rest,
+    and the view prefetches at most one view size ahead.
+
+    Prefetched delegates that do not scroll into view are released again,
+    into the pool if \l reuseItems is \c true.
+
+    The default value is \c false.
+*/
+
 /*!
     \qmlproperty real QtQuick::TableView::contentWidth
 
@@ -420,6 +447,7 @@ QQuickTableViewPrivate::QQuickTableViewPrivate()
 
 QQuickTableViewPrivate::~QQuickTableViewPrivate()
 {
+    releasePrefetchedItems(QQmlTableInstanceModel::NotReusable);
     releaseLoadedItems(QQmlTableInstanceModel::NotReusable);
     if (tableModel)
         delete tableModel;
@@ -658,6 +686,12 @@ FxTableItem *QQuickTableViewPrivate::createFxTableItem(const QPoint &cell, QQmlI
         ownItem = true;
     }
 
+    if (prefetchedItems.contains(modelIndex)) {
+        // The table holds its own reference to the item from now on
+        if (QObject *prefetched = prefetchedItems.take(modelIndex))
+            model->release(prefetched);
+    }
+
     QQuickItem *item = qmlobject_cast<QQuickItem*>(object);
     if (!item) {
         // The model could not provide an QQuickItem for the
@@ -1454,6 +1488,83 @@ void QQuickTableViewPrivate::drainReusePoolAfterLoadRequest()
     tableModel->drainReusableItemsPool(maxTime);
 }
 
+void QQuickTableViewPrivate::updatePrefetchedItems()
+{
+    // Request the cells that the viewport is expected to move into within the
+    // next few frames. They are incubated asynchronously in the time left over
+    // in each frame, so that they are ready by the time loadEdge() needs them.
+    QSet<int> upcoming;
+
+    if (prefetch && !loadedItems.isEmpty()) {
+        const qreal dy = qBound(-viewportRect.height(), predictedMovement(vData, DelegatePrefetchInterval), viewportRect.height());
+        const qreal rowSize = averageEdgeSize.height() + cellSpacing.height();
+        if (!qFuzzyIsNull(dy) && rowSize > 0) {
+            const int count = int(std::ceil(qAbs(dy) / rowSize));
+            const int first = dy > 0 ? loadedTable.bottom() + 1 : loadedTable.top() - count;
+            const int last = qMin(first + count, tableSize.height()) - 1;
+            for (int row = qMax(0, first); row <= last; ++row) {
+                for (int column = loadedTable.left(); column <= loadedTable.right(); ++column)
+                    upcoming.insert(modelIndexAtCell(QPoint(column, row)));
+            }
+        }
+
+        const qreal dx = qBound(-viewportRect.width(), predictedMovement(hData, DelegatePrefetchInterval), viewportRect.width());
+        const qreal columnSize = averageEdgeSize.width() + cellSpacing.width();
+        if (!qFuzzyIsNull(dx) && columnSize > 0) {
+            const int count = int(std::ceil(qAbs(dx) / columnSize));
+            const int first = dx > 0 ? loadedTable.right() + 1 : loadedTable.left() - count;
+            const int last = qMin(first + count, tableSize.width()) - 1;
+            for (int column = qMax(0, first); column <= last; ++column) {
+                for (int row = loadedTable.top(); row <= loadedTable.bottom(); ++row)
+                    upcoming.insert(modelIndexAtCell(QPoint(column, row)));
+            }
+        }
+    }
+
+    for (auto it = prefetchedItems.begin(); it != prefetchedItems.end(); ) {
+        if (upcoming.contains(it.key())) {
+            ++it;
+            continue;
+        }
+        releasePrefetchedItem(it.key(), it.value(), reusableFlag);
+        it = prefetchedItems.erase(it);
+    }
+
+    QBoolBlocker guard(blockItemCreatedCallback);
+    for (int modelIndex : qAsConst(upcoming)) {
+        if (prefetchedItems.contains(modelIndex))
+            continue;
+        QObject *object = model->object(modelIndex, QQmlIncubator::Asynchronous);
+        if (auto item = qmlobject_cast<QQuickItem *>(object))
+            QQuickItemPrivate::get(item)->setCulled(true);
+        prefetchedItems.insert(modelIndex, object);
+    }
+}
+
+void QQuickTableViewPrivate::releasePrefetchedItems(QQmlTableInstanceModel::ReusableFlag reusableFlag)
+{
+    // Make a copy and clear the list first, like releaseLoadedItems()
+    const auto items = prefetchedItems;
+    prefetchedItems.clear();
+    for (auto it = items.cbegin(); it != items.cend(); ++it)
+        releasePrefetchedItem(it.key(), it.value(), reusableFlag);
+}
+
+void QQuickTableViewPrivate::releasePrefetchedItem(int modelIndex, QObject *object, QQmlTableInstanceModel::ReusableFlag reusableFlag)
+{
+    if (object) {
+        model->release(object, reusableFlag);
+        return;
+    }
+
+    // The item is still incubating. Cancel it, so that it stops taking up
+    // incubation time, unless the current load request is waiting for it.
+    if (loadRequest.isActive() && modelIndexAtCell(loadRequest.currentCell()) == modelIndex)
+        return;
+    if (model->incubationStatus(modelIndex) == QQmlIncubator::Loading)
+        model->cancel(modelIndex);
+}
+
 void QQuickTableViewPrivate::scheduleRebuildTable(RebuildOptions options) {
     if (!q_func()->isComponentComplete()) {
         // We'll rebuild the table once complete anyway
@@ -1506,6 +1617,9 @@ void QQuickTableViewPrivate::updatePolish()
         relayoutTable();
 
     loadAndUnloadVisibleEdges();
+
+    if (!loadRequest.isActive() && (prefetch || !prefetchedItems.isEmpty()))
+        updatePrefetchedItems();
 }
 
 void QQuickTableViewPrivate::fixup(QQuickFlickablePrivate::AxisData &data, qreal minExtent, qreal maxExtent)
@@ -1545,6 +1659,25 @@ void QQuickTableViewPrivate::itemCreatedCallback(int modelIndex, QObject*)
     if (blockItemCreatedCallback)
         return;
 
+    if (prefetchedItems.contains(modelIndex) && !prefetchedItems.value(modelIndex)) {
+        if (rebuildScheduled) {
+            // The model index may no longer be valid. Let the model destroy the item.
+            prefetchedItems.remove(modelIndex);
+        } else {
+            // A prefetched item finished incubating. Keep it, hidden,
+            // until the table loads its cell or it is no longer upcoming.
+            QBoolBlocker guard(blockItemCreatedCallback);
+            QObject *object = model->object(modelIndex, QQmlIncubator::Asynchronous);
+            if (auto item = qmlobject_cast<QQuickItem *>(object))
+                QQuickItemPrivate::get(item)->setCulled(true);
+            prefetchedItems.insert(modelIndex, object);
+        }
+    }
+
+    // Only a load request waits for an item to finish incubating
+    if (!loadRequest.isActive())
+        return;
+
     qCDebug(lcTableViewDelegateLifecycle) << "item done loading:"
         << cellAtModelIndex(modelIndex);
 
@@ -1605,6 +1738,9 @@ void QQuickTableViewPrivate::syncRebuildOptions()
     if (!rebuildScheduled)
         return;
 
+    // The prefetched cells are about to move, or belong to a model that is being replaced
+    releasePrefetchedItems(QQmlTableInstanceModel::NotReusable);
+
     rebuildState = RebuildState::Begin;
     rebuildOptions = scheduledRebuildOptions;
     scheduledRebuildOptions = RebuildOption::None;
@@ -1920,6 +2056,24 @@ void QQuickTableView::setReuseItems(bool reuse)
     emit reuseItemsChanged();
 }
 
+bool QQuickTableView::prefetch() const
+{
+    return d_func()->prefetch;
+}
+
+void QQuickTableView::setPrefetch(bool prefetch)
+{
+    Q_D(QQuickTableView);
+    if (d->prefetch == prefetch)
+        return;
+
+    d->prefetch = prefetch;
+    if (!prefetch)
+        d->releasePrefetchedItems(d->reusableFlag);
+
+    emit prefetchChanged();
+}
+
 void QQuickTableView::setContentWidth(qreal width)
 {
     Q_D(QQuickTableView);
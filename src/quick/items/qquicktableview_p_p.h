@@ -238,11 +238,16 @@ public:
 
     QQmlTableInstanceModel::ReusableFlag reusableFlag = QQmlTableInstanceModel::Reusable;
 
+    // Items requested ahead of the viewport while flicking, by model index. The
+    // object is null until the item has finished incubating.
+    QHash<int, QObject *> prefetchedItems;
+
     bool blockItemCreatedCallback = false;
     bool columnRowPositionsInvalid = false;
     bool layoutWarningIssued = false;
     bool polishing = false;
     bool rebuildScheduled = true;
+    bool prefetch = false;
 
     QJSValue rowHeightProvider;
     QJSValue columnWidthProvider;
@@ -323,6 +328,9 @@ public:
     void unloadEdge(Qt::Edge edge);
     void loadAndUnloadVisibleEdges();
     void drainReusePoolAfterLoadRequest();
+    void updatePrefetchedItems();
+    void releasePrefetchedItems(QQmlTableInstanceModel::ReusableFlag reusableFlag);
+    void releasePrefetchedItem(int modelIndex, QObject *object, QQmlTableInstanceModel::ReusableFlag reusableFlag);
     void cancelLoadRequest();
     void processLoadRequest();
 
@@ -44,6 +44,7 @@
 #include "qquickitem.h"
 #include "qquickitem_p.h"
 #include "qquickevents_p_p.h"
+#include "qquickframestatistics_p.h"
 
 #include <private/qquickdrag_p.h>
 #include <private/qquickhoverhandler_p.h>
@@ -98,6 +99,7 @@ Q_LOGGING_CATEGORY(DBG_HOVER_TRACE, "qt.quick.hover.trace")
 Q_LOGGING_CATEGORY(DBG_FOCUS, "qt.quick.focus")
 Q_LOGGING_CATEGORY(DBG_DIRTY, "qt.quick.dirty")
 Q_LOGGING_CATEGORY(lcTransient, "qt.quick.window.transient")
+Q_LOGGING_CATEGORY(lcIncubation, "qt.quick.incubation")
 
 extern Q_GUI_EXPORT QImage qt_gl_read_framebuffer(const QSize &size, bool alpha_format, bool include_alpha);
 
@@ -131,8 +133,9 @@ public:
     QQuickWindowIncubationController(QSGRenderLoop *loop)
         : m_renderLoop(loop), m_timer(0)
     {
+        m_frame_time = qMax(1, int(1000 / QGuiApplication::primaryScreen()->refreshRate()));
         // Allow incubation for 1/3 of a frame.
-        m_incubation_time = qMax(1, int(1000 / QGuiApplication::primaryScreen()->refreshRate()) / 3);
+        m_incubation_time = qMax(1, m_frame_time / 3);
 
         QAnimationDriver *animationDriver = m_renderLoop->animationDriver();
         if (animationDriver) {
@@ -157,13 +160,35 @@ protected:
         }
     }
 
+    // The part of the frame left after the GUI thread prepared it, keeping a
+    // sixth of the frame for event delivery. Falls back to the fixed 1/3 of
+    // a frame if the render loop does not measure its frames.
+    int frameBudget() const
+    {
+        const qint64 used = m_renderLoop->guiThreadFrameTime();
+        if (used < 0)
+            return m_incubation_time;
+        const int remaining = m_frame_time - m_frame_time / 6 - int(used / 1000000);
+        return qBound(1, remaining, qMax(1, m_frame_time / 2));
+    }
+
+    void incubateTimed(int msecs)
+    {
+        incubateFor(msecs);
+        qCDebug(lcIncubation).nospace()
+                << "incubated " << lastIncubatedObjectCount()
+                << " objects in " << lastIncubationTime() / 1000000 << "ms"
+                << ", budget=" << lastIncubationBudget() << "ms"
+                << ", pending=" << incubatingObjectCount();
+    }
+
 public slots:
     void incubate() {
         if (incubatingObjectCount()) {
             if (m_renderLoop->interleaveIncubation()) {
-                incubateFor(m_incubation_time);
+                incubateTimed(frameBudget());
             } else {
-                incubateFor(m_incubation_time * 2);
+                incubateTimed(m_incubation_time * 2);
                 if (incubatingObjectCount())
                     incubateAgain();
             }
@@ -181,6 +206,7 @@ protected:
 
 private:
     QSGRenderLoop *m_renderLoop;
+    int m_frame_time;
     int m_incubation_time;
     int m_timer;
 };
@@ -534,6 +560,10 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size)
     if (!renderer)
         return;
 
+    QQuickFrameStatistics *statistics = frameStatistics.loadAcquire();
+    if (statistics) // only count the uploads of this frame
+        qsg_takeTextureUploadBytes();
+
     animationController->advance();
     emit q->beforeRendering();
     runAndClearJobs(&beforeRenderingJobs);
@@ -560,12 +590,41 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size)
             renderer->setDevicePixelRatio(devicePixelRatio);
         }
 
+        qsg_beginTextureUploadFrame();
         context->renderNextFrame(renderer, fboId);
+        // Render again to upload the textures that did not fit in this frame
+        if (qsg_endTextureUploadFrame())
+            q->update();
+    }
+    if (statistics) {
+        const QSGRenderer::FrameCounters &counters = renderer->frameCounters();
+        statistics->recordRenderCounters(counters.batches, counters.uploadedBatches, counters.uploadedBytes,
+                                         qsg_takeTextureUploadBytes());
     }
     emit q->afterRendering();
     runAndClearJobs(&afterRenderingJobs);
 }
 
+/*!
+    \internal
+    Starts recording the timings and counters of the frames of this window,
+    keeping the last \a capacity frames, and returns the statistics. Calling
+    it again returns the existing statistics. The statistics are only deleted
+    with the window, as the render thread may be recording a frame.
+*/
+QQuickFrameStatistics *QQuickWindowPrivate::enableFrameStatistics(int capacity)
+{
+    Q_Q(QQuickWindow);
+    if (QQuickFrameStatistics *statistics = frameStatistics.loadAcquire())
+        return statistics;
+
+    QScreen *screen = q->screen();
+    QQuickFrameStatistics *statistics = new QQuickFrameStatistics(capacity, screen ? screen->refreshRate() : 60);
+    qsg_enableTextureUploadCounting(true);
+    frameStatistics.storeRelease(statistics);
+    return statistics;
+}
+
 QQuickWindowPrivate::QQuickWindowPrivate()
     : contentItem(nullptr)
     , activeFocusItem(nullptr)
@@ -608,6 +667,10 @@ QQuickWindowPrivate::QQuickWindowPrivate()
 QQuickWindowPrivate::~QQuickWindowPrivate()
 {
     delete customRenderStage;
+    if (QQuickFrameStatistics *statistics = frameStatistics.load()) {
+        qsg_enableTextureUploadCounting(false);
+        delete statistics;
+    }
     if (QQmlInspectorService *service = QQmlDebugConnector::service<QQmlInspectorService>())
         service->removeWindow(q_func());
 }
@@ -656,6 +719,10 @@ void QQuickWindowPrivate::init(QQuickWindow *c, QQuickRenderControl *control)
 
     animationController = new QQuickAnimatorController(q);
 
+    static const int frameStatisticsCapacity = qEnvironmentVariableIntValue("QSG_FRAME_STATISTICS");
+    if (frameStatisticsCapacity > 0)
+        enableFrameStatistics(frameStatisticsCapacity);
+
     QObject::connect(context, SIGNAL(initialized()), q, SIGNAL(sceneGraphInitialized()), Qt::DirectConnection);
     QObject::connect(context, SIGNAL(invalidated()), q, SIGNAL(sceneGraphInvalidated()), Qt::DirectConnection);
     QObject::connect(context, SIGNAL(invalidated()), q, SLOT(cleanupSceneGraph()), Qt::DirectConnection);
@@ -3990,7 +4057,9 @@ QImage QQuickWindow::grabWindow()
 
             d->polishItems();
             d->syncSceneGraph();
+            qsg_suspendTextureUploadBudget();
             d->renderSceneGraph(size());
+            qsg_resumeTextureUploadBudget();
 
             bool alpha = format().alphaBufferSize() > 0 && color().alpha() < 255;
             QImage image = qt_gl_read_framebuffer(size() * effectiveDevicePixelRatio(), alpha, alpha);
@@ -4015,6 +4084,11 @@ QImage QQuickWindow::grabWindow()
     for this window. QQuickView automatically installs this controller for you,
     otherwise you will need to install it yourself using \l{QQmlEngine::setIncubationController()}.
 
+    When the render loop measures how long the GUI thread needed to prepare a
+    frame, the controller incubates for the time left in that frame. Incubation
+    statistics for each frame are reported in the \c qt.quick.incubation
+    logging category.
+
     The controller is owned by the window and will be destroyed when the window
     is deleted.
 */
@@ -5143,6 +5217,44 @@ void QQuickWindow::setTextRenderType(QQuickWindow::TextRenderType renderType)
     QQuickWindowPrivate::textRenderType = renderType;
 }
 
+/*!
+    \since 5.13
+
+    Starts recording the timings and counters of the frames rendered for this
+    window, keeping the last \a capacity frames, or 300 frames if \a capacity
+    is not positive. Returns the statistics, which can be read from any
+    thread. Calling this function again returns the existing statistics and
+    does not change their capacity.
+
+    The statistics are owned by the window and live as long as it does.
+    QQuickFrameStatistics is declared in the private header
+    \c <QtQuick/private/qquickframestatistics_p.h>.
+
+    Setting the \c QSG_FRAME_STATISTICS environment variable to a number of
+    frames enables the statistics for every window.
+
+    \sa frameStatistics()
+*/
+QQuickFrameStatistics *QQuickWindow::enableFrameStatistics(int capacity)
+{
+    Q_D(QQuickWindow);
+    return d->enableFrameStatistics(capacity);
+}
+
+/*!
+    \since 5.13
+
+    Returns the frame statistics of this window, or \c null if they have
+    not been enabled.
+
+    \sa enableFrameStatistics()
+*/
+QQuickFrameStatistics *QQuickWindow::frameStatistics() const
+{
+    Q_D(const QQuickWindow);
+    return d->frameStatistics.loadAcquire();
+}
+
 #ifndef QT_NO_DEBUG_STREAM
 QDebug operator<<(QDebug debug, const QQuickWindow *win)
 {
@@ -66,6 +66,7 @@ class QQuickRenderControl;
 class QSGRectangleNode;
 class QSGImageNode;
 class QSGNinePatchNode;
+class QQuickFrameStatistics;
 
 class Q_QUICK_EXPORT QQuickWindow : public QWindow
 {
@@ -181,6 +182,9 @@ public:
     static TextRenderType textRenderType();
     static void setTextRenderType(TextRenderType renderType);
 
+    QQuickFrameStatistics *enableFrameStatistics(int capacity = 0);
+    QQuickFrameStatistics *frameStatistics() const;
+
 Q_SIGNALS:
     void frameSwapped();
     Q_REVISION(2) void openglContextCreated(QOpenGLContext *context);
@@ -74,6 +74,7 @@ QT_BEGIN_NAMESPACE
 class QOpenGLVertexArrayObjectHelper;
 class QQuickAnimatorController;
 class QQuickDragGrabber;
+class QQuickFrameStatistics;
 class QQuickItemPrivate;
 class QQuickPointerDevice;
 class QQuickRenderControl;
@@ -279,6 +280,10 @@ public:
 
     mutable QQuickWindowIncubationController *incubationController;
 
+    // Created on the gui thread and read by the render thread, never deleted before the window
+    QAtomicPointer<QQuickFrameStatistics> frameStatistics;
+    QQuickFrameStatistics *enableFrameStatistics(int capacity = 0);
+
     static bool defaultAlphaBuffer;
     static QQuickWindow::TextRenderType textRenderType;
 
@@ -45,6 +45,15 @@
 #include "qsgsoftwarerenderablenode_p.h"
 
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVarLengthArray>
+#include <QtCore/qmath.h>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
 #include <QtGui/QWindow>
 #include <QtQuick/QSGSimpleRectNode>
 
@@ -52,9 +61,135 @@ Q_LOGGING_CATEGORY(lc2DRender, "qt.scenegraph.softwarecontext.abstractrenderer")
 
 QT_BEGIN_NAMESPACE
 
+Q_GLOBAL_STATIC(QThreadPool, qsg_software_band_pool)
+
+static int qsg_software_render_threads()
+{
+    static const int threads = qEnvironmentVariableIsSet("QSG_SOFTWARE_RENDER_THREADS")
+            ? qMax(1, qEnvironmentVariableIntValue("QSG_SOFTWARE_RENDER_THREADS"))
+            : qBound(1, QThread::idealThreadCount(), 8);
+    return threads;
+}
+
+// Number of frames a node has to stay unchanged before it is painted into
+// the retained image, 0 disables the retained image.
+static int qsg_software_retain_frames()
+{
+    static const int frames = qEnvironmentVariableIsSet("QSG_SOFTWARE_RETAIN_FRAMES")
+            ? qMax(0, qEnvironmentVariableIntValue("QSG_SOFTWARE_RETAIN_FRAMES"))
+            : 3;
+    return frames;
+}
+
+// Maximum number of rects in the accumulated dirty region, 0 for no limit
+static int qsg_software_max_dirty_rects()
+{
+    static const int rects = qEnvironmentVariableIsSet("QSG_SOFTWARE_MAX_DIRTY_RECTS")
+            ? qMax(0, qEnvironmentVariableIntValue("QSG_SOFTWARE_MAX_DIRTY_RECTS"))
+            : 32;
+    return rects;
+}
+
+static qint64 qsg_regionArea(const QRegion &region)
+{
+    qint64 area = 0;
+    for (const QRect &rect : region)
+        area += qint64(rect.width()) * rect.height();
+    return area;
+}
+
+// Bands smaller than this are not worth the synchronization.
+static const int qsg_minimum_band_height = 64;
+static const int qsg_minimum_banded_area = 256 * 256;
+
+// The pixels of the image that all bands paint into, and the part of it
+// that is copied from the retained image instead of being painted
+struct QSGSoftwareBandTarget
+{
+    uchar *bits;
+    int width;
+    int height;
+    int bytesPerLine;
+    QImage::Format format;
+    qreal devicePixelRatio;
+    const QImage *retainedImage;
+    QRegion retainedRegion;
+    int retainedCount;
+};
+
+/*
+    Paints the part of the render list inside \a band. Each band paints
+    through its own QImage over the pixels of the target. A copy of a shared
+    QImage would be detached by QPainter::begin(), and its output lost.
+    Glyph nodes are painted one at a time, as the glyph caches of the font
+    engines are shared by all painters and are not thread-safe.
+*/
+static void qsg_paintBand(const QLinkedList<QSGSoftwareRenderableNode *> &nodes, const QSGSoftwareBandTarget &target,
+                          const QRect &band, QMutex *glyphMutex)
+{
+    QImage image(target.bits, target.width, target.height, target.bytesPerLine, target.format);
+    image.setDevicePixelRatio(target.devicePixelRatio);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    auto it = nodes.cbegin();
+    bool first = true;
+    if (target.retainedCount > 0) {
+        const QRegion retainedRegion = target.retainedRegion.intersected(band);
+        if (!retainedRegion.isEmpty()) {
+            painter.save();
+            painter.setCompositionMode(QPainter::CompositionMode_Source);
+            painter.setClipRegion(retainedRegion);
+            painter.drawImage(QPointF(0, 0), *target.retainedImage);
+            painter.restore();
+        }
+        for (int i = 0; i < target.retainedCount; ++i)
+            ++it;
+        first = false;
+    }
+
+    for (; it != nodes.cend(); ++it) {
+        QSGSoftwareRenderableNode *node = *it;
+        // The first node is the background and needs to be painted without blending
+        if (node->needsPainting() && node->dirtyRegion().intersects(band)) {
+            if (node->type() == QSGSoftwareRenderableNode::Glyph) {
+                QMutexLocker lock(glyphMutex);
+                node->paint(&painter, first, band);
+            } else {
+                node->paint(&painter, first, band);
+            }
+        }
+        first = false;
+    }
+}
+
+class QSGSoftwareBandPainter : public QRunnable
+{
+public:
+    QSGSoftwareBandPainter(const QLinkedList<QSGSoftwareRenderableNode *> &nodes, const QSGSoftwareBandTarget &target,
+                           const QRect &band, QMutex *glyphMutex, QSemaphore *done)
+        : m_nodes(nodes), m_target(target), m_band(band), m_glyphMutex(glyphMutex), m_done(done)
+    {
+    }
+
+    void run() override
+    {
+        qsg_paintBand(m_nodes, m_target, m_band, m_glyphMutex);
+        m_done->release();
+    }
+
+private:
+    const QLinkedList<QSGSoftwareRenderableNode *> &m_nodes;
+    QSGSoftwareBandTarget m_target;
+    QRect m_band;
+    QMutex *m_glyphMutex;
+    QSemaphore *m_done;
+};
+
 QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *context)
     : QSGRenderer(context)
     , m_background(new QSGSimpleRectNode)
+    , m_renderThreadCount(qsg_software_render_threads())
     , m_nodeUpdater(new QSGSoftwareRenderableNodeUpdater(this))
 {
     // Setup special background node
@@ -129,19 +264,289 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
         return dirtyRegion;
 
     auto iterator = m_renderableNodes.begin();
-    // First node is the background and needs to painted without blending
-    auto backgroundNode = *iterator;
-    dirtyRegion += backgroundNode->renderNode(painter, /*force opaque painting*/ true);
-    iterator++;
+    const int retainedCount = updateRetainedImage(painter->device());
+    m_statistics.retainedNodes = retainedCount;
+    if (retainedCount > 0) {
+        // The bottom of the render list has not changed for a while, so its
+        // dirty parts are copied from the retained image instead of painting
+        // each of its nodes again
+        QRegion retainedRegion;
+        auto retainedEnd = iterator;
+        for (int i = 0; i < retainedCount; ++i, ++retainedEnd) {
+            if ((*retainedEnd)->needsPainting())
+                retainedRegion += (*retainedEnd)->dirtyRegion();
+        }
+        if (!retainedRegion.isEmpty()) {
+            painter->save();
+            painter->setCompositionMode(QPainter::CompositionMode_Source);
+            painter->setClipRegion(retainedRegion);
+            painter->drawImage(QPointF(0, 0), m_retainedImage);
+            painter->restore();
+        }
+        for (; iterator != retainedEnd; ++iterator)
+            dirtyRegion += (*iterator)->finishPainting();
+    } else {
+        // First node is the background and needs to painted without blending
+        auto backgroundNode = *iterator;
+        dirtyRegion += backgroundNode->renderNode(painter, /*force opaque painting*/ true);
+        iterator++;
+    }
 
     for (; iterator != m_renderableNodes.end(); ++iterator) {
         auto node = *iterator;
         dirtyRegion += node->renderNode(painter);
     }
 
+    for (QSGSoftwareRenderableNode *node : m_renderableNodes)
+        node->countStaticFrame();
+
     return dirtyRegion;
 }
 
+/*
+    Returns the number of nodes at the bottom of the render list that are
+    painted in the retained image, and can be copied from it instead of being
+    painted into \a device. The image is repainted when the nodes that have
+    not changed for a while are no longer the ones it holds.
+
+    The render list is flat, so the subtrees that stay unchanged behind the
+    animated parts of a scene show up as the nodes painted before the first
+    node that changed recently. Render nodes are never retained, as they may
+    paint to the device directly.
+*/
+int QSGAbstractSoftwareRenderer::updateRetainedImage(QPaintDevice *device)
+{
+    const int frames = qsg_software_retain_frames();
+    if (frames == 0 || !device) {
+        releaseRetainedImage();
+        return 0;
+    }
+
+    QVector<QSGSoftwareRenderableNode*> staticNodes;
+    for (QSGSoftwareRenderableNode *node : m_renderableNodes) {
+        if (node->staticFrameCount() < frames || node->type() == QSGSoftwareRenderableNode::RenderNode)
+            break;
+        staticNodes.append(node);
+    }
+
+    const QImage::Format format = device->devType() == QInternal::Image
+            ? static_cast<QImage *>(device)->format()
+            : QImage::Format_ARGB32_Premultiplied;
+    const bool imageMatches = !m_retainedImage.isNull()
+            && m_retainedImage.width() == device->width()
+            && m_retainedImage.height() == device->height()
+            && m_retainedImage.devicePixelRatioF() == device->devicePixelRatioF()
+            && m_retainedImage.format() == format;
+    const bool nodesMatch = !m_retainedNodes.isEmpty()
+            && staticNodes.size() >= m_retainedNodes.size()
+            && std::equal(m_retainedNodes.cbegin(), m_retainedNodes.cend(), staticNodes.cbegin());
+
+    // Retaining only the background, or the whole scene, saves nothing. The
+    // image is also updated when more nodes became static since.
+    const bool usable = imageMatches && nodesMatch;
+    const bool repaint = staticNodes.size() >= 2 && staticNodes.size() < m_renderableNodes.size()
+            && (!usable || staticNodes.size() > m_retainedNodes.size());
+    if (!repaint) {
+        if (usable)
+            return m_retainedNodes.size();
+        releaseRetainedImage();
+        return 0;
+    }
+
+    if (usable) {
+        // The nodes in the image are still the bottom of the list, so the
+        // nodes that became static since are painted on top of them
+        QPainter painter(&m_retainedImage);
+        painter.setRenderHint(QPainter::Antialiasing);
+        for (int i = m_retainedNodes.size(); i < staticNodes.size(); ++i)
+            staticNodes.at(i)->paintRetained(&painter, false);
+        m_statistics.retainedNodesPainted += staticNodes.size() - m_retainedNodes.size();
+        m_retainedNodes = staticNodes;
+        qCDebug(lc2DRender, "retained %d nodes", m_retainedNodes.size());
+        return m_retainedNodes.size();
+    }
+
+    // Use the format of the target, so that the nodes render exactly as they
+    // would when painted there, text antialiasing in particular
+    m_retainedImage = QImage(device->width(), device->height(), format);
+    m_retainedImage.setDevicePixelRatio(device->devicePixelRatioF());
+    m_retainedImage.fill(Qt::transparent);
+    m_retainedNodes = staticNodes;
+
+    QPainter painter(&m_retainedImage);
+    painter.setRenderHint(QPainter::Antialiasing);
+    bool first = true;
+    for (QSGSoftwareRenderableNode *node : qAsConst(m_retainedNodes)) {
+        // The first node is the background and needs to be painted without blending
+        node->paintRetained(&painter, first);
+        first = false;
+    }
+    m_statistics.retainedNodesPainted += m_retainedNodes.size();
+    qCDebug(lc2DRender, "retained %d nodes", m_retainedNodes.size());
+
+    return m_retainedNodes.size();
+}
+
+void QSGAbstractSoftwareRenderer::releaseRetainedImage()
+{
+    m_retainedImage = QImage();
+    m_retainedNodes.clear();
+}
+
+/*
+    Sets the maximum number of bands, and so threads, used for painting.
+    The default is taken from QSG_SOFTWARE_RENDER_THREADS. 1 disables banding.
+*/
+void QSGAbstractSoftwareRenderer::setRenderThreadCount(int count)
+{
+    m_renderThreadCount = qMax(1, count);
+}
+
+/*
+    Returns the number of horizontal bands the render list can be painted in
+    in parallel by renderNodesInBands(), or 1 when it has to be painted by a
+    single painter. Banding needs a QImage with an integer device pixel ratio,
+    so that band edges fall on pixel rows, and no render nodes to be painted,
+    as these may use the painter or the device directly.
+*/
+int QSGAbstractSoftwareRenderer::renderBandCount(QPaintDevice *device, const QRegion &updateRegion) const
+{
+    const int threads = m_renderThreadCount;
+    if (threads < 2 || !device || device->devType() != QInternal::Image)
+        return 1;
+
+    const qreal dpr = device->devicePixelRatioF();
+    if (dpr != qreal(int(dpr)))
+        return 1;
+
+    const QRect updateRect = updateRegion.boundingRect();
+    if (updateRect.width() * updateRect.height() < qsg_minimum_banded_area)
+        return 1;
+
+    for (QSGSoftwareRenderableNode *node : m_renderableNodes) {
+        if (node->type() == QSGSoftwareRenderableNode::RenderNode && node->needsPainting())
+            return 1;
+    }
+
+    return qBound(1, updateRect.height() / qsg_minimum_band_height, threads);
+}
+
+/*
+    Paints the render list into \a image with one painter per band of
+    \a updateRect. Each band paints the same nodes with the same transforms,
+    only clipped to its own rows, so the result is identical to painting with
+    a single painter. As in renderNodes(), the bottom of the list is copied
+    from the retained image. The nodes are prepared on the calling thread
+    first, so that the state they update lazily while painting is only
+    written from one thread.
+*/
+QRegion QSGAbstractSoftwareRenderer::renderNodesInBands(QImage *image, const QRect &updateRect, int bandCount)
+{
+    QRegion dirtyRegion;
+    if (m_renderableNodes.isEmpty())
+        return dirtyRegion;
+
+    QSGSoftwareBandTarget target;
+    target.bits = image->bits();
+    target.width = image->width();
+    target.height = image->height();
+    target.bytesPerLine = image->bytesPerLine();
+    target.format = image->format();
+    target.devicePixelRatio = image->devicePixelRatioF();
+
+    // The retained image is updated here, so that the bands only read it
+    target.retainedImage = &m_retainedImage;
+    target.retainedCount = updateRetainedImage(image);
+    m_statistics.retainedNodes = target.retainedCount;
+    int index = 0;
+    for (QSGSoftwareRenderableNode *node : m_renderableNodes) {
+        const bool retained = index++ < target.retainedCount;
+        if (!node->needsPainting())
+            continue;
+        if (retained)
+            target.retainedRegion += node->dirtyRegion();
+        else
+            node->preparePaint(target.devicePixelRatio);
+    }
+
+    const int bandHeight = (updateRect.height() + bandCount - 1) / bandCount;
+    QVector<QRect> bands;
+    for (int y = updateRect.top(); y <= updateRect.bottom(); y += bandHeight)
+        bands.append(QRect(updateRect.left(), y, updateRect.width(), qMin(bandHeight, updateRect.bottom() + 1 - y)));
+
+    QMutex glyphMutex;
+    QSemaphore done;
+    for (int i = 1; i < bands.size(); ++i)
+        qsg_software_band_pool()->start(new QSGSoftwareBandPainter(m_renderableNodes, target, bands.at(i), &glyphMutex, &done));
+    qsg_paintBand(m_renderableNodes, target, bands.first(), &glyphMutex);
+    done.acquire(bands.size() - 1);
+
+    for (QSGSoftwareRenderableNode *node : m_renderableNodes) {
+        dirtyRegion += node->finishPainting();
+        node->countStaticFrame();
+    }
+
+    return dirtyRegion;
+}
+
+/*
+    Returns \a region, or a region covering it with no more rects than
+    QSG_SOFTWARE_MAX_DIRTY_RECTS allows. Scenes with many small moving items
+    produce regions of hundreds of rects, which make every following region
+    operation expensive. The bounding rect of such a region is split into a
+    grid of at most that many bins, and the bins touched by the region are
+    merged into one rect per run in each row of the grid. The returned
+    region may be larger than \a region, so it must only be used where
+    painting or flushing more than needed is harmless.
+*/
+QRegion QSGAbstractSoftwareRenderer::boundedRegion(const QRegion &region)
+{
+    const int maxRects = qsg_software_max_dirty_rects();
+    if (maxRects == 0 || region.rectCount() <= maxRects)
+        return region;
+
+    const QRect bounds = region.boundingRect();
+    if (maxRects == 1)
+        return bounds;
+
+    // Keep the bins roughly square
+    const int columns = qBound(1, qRound(qSqrt(qreal(maxRects) * bounds.width() / bounds.height())), maxRects);
+    const int rows = qMax(1, maxRects / columns);
+    const int binWidth = (bounds.width() + columns - 1) / columns;
+    const int binHeight = (bounds.height() + rows - 1) / rows;
+
+    QVarLengthArray<bool, 256> bins(columns * rows);
+    std::fill(bins.begin(), bins.end(), false);
+    for (const QRect &rect : region) {
+        const int left = (rect.left() - bounds.left()) / binWidth;
+        const int right = (rect.right() - bounds.left()) / binWidth;
+        const int top = (rect.top() - bounds.top()) / binHeight;
+        const int bottom = (rect.bottom() - bounds.top()) / binHeight;
+        for (int y = top; y <= bottom; ++y) {
+            for (int x = left; x <= right; ++x)
+                bins[y * columns + x] = true;
+        }
+    }
+
+    QVarLengthArray<QRect, 64> rects;
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            if (!bins[y * columns + x])
+                continue;
+            const int first = x;
+            while (x + 1 < columns && bins[y * columns + x + 1])
+                ++x;
+            const QRect binRect(bounds.left() + first * binWidth, bounds.top() + y * binHeight,
+                                (x - first + 1) * binWidth, binHeight);
+            rects.append(binRect & bounds);
+        }
+    }
+
+    QRegion bounded;
+    bounded.setRects(rects.constData(), rects.size());
+    return bounded;
+}
+
 void QSGAbstractSoftwareRenderer::buildRenderList()
 {
     // Clear the previous renderlist
@@ -154,6 +559,8 @@ void QSGAbstractSoftwareRenderer::buildRenderList()
 
 QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
 {
+    m_statistics = PaintStatistics();
+
     // Iterate through the renderlist from front to back
     // Objective is to update the dirty status and rects.
     for (auto i = m_renderableNodes.rbegin(); i != m_renderableNodes.rend(); ++i) {
@@ -195,6 +602,18 @@ QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
             QRegion prevDirty = node->previousDirtyRegion();
             if (!prevDirty.isNull())
                 m_dirtyRegion += prevDirty;
+
+            // The dirty region passed to the nodes behind may grow, as they
+            // are all painted again where it reaches, and the blended nodes
+            // on top of them are marked dirty there by the second pass.
+            // The obscured region must stay exact.
+            if (m_dirtyRegion.rectCount() > 1) {
+                const QRegion bounded = boundedRegion(m_dirtyRegion);
+                if (bounded.rectCount() < m_dirtyRegion.rectCount()) {
+                    m_dirtyRegion = bounded;
+                    ++m_statistics.boundedRegions;
+                }
+            }
         }
     }
 
@@ -219,9 +638,13 @@ QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
         }
 
         m_dirtyRegion += node->dirtyRegion();
+        if (node->needsPainting())
+            m_statistics.paintedPixels += qsg_regionArea(node->dirtyRegion());
     }
 
     QRegion updateRegion = m_dirtyRegion;
+    m_statistics.dirtyRects = updateRegion.rectCount();
+    m_statistics.dirtyPixels = qsg_regionArea(updateRegion);
 
     // Empty dirtyRegion
     m_dirtyRegion = QRegion();
@@ -279,6 +702,9 @@ void QSGAbstractSoftwareRenderer::nodeRemoved(QSGNode *node)
             dirtyRegion = renderable->boundingRectMax();
         m_dirtyRegion += dirtyRegion;
         m_nodes.remove(node);
+        // The retained image must not outlive its nodes
+        if (m_retainedNodes.contains(renderable))
+            releaseRetainedImage();
         delete renderable;
     }
 
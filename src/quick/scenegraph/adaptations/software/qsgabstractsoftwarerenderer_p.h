@@ -55,6 +55,8 @@
 
 #include <QtCore/QHash>
 #include <QtCore/QLinkedList>
+#include <QtCore/QVector>
+#include <QtGui/QImage>
 
 QT_BEGIN_NAMESPACE
 
@@ -77,8 +79,27 @@ public:
 
     void markDirty();
 
+    struct PaintStatistics
+    {
+        int dirtyRects = 0;         // rects in the update region
+        qint64 dirtyPixels = 0;     // area of the update region
+        qint64 paintedPixels = 0;   // area painted by all nodes, overdraw included
+        int boundedRegions = 0;     // dirty regions merged down to the rect limit
+        int retainedNodes = 0;      // nodes copied from the retained image
+        int retainedNodesPainted = 0; // nodes painted into the retained image
+    };
+    // only known after calling optimizeRenderList()
+    const PaintStatistics &paintStatistics() const { return m_statistics; }
+
+    static QRegion boundedRegion(const QRegion &region);
+
+    int renderThreadCount() const { return m_renderThreadCount; }
+    void setRenderThreadCount(int count);
+
 protected:
     QRegion renderNodes(QPainter *painter);
+    int renderBandCount(QPaintDevice *device, const QRegion &updateRegion) const;
+    QRegion renderNodesInBands(QImage *image, const QRect &updateRect, int bandCount);
     void buildRenderList();
     QRegion optimizeRenderList();
 
@@ -98,15 +119,24 @@ private:
     void nodeMatrixUpdated(QSGNode *node);
     void nodeOpacityUpdated(QSGNode *node);
 
+    int updateRetainedImage(QPaintDevice *device);
+    void releaseRetainedImage();
+
     QHash<QSGNode*, QSGSoftwareRenderableNode*> m_nodes;
     QLinkedList<QSGSoftwareRenderableNode*> m_renderableNodes;
 
     QSGSimpleRectNode *m_background;
+    int m_renderThreadCount;
 
     QRegion m_dirtyRegion;
     QRegion m_obscuredRegion;
     qreal m_devicePixelRatio = 1;
     bool m_isOpaque = false;
+    PaintStatistics m_statistics;
+
+    // Unchanged bottom of the render list, painted into one image
+    QImage m_retainedImage;
+    QVector<QSGSoftwareRenderableNode*> m_retainedNodes;
 
     QSGSoftwareRenderableNodeUpdater *m_nodeUpdater;
 };
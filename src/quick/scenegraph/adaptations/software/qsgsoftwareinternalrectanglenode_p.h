@@ -76,6 +76,7 @@ public:
 
     void update() override;
 
+    void preparePaint(qreal devicePixelRatio);
     void paint(QPainter *);
 
     bool isOpaque() const;
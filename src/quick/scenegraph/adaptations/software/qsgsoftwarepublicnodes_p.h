@@ -103,6 +103,7 @@ public:
     void setOwnsTexture(bool owns) override { m_owns = owns; }
     bool ownsTexture() const override { return m_owns; }
 
+    void preparePaint();
     void paint(QPainter *painter);
 
 private:
@@ -82,6 +82,7 @@ QSGSoftwareRenderableNode::QSGSoftwareRenderableNode(NodeType type, QSGNode *nod
     , m_isDirty(true)
     , m_hasClipRegion(false)
     , m_opacity(1.0f)
+    , m_staticFrameCount(0)
 {
     switch (m_nodeType) {
     case QSGSoftwareRenderableNode::SimpleRect:
@@ -135,6 +136,7 @@ void QSGSoftwareRenderableNode::update()
     // Update the Node properties
     m_isDirty = true;
     m_isOpaque = false;
+    m_staticFrameCount = 0;
 
     QRectF boundingRect;
 
@@ -249,11 +251,9 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
 
     // Check for don't paint conditions
     if (m_nodeType != RenderNode) {
-        if (!m_isDirty || qFuzzyIsNull(m_opacity) || m_dirtyRegion.isEmpty()) {
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return QRegion();
-        }
+        if (needsPainting())
+            paint(painter, forceOpaquePainting);
+        return finishPainting();
     } else {
         if (!m_isDirty || qFuzzyIsNull(m_opacity)) {
             m_isDirty = false;
@@ -285,13 +285,70 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
             return br;
         }
     }
+}
 
+bool QSGSoftwareRenderableNode::needsPainting() const
+{
+    if (!m_isDirty || qFuzzyIsNull(m_opacity))
+        return false;
+    return m_nodeType == RenderNode || !m_dirtyRegion.isEmpty();
+}
+
+/*
+    Updates the state that painting the node would otherwise update lazily,
+    so that paint() only reads from the node.
+*/
+void QSGSoftwareRenderableNode::preparePaint(qreal devicePixelRatio)
+{
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::Rectangle:
+        m_handle.rectangleNode->preparePaint(devicePixelRatio);
+        break;
+    case QSGSoftwareRenderableNode::SimpleImage:
+        static_cast<QSGSoftwareImageNode *>(m_handle.simpleImageNode)->preparePaint();
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+    Paints the dirty region of the node without changing its dirty state, so
+    that the node can be painted into several parts of the target, limited
+    by \a clipRect, before finishPainting() is called. Render nodes are not
+    supported, they are only rendered through renderNode().
+*/
+void QSGSoftwareRenderableNode::paint(QPainter *painter, bool forceOpaquePainting, const QRect &clipRect)
+{
+    Q_ASSERT(m_nodeType != RenderNode);
+
+    // m_dirtyRegion already accounts for clipRegion
+    paintClipped(painter, clipRect.isNull() ? m_dirtyRegion : m_dirtyRegion & clipRect, forceOpaquePainting);
+}
+
+/*
+    Paints everything the node covers, regardless of its dirty state. This is
+    used to paint the node into the retained image of the renderer, which is
+    then copied to the dirty parts of the target in later frames.
+*/
+void QSGSoftwareRenderableNode::paintRetained(QPainter *painter, bool forceOpaquePainting)
+{
+    Q_ASSERT(m_nodeType != RenderNode);
+
+    if (qFuzzyIsNull(m_opacity))
+        return;
+
+    // m_boundingRectMax is already clipped to the bounding rect of clipRegion
+    paintClipped(painter, QRegion(m_boundingRectMax), forceOpaquePainting);
+}
+
+void QSGSoftwareRenderableNode::paintClipped(QPainter *painter, const QRegion &clipRegion, bool forceOpaquePainting)
+{
     painter->save();
     painter->setOpacity(m_opacity);
 
-    // Set clipRegion to m_dirtyRegion (in world coordinates, so must be done before the setTransform below)
-    // as m_dirtyRegion already accounts for clipRegion
-    painter->setClipRegion(m_dirtyRegion, Qt::ReplaceClip);
+    // Set the clip region in world coordinates, so must be done before the setTransform below
+    painter->setClipRegion(clipRegion, Qt::ReplaceClip);
     if (m_clipRegion.rectCount() > 1)
         painter->setClipRegion(m_clipRegion, Qt::IntersectClip);
 
@@ -346,6 +403,17 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     }
 
     painter->restore();
+}
+
+QRegion QSGSoftwareRenderableNode::finishPainting()
+{
+    Q_ASSERT(m_nodeType != RenderNode || !needsPainting());
+
+    if (!needsPainting()) {
+        m_isDirty = false;
+        m_dirtyRegion = QRegion();
+        return QRegion();
+    }
 
     QRegion areaToBeFlushed = m_dirtyRegion;
     m_previousDirtyRegion = QRegion(m_boundingRectMax);
@@ -60,6 +60,8 @@
 #include <QtQuick/qsgimagenode.h>
 #include <QtQuick/qsgninepatchnode.h>
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 class QSGSimpleRectNode;
@@ -98,6 +100,11 @@ public:
     void update();
 
     QRegion renderNode(QPainter *painter, bool forceOpaquePainting = false);
+    bool needsPainting() const;
+    void preparePaint(qreal devicePixelRatio);
+    void paint(QPainter *painter, bool forceOpaquePainting = false, const QRect &clipRect = QRect());
+    QRegion finishPainting();
+    void paintRetained(QPainter *painter, bool forceOpaquePainting = false);
     QRect boundingRectMin() const { return m_boundingRectMin; }
     QRect boundingRectMax() const { return m_boundingRectMax; }
     NodeType type() const { return m_nodeType; }
@@ -122,7 +129,12 @@ public:
     QRegion previousDirtyRegion(bool wasRemoved = false) const;
     QRegion dirtyRegion() const;
 
+    int staticFrameCount() const { return m_staticFrameCount; }
+    void countStaticFrame() { if (m_staticFrameCount < std::numeric_limits<int>::max()) ++m_staticFrameCount; }
+
 private:
+    void paintClipped(QPainter *painter, const QRegion &clipRegion, bool forceOpaquePainting);
+
     union RenderableNodeHandle {
         QSGNode *node;
         QSGSimpleRectNode *simpleRectNode;
@@ -154,6 +166,9 @@ private:
 
     QRect m_boundingRectMin;
     QRect m_boundingRectMax;
+
+    // Number of frames rendered since the node last changed
+    int m_staticFrameCount;
 };
 
 QT_END_NAMESPACE
@@ -46,6 +46,7 @@
 
 #include <QtGui/QPaintDevice>
 #include <QtGui/QBackingStore>
+#include <QtGui/QImage>
 #include <QElapsedTimer>
 
 Q_LOGGING_CATEGORY(lcRenderer, "qt.scenegraph.softwarecontext.renderer")
@@ -147,22 +148,38 @@ void QSGSoftwareRenderer::render()
         m_paintDevice = m_backingStore->paintDevice();
     }
 
-    QPainter painter(m_paintDevice);
-    painter.setRenderHint(QPainter::Antialiasing);
-    auto rc = static_cast<QSGSoftwareRenderContext *>(context());
-    QPainter *prevPainter = rc->m_activePainter;
-    rc->m_activePainter = &painter;
-
-    // Render the contents Renderlist
-    m_flushRegion = renderNodes(&painter);
-    qint64 renderTime = renderTimer.elapsed();
+    // Large updates of image backed windows are painted in horizontal bands
+    // on several threads
+    const int bandCount = renderBandCount(m_paintDevice, updateRegion);
+    qint64 renderTime = 0;
+    if (bandCount > 1) {
+        m_flushRegion = renderNodesInBands(static_cast<QImage *>(m_paintDevice), updateRegion.boundingRect(), bandCount);
+        renderTime = renderTimer.elapsed();
+    } else {
+        QPainter painter(m_paintDevice);
+        painter.setRenderHint(QPainter::Antialiasing);
+        auto rc = static_cast<QSGSoftwareRenderContext *>(context());
+        QPainter *prevPainter = rc->m_activePainter;
+        rc->m_activePainter = &painter;
+
+        // Render the contents Renderlist
+        m_flushRegion = renderNodes(&painter);
+        renderTime = renderTimer.elapsed();
+
+        painter.end();
+        rc->m_activePainter = prevPainter;
+    }
 
-    painter.end();
     if (m_backingStore != nullptr)
         m_backingStore->endPaint();
 
-    rc->m_activePainter = prevPainter;
-    qCDebug(lcRenderer) << "render" << m_flushRegion << buildRenderListTime << optimizeRenderListTime << renderTime;
+    // Flushing more than was painted is harmless, flushing many rects is not
+    m_flushRegion = boundedRegion(m_flushRegion);
+
+    const PaintStatistics &stats = paintStatistics();
+    qCDebug(lcRenderer) << "render" << m_flushRegion << buildRenderListTime << optimizeRenderListTime << renderTime << "bands:" << bandCount
+                        << "dirty rects:" << stats.dirtyRects << "dirty pixels:" << stats.dirtyPixels
+                        << "painted pixels:" << stats.paintedPixels << "bounded regions:" << stats.boundedRegions;
 }
 
 QT_END_NAMESPACE
@@ -56,6 +56,7 @@
 #include <QtGui/QOpenGLFunctions_3_2_Core>
 
 #include <private/qnumeric_p.h>
+#include <private/qsimd_p.h>
 #include <private/qquickprofiler_p.h>
 #include "qsgmaterialshader_p.h"
 
@@ -791,12 +792,17 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     }
 
     m_bufferStrategy = GL_STATIC_DRAW;
+    m_partialBufferUpload = false;
     if (Q_UNLIKELY(qEnvironmentVariableIsSet("QSG_RENDERER_BUFFER_STRATEGY"))) {
         const QByteArray strategy = qgetenv("QSG_RENDERER_BUFFER_STRATEGY");
-        if (strategy == "dynamic")
+        if (strategy == "dynamic") {
             m_bufferStrategy = GL_DYNAMIC_DRAW;
-        else if (strategy == "stream")
+        } else if (strategy == "stream") {
             m_bufferStrategy = GL_STREAM_DRAW;
+        } else if (strategy == "partial") {
+            m_bufferStrategy = GL_DYNAMIC_DRAW;
+            m_partialBufferUpload = true;
+        }
     }
 
     m_batchNodeThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_NODE_THRESHOLD", 64);
@@ -806,7 +812,8 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
         qDebug("Batch thresholds: nodes: %d vertices: %d",
                m_batchNodeThreshold, m_batchVertexThreshold);
         qDebug("Using buffer strategy: %s",
-               (m_bufferStrategy == GL_STATIC_DRAW
+               (m_partialBufferUpload ? "partial"
+                : m_bufferStrategy == GL_STATIC_DRAW
                 ? "static" : (m_bufferStrategy == GL_DYNAMIC_DRAW ? "dynamic" : "stream")));
     }
 
@@ -830,6 +837,7 @@ static void qsg_wipeBuffer(Buffer *buffer, QOpenGLFunctions *funcs)
     // 2. We're using dedicated buffers because of visualization or IBO workaround
     //    and the data something we malloced and must be freed.
     free(buffer->data);
+    free(buffer->uploaded);
 }
 
 static void qsg_wipeBatch(Batch *batch, QOpenGLFunctions *funcs, bool separateIndexBuffer)
@@ -909,13 +917,67 @@ void Renderer::unmap(Buffer *buffer, bool isIndexBuf)
         glGenBuffers(1, &buffer->id);
     GLenum target = isIndexBuf ? GL_ELEMENT_ARRAY_BUFFER : GL_ARRAY_BUFFER;
     glBindBuffer(target, buffer->id);
-    glBufferData(target, buffer->size, buffer->data, m_bufferStrategy);
+    if (m_partialBufferUpload)
+        uploadChangedRange(buffer, target);
+    else
+        glBufferData(target, buffer->size, buffer->data, m_bufferStrategy);
 
     if (!m_context->hasBrokenIndexBufferObjects() && m_visualizeMode == VisualizeNothing) {
         buffer->data = nullptr;
     }
 }
 
+static int qsg_firstDifference(const char *a, const char *b, int size)
+{
+    const int blockSize = 64;
+    int i = 0;
+    while (i + blockSize <= size && memcmp(a + i, b + i, blockSize) == 0)
+        i += blockSize;
+    while (i < size && a[i] == b[i])
+        ++i;
+    return i;
+}
+
+static int qsg_lastDifference(const char *a, const char *b, int begin, int end)
+{
+    const int blockSize = 64;
+    while (end - blockSize >= begin && memcmp(a + end - blockSize, b + end - blockSize, blockSize) == 0)
+        end -= blockSize;
+    while (end > begin && a[end - 1] == b[end - 1])
+        --end;
+    return end;
+}
+
+/* Used by the partial buffer strategy. A batch is always refilled completely
+ * on the CPU, but when a few of its nodes changed most of the bytes are the
+ * same as in the previous upload. Compare against a copy of what was uploaded
+ * last time and only send the range in between the first and the last
+ * changed byte. Buffers that changed size are reallocated and sent in full.
+ */
+void Renderer::uploadChangedRange(Buffer *buffer, GLenum target)
+{
+    if (!buffer->uploaded || buffer->uploadedSize != buffer->size) {
+        glBufferData(target, buffer->size, buffer->data, m_bufferStrategy);
+        free(buffer->uploaded);
+        buffer->uploaded = (char *) malloc(buffer->size);
+        Q_CHECK_PTR(buffer->uploaded);
+        memcpy(buffer->uploaded, buffer->data, buffer->size);
+        buffer->uploadedSize = buffer->size;
+        return;
+    }
+
+    const int begin = qsg_firstDifference(buffer->data, buffer->uploaded, buffer->size);
+    if (begin == buffer->size)
+        return;
+    const int end = qsg_lastDifference(buffer->data, buffer->uploaded, begin, buffer->size);
+
+    if (Q_UNLIKELY(debug_upload()))
+        qDebug() << "  - partial upload of buffer" << buffer->id << ":" << begin << "to" << end << "of" << buffer->size;
+
+    glBufferSubData(target, begin, end - begin, buffer->data + begin);
+    memcpy(buffer->uploaded + begin, buffer->data + begin, end - begin);
+}
+
 BatchRootInfo *Renderer::batchRootInfo(Node *node)
 {
     BatchRootInfo *info = node->rootInfo();
@@ -1700,6 +1762,94 @@ static inline int qsg_fixIndexCount(int iCount, GLenum drawMode) {
  * iBase: The starting index for this element in the batch
  */
 
+/*
+    The vertex transforms below operate on the position attribute of
+    vertices which are \a vSize bytes apart. The SSE2 versions handle two
+    vertices per step, the NEON versions one vertex per step with 2-lane
+    operations. Both produce the same results as Pt::map().
+ */
+static void qsg_translateVertices(char *vdata, int vCount, int vSize, float dx, float dy)
+{
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128 t = _mm_setr_ps(dx, dy, dx, dy);
+    for (; i + 1 < vCount; i += 2) {
+        __m128 p = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(vdata));
+        p = _mm_loadh_pi(p, reinterpret_cast<const __m64 *>(vdata + vSize));
+        p = _mm_add_ps(p, t);
+        _mm_storel_pi(reinterpret_cast<__m64 *>(vdata), p);
+        _mm_storeh_pi(reinterpret_cast<__m64 *>(vdata + vSize), p);
+        vdata += 2 * vSize;
+    }
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    const float32x2_t t = { dx, dy };
+    for (; i < vCount; ++i) {
+        float *p = reinterpret_cast<float *>(vdata);
+        vst1_f32(p, vadd_f32(vld1_f32(p), t));
+        vdata += vSize;
+    }
+#endif
+    for (; i < vCount; ++i) {
+        Pt *p = (Pt *) vdata;
+        p->x += dx;
+        p->y += dy;
+        vdata += vSize;
+    }
+}
+
+static void qsg_mapVertices(char *vdata, int vCount, int vSize, const QMatrix4x4 &matrix)
+{
+    int i = 0;
+#if defined(__SSE2__)
+    const float *m = matrix.constData();
+    const __m128 c0 = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+    const __m128 c1 = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+    const __m128 c3 = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+    for (; i + 1 < vCount; i += 2) {
+        __m128 p = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(vdata));
+        p = _mm_loadh_pi(p, reinterpret_cast<const __m64 *>(vdata + vSize));
+        const __m128 xs = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 ys = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+        p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, c0), _mm_mul_ps(ys, c1)), c3);
+        _mm_storel_pi(reinterpret_cast<__m64 *>(vdata), p);
+        _mm_storeh_pi(reinterpret_cast<__m64 *>(vdata + vSize), p);
+        vdata += 2 * vSize;
+    }
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    const float *m = matrix.constData();
+    const float32x2_t c0 = { m[0], m[1] };
+    const float32x2_t c1 = { m[4], m[5] };
+    const float32x2_t c3 = { m[12], m[13] };
+    for (; i < vCount; ++i) {
+        float *p = reinterpret_cast<float *>(vdata);
+        const float32x2_t v = vld1_f32(p);
+        const float32x2_t r = vadd_f32(vmla_lane_f32(vmul_lane_f32(c0, v, 0), c1, v, 1), c3);
+        vst1_f32(p, r);
+        vdata += vSize;
+    }
+#endif
+    for (; i < vCount; ++i) {
+        ((Pt *) vdata)->map(matrix);
+        vdata += vSize;
+    }
+}
+
+static void qsg_fillZOrder(float *vzorder, int vCount, float zorder)
+{
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128 z = _mm_set1_ps(zorder);
+    for (; i + 3 < vCount; i += 4)
+        _mm_storeu_ps(vzorder + i, z);
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    const float32x4_t z = vdupq_n_f32(zorder);
+    for (; i + 3 < vCount; i += 4)
+        vst1q_f32(vzorder + i, z);
+#endif
+    for (; i < vCount; ++i)
+        vzorder[i] = zorder;
+}
+
 void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, quint16 *iBase, int *indexCount)
 {
     if (Q_UNLIKELY(debug_upload())) qDebug() << "  - uploading element:" << e << e->node << (void *) *vertexData << (qintptr) (*zData - *vertexData) << (qintptr) (*indexData - *vertexData);
@@ -1714,24 +1864,15 @@ void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData,
     // apply vertex transform..
     char *vdata = *vertexData + vaOffset;
     if (((const QMatrix4x4_Accessor &) localx).flagBits == 1) {
-        for (int i=0; i<vCount; ++i) {
-            Pt *p = (Pt *) vdata;
-            p->x += ((const QMatrix4x4_Accessor &) localx).m[3][0];
-            p->y += ((const QMatrix4x4_Accessor &) localx).m[3][1];
-            vdata += vSize;
-        }
+        qsg_translateVertices(vdata, vCount, vSize,
+                              ((const QMatrix4x4_Accessor &) localx).m[3][0],
+                              ((const QMatrix4x4_Accessor &) localx).m[3][1]);
     } else if (((const QMatrix4x4_Accessor &) localx).flagBits > 1) {
-        for (int i=0; i<vCount; ++i) {
-            ((Pt *) vdata)->map(localx);
-            vdata += vSize;
-        }
+        qsg_mapVertices(vdata, vCount, vSize, localx);
     }
 
     if (m_useDepthBuffer) {
-        float *vzorder = (float *) *zData;
-        float zorder = 1.0f - e->order * m_zRange;
-        for (int i=0; i<vCount; ++i)
-            vzorder[i] = zorder;
+        qsg_fillZOrder((float *) *zData, vCount, 1.0f - e->order * m_zRange);
         *zData += vCount * sizeof(float);
     }
 
@@ -1992,6 +2133,9 @@ void Renderer::uploadBatch(Batch *b)
 
         b->needsUpload = false;
 
+        ++m_frame_counters.uploadedBatches;
+        m_frame_counters.uploadedBytes += b->vbo.size + (separateIndexBuffer ? b->ibo.size : 0);
+
         if (Q_UNLIKELY(debug_render()))
             b->uploadedThisFrame = true;
 }
@@ -2732,6 +2876,8 @@ void Renderer::render()
     if (m_context->separateIndexBuffer() && largestIBO * 2 < m_indexUploadPool.size())
         m_indexUploadPool.resize(largestIBO * 2);
 
+    m_frame_counters.batches = m_opaqueBatches.size() + m_alphaBatches.size();
+
     renderBatches();
 
     if (Q_UNLIKELY(debug_render())) {
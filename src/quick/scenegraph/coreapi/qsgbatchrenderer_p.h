@@ -63,6 +63,8 @@
 
 #include <QtGui/QOpenGLFunctions>
 
+class NodesTest;
+
 QT_BEGIN_NAMESPACE
 
 class QOpenGLVertexArrayObject;
@@ -300,6 +302,9 @@ struct Buffer {
     // Data is only valid while preparing the upload. Exception is if we are using the
     // broken IBO workaround or we are using a visualization mode.
     char *data;
+    // Copy of the last uploaded data, only used with the partial upload strategy.
+    char *uploaded;
+    int uploadedSize;
 };
 
 struct Element {
@@ -641,9 +646,11 @@ private:
     };
 
     friend class Updater;
+    friend class ::NodesTest;
 
     void map(Buffer *buffer, int size, bool isIndexBuf = false);
     void unmap(Buffer *buffer, bool isIndexBuf = false);
+    void uploadChangedRange(Buffer *buffer, GLenum target);
 
     void buildRenderListsFromScratch();
     void buildRenderListsForTaggedRoots();
@@ -719,6 +726,7 @@ private:
     int m_renderOrderRebuildUpper;
 
     GLuint m_bufferStrategy;
+    bool m_partialBufferUpload;
     int m_batchNodeThreshold;
     int m_batchVertexThreshold;
 
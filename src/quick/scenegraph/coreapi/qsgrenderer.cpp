@@ -207,7 +207,7 @@ void QSGRenderer::renderScene(const QSGBindable &bindable)
         return;
 
     m_is_rendering = true;
-
+    m_frame_counters = FrameCounters();
 
     bool profileFrames = QSG_LOG_TIME_RENDERER().isDebugEnabled();
     if (profileFrames)
@@ -97,6 +97,14 @@ public:
 
     void clearChangedFlag() { m_changed_emitted = false; }
 
+    struct FrameCounters {
+        int batches = 0;
+        int uploadedBatches = 0;
+        qint64 uploadedBytes = 0;
+    };
+    // Counters of the last renderScene(), filled in by renderers that batch
+    const FrameCounters &frameCounters() const { return m_frame_counters; }
+
 protected:
     virtual void render() = 0;
 
@@ -115,6 +123,8 @@ protected:
 
     QSGRenderContext *m_context;
 
+    FrameCounters m_frame_counters;
+
 private:
     QSGNodeUpdater *m_node_updater;
 
@@ -49,15 +49,112 @@
 
 #include <private/qquickprofiler_p.h>
 #include <QElapsedTimer>
+#include <QtCore/qmutex.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qthreadpool.h>
+#include <QtQuick/qquickwindow.h>
 
 QT_BEGIN_NAMESPACE
 
 static QElapsedTimer qsg_render_timer;
 
+Q_GLOBAL_STATIC(QThreadPool, qsg_distancefield_thread_pool)
+
+// Batches with at least this many new glyphs have their distance fields
+// generated on worker threads. The glyphs are left out of the glyph nodes
+// until their distance field has been uploaded, so the frame that first
+// shows a large amount of new text is not blocked on rasterization.
+static int qsg_distancefield_async_threshold()
+{
+    static const int threshold = qEnvironmentVariableIsSet("QSG_DISTANCEFIELD_ASYNC_THRESHOLD")
+            ? qEnvironmentVariableIntValue("QSG_DISTANCEFIELD_ASYNC_THRESHOLD")
+            : 64;
+    return threshold;
+}
+
+static const int qsg_distancefield_glyphs_per_task = 16;
+
+/*
+    Lives on the thread of the windows that render with a glyph cache and asks
+    them for a new frame. Worker threads post to it instead of accessing the
+    windows directly.
+*/
+class QSGDistanceFieldGlyphCacheNotifier : public QObject
+{
+public:
+    void updateWindows()
+    {
+        for (int i = windows.size() - 1; i >= 0; --i) {
+            if (windows.at(i))
+                windows.at(i)->update();
+            else
+                windows.removeAt(i);
+        }
+    }
+
+    // Only modified by the cache while the GUI thread is blocked in sync.
+    QVector<QPointer<QQuickWindow> > windows;
+};
+
+class QSGDistanceFieldGenerationResults
+{
+public:
+    QMutex mutex;
+    QList<QDistanceField> distanceFields;
+    int pendingTasks = 0;
+    // Cleared when the cache is destroyed.
+    QSGDistanceFieldGlyphCacheNotifier *notifier = nullptr;
+};
+
+class QSGDistanceFieldGenerationTask : public QRunnable
+{
+public:
+    QSGDistanceFieldGenerationTask(const QSharedPointer<QSGDistanceFieldGenerationResults> &results,
+                                   bool doubleGlyphResolution)
+        : m_results(results)
+        , m_doubleGlyphResolution(doubleGlyphResolution)
+    {
+    }
+
+    void addGlyph(glyph_t glyph, const QPainterPath &path)
+    {
+        m_glyphs.append(glyph);
+        m_paths.append(path);
+    }
+
+    int glyphCount() const { return m_glyphs.size(); }
+
+    void run() override
+    {
+        QList<QDistanceField> distanceFields;
+        distanceFields.reserve(m_glyphs.size());
+        for (int i = 0; i < m_glyphs.size(); ++i)
+            distanceFields.append(QDistanceField(m_paths.at(i), m_glyphs.at(i), m_doubleGlyphResolution));
+
+        QMutexLocker lock(&m_results->mutex);
+        m_results->distanceFields.append(distanceFields);
+        --m_results->pendingTasks;
+
+        // The glyphs are uploaded by the next update() of the cache, which
+        // only happens when a window using it renders a frame. Posted events
+        // are discarded if the notifier is deleted before they are delivered.
+        if (QSGDistanceFieldGlyphCacheNotifier *notifier = m_results->notifier)
+            QMetaObject::invokeMethod(notifier, [notifier]() { notifier->updateWindows(); }, Qt::QueuedConnection);
+    }
+
+private:
+    QSharedPointer<QSGDistanceFieldGenerationResults> m_results;
+    QVector<glyph_t> m_glyphs;
+    QVector<QPainterPath> m_paths;
+    bool m_doubleGlyphResolution;
+};
+
 QSGDistanceFieldGlyphCache::Texture QSGDistanceFieldGlyphCache::s_emptyTexture;
 
 QSGDistanceFieldGlyphCache::QSGDistanceFieldGlyphCache(const QRawFont &font)
     : m_pendingGlyphs(64)
+    , m_notifier(nullptr)
 {
     Q_ASSERT(font.isValid());
 
@@ -75,6 +172,12 @@ QSGDistanceFieldGlyphCache::QSGDistanceFieldGlyphCache(const QRawFont &font)
 
 QSGDistanceFieldGlyphCache::~QSGDistanceFieldGlyphCache()
 {
+    if (m_generationResults) {
+        QMutexLocker lock(&m_generationResults->mutex);
+        m_generationResults->notifier = nullptr;
+    }
+    if (m_notifier)
+        m_notifier->deleteLater();
 }
 
 QSGDistanceFieldGlyphCache::GlyphData &QSGDistanceFieldGlyphCache::emptyData(glyph_t glyph)
@@ -166,16 +269,49 @@ void QSGDistanceFieldGlyphCache::update()
 {
     m_populatingGlyphs.clear();
 
+    if (m_generationResults)
+        storeGeneratedGlyphs();
+
     if (m_pendingGlyphs.isEmpty())
         return;
 
+    const int pendingGlyphsSize = m_pendingGlyphs.size();
+    const int asyncThreshold = qsg_distancefield_async_threshold();
+    if (asyncThreshold > 0 && pendingGlyphsSize >= asyncThreshold && m_notifier) {
+        if (!m_generationResults) {
+            m_generationResults.reset(new QSGDistanceFieldGenerationResults);
+            m_generationResults->notifier = m_notifier;
+        }
+
+        QSGDistanceFieldGenerationTask *task = nullptr;
+        for (int i = 0; i < pendingGlyphsSize; ++i) {
+            if (!task) {
+                task = new QSGDistanceFieldGenerationTask(m_generationResults, m_doubleGlyphResolution);
+            }
+            GlyphData &gd = glyphData(m_pendingGlyphs.at(i));
+            task->addGlyph(m_pendingGlyphs.at(i), gd.path);
+            gd.path = QPainterPath();
+            if (task->glyphCount() == qsg_distancefield_glyphs_per_task || i == pendingGlyphsSize - 1) {
+                {
+                    QMutexLocker lock(&m_generationResults->mutex);
+                    ++m_generationResults->pendingTasks;
+                }
+                qsg_distancefield_thread_pool()->start(task);
+                task = nullptr;
+            }
+        }
+
+        qCDebug(QSG_LOG_TIME_GLYPH, "distancefield: %d glyphs scheduled for generation", pendingGlyphsSize);
+        m_pendingGlyphs.reset();
+        return;
+    }
+
     bool profileFrames = QSG_LOG_TIME_GLYPH().isDebugEnabled();
     if (profileFrames)
         qsg_render_timer.start();
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphAdaptationLayerFrame);
 
     QList<QDistanceField> distanceFields;
-    const int pendingGlyphsSize = m_pendingGlyphs.size();
     distanceFields.reserve(pendingGlyphsSize);
     for (int i = 0; i < pendingGlyphsSize; ++i) {
         GlyphData &gd = glyphData(m_pendingGlyphs.at(i));
@@ -215,6 +351,33 @@ void QSGDistanceFieldGlyphCache::update()
                                         (qint64)count);
 }
 
+/*
+    Uploads the distance fields that worker threads have finished since the
+    last update. Glyphs that were evicted from the cache while their distance
+    field was being generated are skipped.
+*/
+void QSGDistanceFieldGlyphCache::storeGeneratedGlyphs()
+{
+    QList<QDistanceField> distanceFields;
+    {
+        QMutexLocker lock(&m_generationResults->mutex);
+        distanceFields.swap(m_generationResults->distanceFields);
+        if (m_generationResults->pendingTasks == 0 && distanceFields.isEmpty())
+            m_generationResults.reset();
+    }
+
+    for (int i = distanceFields.size() - 1; i >= 0; --i) {
+        if (!glyphData(distanceFields.at(i).glyph()).texCoord.isValid())
+            distanceFields.removeAt(i);
+    }
+
+    if (distanceFields.isEmpty())
+        return;
+
+    storeGlyphs(distanceFields);
+    qCDebug(QSG_LOG_TIME_GLYPH, "distancefield: %d generated glyphs uploaded", distanceFields.size());
+}
+
 void QSGDistanceFieldGlyphCache::setGlyphsPosition(const QList<GlyphPosition> &glyphs)
 {
     QVector<quint32> invalidatedGlyphs;
@@ -244,7 +407,24 @@ void QSGDistanceFieldGlyphCache::setGlyphsPosition(const QList<GlyphPosition> &g
 
 void QSGDistanceFieldGlyphCache::registerOwnerElement(QQuickItem *ownerElement)
 {
-    Q_UNUSED(ownerElement);
+    // Remember the windows that render with this cache, so that they can be
+    // asked for a new frame once asynchronously generated glyphs are ready.
+    // This is called from updatePaintNode(), while the GUI thread is blocked.
+    QQuickWindow *window = ownerElement ? ownerElement->window() : nullptr;
+    if (!window)
+        return;
+    if (!m_notifier) {
+        m_notifier = new QSGDistanceFieldGlyphCacheNotifier;
+        m_notifier->moveToThread(window->thread());
+    }
+    QVector<QPointer<QQuickWindow> > &windows = m_notifier->windows;
+    for (int i = windows.size() - 1; i >= 0; --i) {
+        if (windows.at(i) == window)
+            return;
+        if (!windows.at(i))
+            windows.removeAt(i);
+    }
+    windows.append(window);
 }
 
 void QSGDistanceFieldGlyphCache::unregisterOwnerElement(QQuickItem *ownerElement)
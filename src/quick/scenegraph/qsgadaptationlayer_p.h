@@ -78,6 +78,8 @@ class QSGInternalImageNode;
 class QSGPainterNode;
 class QSGInternalRectangleNode;
 class QSGGlyphNode;
+class QSGDistanceFieldGenerationResults;
+class QSGDistanceFieldGlyphCacheNotifier;
 class QSGRootNode;
 class QSGSpriteNode;
 class QSGRenderNode;
@@ -502,6 +504,8 @@ protected:
 
     void updateTexture(uint oldTex, uint newTex, const QSize &newTexSize);
 
+    void storeGeneratedGlyphs();
+
     inline bool containsGlyph(glyph_t glyph);
     uint textureIdForGlyph(glyph_t glyph) const;
 
@@ -524,6 +528,8 @@ private:
     QDataBuffer<glyph_t> m_pendingGlyphs;
     QSet<glyph_t> m_populatingGlyphs;
     QSGDistanceFieldGlyphConsumerList m_registeredNodes;
+    QSGDistanceFieldGlyphCacheNotifier *m_notifier;
+    QSharedPointer<QSGDistanceFieldGenerationResults> m_generationResults;
 
     static Texture s_emptyTexture;
 };
@@ -50,6 +50,7 @@
 #include <qopenglframebufferobject.h>
 #include <qmath.h>
 #include "qsgcontext_p.h"
+#include "qsgdistancefielddiskcache_p.h"
 
 
 #if !defined(QT_OPENGL_ES_2)
@@ -75,6 +76,7 @@ QSGDefaultDistanceFieldGlyphCache::QSGDefaultDistanceFieldGlyphCache(QOpenGLCont
     , m_blitProgram(nullptr)
     , m_blitBuffer(QOpenGLBuffer::VertexBuffer)
     , m_fboGuard(nullptr)
+    , m_diskCache(nullptr)
     , m_funcs(c->functions())
 #if !defined(QT_OPENGL_ES_2)
     , m_coreFuncs(nullptr)
@@ -93,7 +95,8 @@ QSGDefaultDistanceFieldGlyphCache::QSGDefaultDistanceFieldGlyphCache(QOpenGLCont
     m_coreProfile = (c->format().profile() == QSurfaceFormat::CoreProfile);
 
     // Load a pregenerated cache if the font contains one
-    loadPregeneratedCache(font);
+    if (!loadPregeneratedCache(font))
+        m_diskCache = QSGDistanceFieldDiskCache::create(m_referenceFont, m_doubleGlyphResolution);
 }
 
 QSGDefaultDistanceFieldGlyphCache::~QSGDefaultDistanceFieldGlyphCache()
@@ -106,6 +109,7 @@ QSGDefaultDistanceFieldGlyphCache::~QSGDefaultDistanceFieldGlyphCache()
 
     delete m_blitProgram;
     delete m_areaAllocator;
+    delete m_diskCache;
 }
 
 void QSGDefaultDistanceFieldGlyphCache::requestGlyphs(const QSet<glyph_t> &glyphs)
@@ -179,10 +183,43 @@ void QSGDefaultDistanceFieldGlyphCache::requestGlyphs(const QSet<glyph_t> &glyph
     }
 
     setGlyphsPosition(glyphPositions);
+
+    // Glyphs found in the disk cache are uploaded right away instead of
+    // having their distance field generated.
+    if (m_diskCache) {
+        QVector<glyph_t> cachedIndexes;
+        QList<QDistanceField> cachedGlyphs;
+        for (int i = glyphsToRender.size() - 1; i >= 0; --i) {
+            const glyph_t glyphIndex = glyphsToRender.at(i);
+            QDistanceField glyph = m_diskCache->glyph(glyphIndex);
+            if (glyph.isNull())
+                continue;
+            cachedIndexes.append(glyphIndex);
+            cachedGlyphs.append(glyph);
+            glyphData(glyphIndex).path = QPainterPath();
+            glyphsToRender.remove(i);
+        }
+        if (!cachedIndexes.isEmpty())
+            uploadGlyphs(cachedIndexes, cachedGlyphs);
+    }
+
     markGlyphsToRender(glyphsToRender);
 }
 
 void QSGDefaultDistanceFieldGlyphCache::storeGlyphs(const QList<QDistanceField> &glyphs)
+{
+    QVector<glyph_t> glyphIndexes;
+    glyphIndexes.reserve(glyphs.size());
+    for (const QDistanceField &glyph : glyphs) {
+        glyphIndexes.append(glyph.glyph());
+        if (m_diskCache)
+            m_diskCache->insert(glyph);
+    }
+
+    uploadGlyphs(glyphIndexes, glyphs);
+}
+
+void QSGDefaultDistanceFieldGlyphCache::uploadGlyphs(const QVector<glyph_t> &glyphIndexes, const QList<QDistanceField> &glyphs)
 {
     typedef QHash<TextureInfo *, QVector<glyph_t> > GlyphTextureHash;
     typedef GlyphTextureHash::const_iterator GlyphTextureHashConstIt;
@@ -197,7 +234,7 @@ void QSGDefaultDistanceFieldGlyphCache::storeGlyphs(const QList<QDistanceField>
 
     for (int i = 0; i < glyphs.size(); ++i) {
         QDistanceField glyph = glyphs.at(i);
-        glyph_t glyphIndex = glyph.glyph();
+        glyph_t glyphIndex = glyphIndexes.at(i);
         TexCoord c = glyphTexCoord(glyphIndex);
         TextureInfo *texInfo = m_glyphsTexture.value(glyphIndex);
 
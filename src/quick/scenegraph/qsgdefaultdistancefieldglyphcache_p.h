@@ -62,6 +62,7 @@
 QT_BEGIN_NAMESPACE
 
 class QOpenGLSharedResourceGuard;
+class QSGDistanceFieldDiskCache;
 #if !defined(QT_OPENGL_ES_2)
 class QOpenGLFunctions_3_2_Core;
 #endif
@@ -99,6 +100,8 @@ private:
         TextureInfo(const QRect &preallocRect = QRect(0, 0, 1, 1)) : texture(0), allocatedArea(preallocRect) { }
     };
 
+    void uploadGlyphs(const QVector<glyph_t> &glyphIndexes, const QList<QDistanceField> &glyphs);
+
     void createTexture(TextureInfo * texInfo, int width, int height, const void *pixels);
     void createTexture(TextureInfo * texInfo, int width, int height);
     void resizeTexture(TextureInfo * texInfo, int width, int height);
@@ -152,6 +155,7 @@ private:
     QOpenGLVertexArrayObject m_vao;
 
     QOpenGLSharedResourceGuard *m_fboGuard;
+    QSGDistanceFieldDiskCache *m_diskCache;
     QOpenGLFunctions *m_funcs;
 #if !defined(QT_OPENGL_ES_2)
     QOpenGLFunctions_3_2_Core *m_coreFuncs;
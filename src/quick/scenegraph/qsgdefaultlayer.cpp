@@ -47,6 +47,7 @@
 #include <QtGui/private/qopenglextensions_p.h>
 
 #include <QtQuick/private/qsgdepthstencilbuffer_p.h>
+#include <QtQuick/private/qsgtexture_p.h>
 
 #ifdef QSG_DEBUG_FBO_OVERLAY
 DEFINE_BOOL_CONFIG_OPTION(qmlFboOverlay, QML_FBO_OVERLAY)
@@ -177,8 +178,13 @@ void QSGDefaultLayer::bind()
 bool QSGDefaultLayer::updateTexture()
 {
     bool doGrab = (m_live || m_grab) && m_dirtyTexture;
-    if (doGrab)
+    if (doGrab) {
+        // The layer is not grabbed again for textures whose upload would
+        // be deferred to a later frame.
+        qsg_suspendTextureUploadBudget();
         grab();
+        qsg_resumeTextureUploadBudget();
+    }
     if (m_grab)
         emit scheduledUpdateCompleted();
     m_grab = false;
@@ -0,0 +1,322 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsgdistancefielddiskcache_p.h"
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qlockfile.h>
+#include <QtCore/qsavefile.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtGui/private/qrawfont_p.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_LOGGING_CATEGORY(lcDistanceFieldDiskCache, "qt.scenegraph.distancefield.diskcache")
+
+/*
+    The file holds the distance fields of one font at one resolution:
+
+    Header   { char magic[4]; quint32 version; quint32 glyphCount; quint32 reserved; }
+    Index    { quint32 glyph; quint32 offset; quint16 width; quint16 height; } * glyphCount
+    Bitmaps  width * height bytes per glyph, at offset from the start of the file
+
+    All values are stored in host byte order; the file is only meant to be
+    reused on the device that wrote it.
+*/
+
+static const char qsg_distancefield_cache_magic[4] = { 'Q', 'S', 'D', 'F' };
+static const quint32 qsg_distancefield_cache_version = 1;
+
+// Newly generated glyphs are written once this many have been collected, so
+// that they are not lost if the application does not shut down cleanly.
+static const int qsg_distancefield_cache_save_threshold = 256;
+
+// Time to wait for another process that is writing the same file.
+static const int qsg_distancefield_cache_lock_timeout = 1000;
+
+// Maximum size of a single cache file in bytes, set through
+// QSG_DISTANCEFIELD_CACHE_MAX_SIZE in kilobytes. Glyphs that do not fit are
+// not stored.
+static qint64 qsg_distancefield_cache_max_size()
+{
+    static const qint64 maxSize = qint64(qEnvironmentVariableIsSet("QSG_DISTANCEFIELD_CACHE_MAX_SIZE")
+            ? qEnvironmentVariableIntValue("QSG_DISTANCEFIELD_CACHE_MAX_SIZE")
+            : 4096) * 1024;
+    return maxSize;
+}
+
+namespace {
+struct FileHeader {
+    char magic[4];
+    quint32 version;
+    quint32 glyphCount;
+    quint32 reserved;
+};
+
+struct FileIndexEntry {
+    quint32 glyph;
+    quint32 offset;
+    quint16 width;
+    quint16 height;
+};
+}
+
+/*
+    Returns a cache for \a font, or null if the disk cache is disabled or the
+    font cannot be identified. The cache is enabled by pointing the
+    QSG_DISTANCEFIELD_CACHE_DIR environment variable to a writable directory.
+*/
+QSGDistanceFieldDiskCache *QSGDistanceFieldDiskCache::create(const QRawFont &font, bool doubleGlyphResolution)
+{
+    static const QString cacheDir = qEnvironmentVariable("QSG_DISTANCEFIELD_CACHE_DIR");
+    if (cacheDir.isEmpty())
+        return nullptr;
+
+    // The head table carries a checksum of the whole font file, which
+    // together with the names identifies the font file.
+    const QByteArray head = font.fontTable("head");
+    if (head.isEmpty())
+        return nullptr;
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(font.familyName().toUtf8());
+    hash.addData(font.styleName().toUtf8());
+    hash.addData(head);
+    hash.addData(QByteArray::number(QRawFontPrivate::get(font)->fontEngine->glyphCount()));
+    hash.addData(QByteArray::number(QT_DISTANCEFIELD_BASEFONTSIZE(doubleGlyphResolution)));
+    hash.addData(QByteArray::number(QT_DISTANCEFIELD_SCALE(doubleGlyphResolution)));
+    hash.addData(QByteArray::number(QT_DISTANCEFIELD_RADIUS(doubleGlyphResolution)));
+
+    if (!QDir().mkpath(cacheDir)) {
+        qCWarning(lcDistanceFieldDiskCache, "Cannot create distance field cache directory %s",
+                  qPrintable(cacheDir));
+        return nullptr;
+    }
+
+    return new QSGDistanceFieldDiskCache(cacheDir + QLatin1Char('/')
+                                         + QString::fromLatin1(hash.result().toHex())
+                                         + QLatin1String(".qsgdf"));
+}
+
+QSGDistanceFieldDiskCache::QSGDistanceFieldDiskCache(const QString &fileName)
+    : m_file(fileName)
+{
+    load();
+}
+
+QSGDistanceFieldDiskCache::~QSGDistanceFieldDiskCache()
+{
+    if (!m_newGlyphs.isEmpty())
+        save();
+}
+
+void QSGDistanceFieldDiskCache::load()
+{
+    if (!m_file.open(QIODevice::ReadOnly))
+        return;
+
+    const qint64 size = m_file.size();
+    if (size < qint64(sizeof(FileHeader)))
+        return;
+
+    m_data = m_file.map(0, size);
+    if (!m_data)
+        return;
+
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(m_data);
+    if (memcmp(header->magic, qsg_distancefield_cache_magic, sizeof(header->magic)) != 0
+            || header->version != qsg_distancefield_cache_version
+            || qint64(sizeof(FileHeader) + header->glyphCount * sizeof(FileIndexEntry)) > size) {
+        qCDebug(lcDistanceFieldDiskCache, "Ignoring invalid cache file %s", qPrintable(m_file.fileName()));
+        return;
+    }
+
+    const FileIndexEntry *index = reinterpret_cast<const FileIndexEntry *>(m_data + sizeof(FileHeader));
+    m_entries.reserve(header->glyphCount);
+    for (quint32 i = 0; i < header->glyphCount; ++i) {
+        if (index[i].offset + qint64(index[i].width) * index[i].height > size) {
+            m_entries.clear();
+            return;
+        }
+        Entry entry;
+        entry.offset = index[i].offset;
+        entry.width = index[i].width;
+        entry.height = index[i].height;
+        m_entries.insert(index[i].glyph, entry);
+    }
+    m_fileSize = size;
+
+    qCDebug(lcDistanceFieldDiskCache, "Loaded %d glyphs from %s", m_entries.size(), qPrintable(m_file.fileName()));
+}
+
+void QSGDistanceFieldDiskCache::unload()
+{
+    // The old file may not be replaced while it is mapped on all platforms.
+    if (m_data) {
+        m_file.unmap(const_cast<uchar *>(m_data));
+        m_data = nullptr;
+    }
+    m_file.close();
+    m_entries.clear();
+    m_fileSize = 0;
+}
+
+/*
+    Returns the cached distance field for \a glyph, or a null distance field.
+    Note that the returned distance field does not know its glyph index.
+*/
+QDistanceField QSGDistanceFieldDiskCache::glyph(glyph_t glyph) const
+{
+    const auto newGlyph = m_newGlyphs.constFind(glyph);
+    if (newGlyph != m_newGlyphs.constEnd())
+        return *newGlyph;
+
+    const auto it = m_entries.constFind(glyph);
+    if (it == m_entries.constEnd())
+        return QDistanceField();
+
+    QDistanceField field(it->width, it->height);
+    memcpy(field.bits(), m_data + it->offset, size_t(it->width) * it->height);
+    return field;
+}
+
+void QSGDistanceFieldDiskCache::insert(const QDistanceField &glyph)
+{
+    if (glyph.isNull() || m_entries.contains(glyph.glyph()) || m_newGlyphs.contains(glyph.glyph()))
+        return;
+    if (glyph.width() > 0xffff || glyph.height() > 0xffff)
+        return;
+
+    const qint64 glyphSize = qint64(sizeof(FileIndexEntry)) + qint64(glyph.width()) * glyph.height();
+    if (m_fileSize + m_newGlyphsSize + glyphSize > qsg_distancefield_cache_max_size())
+        return;
+
+    m_newGlyphs.insert(glyph.glyph(), glyph);
+    m_newGlyphsSize += glyphSize;
+    if (m_newGlyphs.size() >= qsg_distancefield_cache_save_threshold)
+        save();
+}
+
+/*
+    Writes the cached and the newly inserted distance fields back to disk.
+
+    Other processes may write the same file. The file is locked while it is
+    written, and the glyphs they stored since it was loaded are kept.
+*/
+bool QSGDistanceFieldDiskCache::save()
+{
+    QLockFile lock(m_file.fileName() + QLatin1String(".lock"));
+    if (!lock.tryLock(qsg_distancefield_cache_lock_timeout)) {
+        qCDebug(lcDistanceFieldDiskCache, "Cannot lock %s, not saving", qPrintable(m_file.fileName()));
+        return false;
+    }
+
+    unload();
+    load();
+
+    // Drop the glyphs that are already in the file, and the ones that would
+    // make it exceed its maximum size.
+    const qint64 fileSize = qMax(m_fileSize, qint64(sizeof(FileHeader)));
+    qint64 size = fileSize;
+    for (auto it = m_newGlyphs.begin(); it != m_newGlyphs.end();) {
+        const qint64 glyphSize = qint64(sizeof(FileIndexEntry)) + qint64(it->width()) * it->height();
+        if (m_entries.contains(it.key()) || size + glyphSize > qsg_distancefield_cache_max_size()) {
+            it = m_newGlyphs.erase(it);
+        } else {
+            size += glyphSize;
+            ++it;
+        }
+    }
+    m_newGlyphsSize = size - fileSize;
+    if (m_newGlyphs.isEmpty())
+        return true;
+
+    QSaveFile file(m_file.fileName());
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(lcDistanceFieldDiskCache, "Cannot write %s: %s",
+                  qPrintable(m_file.fileName()), qPrintable(file.errorString()));
+        return false;
+    }
+
+    const quint32 glyphCount = quint32(m_entries.size() + m_newGlyphs.size());
+    FileHeader header;
+    memcpy(header.magic, qsg_distancefield_cache_magic, sizeof(header.magic));
+    header.version = qsg_distancefield_cache_version;
+    header.glyphCount = glyphCount;
+    header.reserved = 0;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    QVector<FileIndexEntry> index;
+    index.reserve(glyphCount);
+    quint32 offset = sizeof(FileHeader) + glyphCount * sizeof(FileIndexEntry);
+    for (auto it = m_entries.constBegin(), end = m_entries.constEnd(); it != end; ++it) {
+        index.append({ it.key(), offset, it->width, it->height });
+        offset += quint32(it->width) * it->height;
+    }
+    for (auto it = m_newGlyphs.constBegin(), end = m_newGlyphs.constEnd(); it != end; ++it) {
+        index.append({ it.key(), offset, quint16(it->width()), quint16(it->height()) });
+        offset += quint32(it->width()) * it->height();
+    }
+    file.write(reinterpret_cast<const char *>(index.constData()), index.size() * sizeof(FileIndexEntry));
+
+    for (auto it = m_entries.constBegin(), end = m_entries.constEnd(); it != end; ++it)
+        file.write(reinterpret_cast<const char *>(m_data + it->offset), qint64(it->width) * it->height);
+    for (auto it = m_newGlyphs.constBegin(), end = m_newGlyphs.constEnd(); it != end; ++it)
+        file.write(reinterpret_cast<const char *>(it->constBits()), qint64(it->width()) * it->height());
+
+    unload();
+
+    if (!file.commit()) {
+        qCWarning(lcDistanceFieldDiskCache, "Cannot write %s: %s",
+                  qPrintable(m_file.fileName()), qPrintable(file.errorString()));
+        m_newGlyphs.clear();
+        m_newGlyphsSize = 0;
+        load();
+        return false;
+    }
+
+    qCDebug(lcDistanceFieldDiskCache, "Saved %u glyphs to %s", glyphCount, qPrintable(m_file.fileName()));
+    m_newGlyphs.clear();
+    m_newGlyphsSize = 0;
+    load();
+    return true;
+}
+
+QT_END_NAMESPACE
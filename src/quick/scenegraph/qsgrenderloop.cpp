@@ -41,6 +41,7 @@
 #include "qsgthreadedrenderloop_p.h"
 #include "qsgwindowsrenderloop_p.h"
 #include <private/qquickanimatorcontroller_p.h>
+#include <private/qabstractanimationjob_p.h>
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QTime>
@@ -55,8 +56,10 @@
 
 #include <QtQuick/QQuickWindow>
 #include <QtQuick/private/qquickwindow_p.h>
+#include <QtQuick/private/qquickframestatistics_p.h>
 #include <QtQuick/private/qsgcontext_p.h>
 #include <QtQuick/private/qsgrenderer_p.h>
+#include <QtQuick/private/qsgtexture_p.h>
 #include <private/qquickprofiler_p.h>
 
 #if QT_CONFIG(opengl)
@@ -409,7 +412,8 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     }
     QElapsedTimer renderTimer;
     qint64 renderTime = 0, syncTime = 0, polishTime = 0;
-    bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
+    QQuickFrameStatistics *statistics = cd->frameStatistics.loadAcquire();
+    bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled() || statistics;
     if (profileFrames)
         renderTimer.start();
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphPolishFrame);
@@ -418,6 +422,12 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
 
     if (profileFrames)
         polishTime = renderTimer.nsecsElapsed();
+    if (statistics) {
+        // Animations are advanced by their own timer with this render loop
+        QQmlAnimationTimer *animationTimer = QQmlAnimationTimer::instance(false);
+        statistics->recordPolish(polishTime);
+        statistics->recordAnimations(0, animationTimer && animationTimer->runningAnimationCount() > 0);
+    }
     Q_QUICK_SG_PROFILE_SWITCH(QQuickProfiler::SceneGraphPolishFrame,
                               QQuickProfiler::SceneGraphRenderLoopFrame,
                               QQuickProfiler::SceneGraphPolishPolish);
@@ -440,6 +450,7 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                               QQuickProfiler::SceneGraphRenderLoopRender);
 
+    const bool grabbed = data.grabOnly;
     if (data.grabOnly) {
         bool alpha = window->format().alphaBufferSize() > 0 && window->color().alpha() != 255;
         grabContent = qt_gl_read_framebuffer(window->size() * window->effectiveDevicePixelRatio(), alpha, alpha);
@@ -459,6 +470,9 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphRenderLoopFrame,
                            QQuickProfiler::SceneGraphRenderLoopSwap);
 
+    if (statistics && !grabbed)
+        statistics->finishFrame(syncTime - polishTime, renderTime - syncTime, swapTime - renderTime);
+
     if (QSG_LOG_TIME_RENDERLOOP().isDebugEnabled()) {
         static QTime lastFrameTime = QTime::currentTime();
         qCDebug(QSG_LOG_TIME_RENDERLOOP,
@@ -492,7 +506,9 @@ QImage QSGGuiThreadRenderLoop::grab(QQuickWindow *window)
 
     m_windows[window].grabOnly = true;
 
+    qsg_suspendTextureUploadBudget();
     renderWindow(window);
+    qsg_resumeTextureUploadBudget();
 
     QImage grabbed = grabContent;
     grabContent = QImage();
@@ -107,6 +107,8 @@ public:
     static void setInstance(QSGRenderLoop *instance);
 
     virtual bool interleaveIncubation() const { return false; }
+    // Nanoseconds the GUI thread spent preparing the last frame, or -1 if unknown.
+    virtual qint64 guiThreadFrameTime() const { return -1; }
 
     virtual int flags() const { return 0; }
 
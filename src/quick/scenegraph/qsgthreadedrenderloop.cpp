@@ -53,8 +53,10 @@
 
 #include <QtQuick/QQuickWindow>
 #include <private/qquickwindow_p.h>
+#include <private/qquickframestatistics_p.h>
 
 #include <QtQuick/private/qsgrenderer_p.h>
+#include <QtQuick/private/qsgtexture_p.h>
 
 #include "qsgthreadedrenderloop_p.h"
 #include <private/qquickanimatorcontroller_p.h>
@@ -127,6 +129,19 @@ static inline int qsgrl_animation_interval() {
 }
 
 
+/*
+    With a pipeline depth of 2, the gui thread polishes the items for the next
+    frame right after advancing the animations, while the render thread is
+    still rendering the current frame. The sync itself cannot be pipelined, as
+    it needs the gui thread to be blocked, so deeper pipelines are not
+    possible.
+ */
+static inline int qsgrl_pipeline_depth()
+{
+    static const int depth = qBound(1, qEnvironmentVariableIntValue("QSG_RENDER_PIPELINE_DEPTH"), 2);
+    return depth;
+}
+
 static QElapsedTimer threadTimer;
 static qint64 syncTime;
 static qint64 renderTime;
@@ -435,7 +450,9 @@ bool QSGRenderThread::event(QEvent *e)
             sgrc->endSync();
 
             qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- rendering scene graph");
+            qsg_suspendTextureUploadBudget();
             QQuickWindowPrivate::get(ce->window)->renderSceneGraph(ce->window->size());
+            qsg_resumeTextureUploadBudget();
 
             qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- grabbing result");
             bool alpha = ce->window->format().alphaBufferSize() > 0 && ce->window->color().alpha() != 255;
@@ -585,7 +602,8 @@ void QSGRenderThread::sync(bool inExpose)
 
 void QSGRenderThread::syncAndRender()
 {
-    bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
+    QQuickFrameStatistics *statistics = QQuickWindowPrivate::get(window)->frameStatistics.loadAcquire();
+    bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled() || statistics;
     if (profileFrames) {
         sinceLastTime = threadTimer.nsecsElapsed();
         threadTimer.start();
@@ -651,6 +669,8 @@ void QSGRenderThread::syncAndRender()
         if (!d->customRenderStage || !d->customRenderStage->swap())
             gl->swapBuffers(window);
         d->fireFrameSwapped();
+        if (statistics)
+            statistics->finishFrame(syncTime, renderTime - syncTime, threadTimer.nsecsElapsed() - renderTime);
     } else {
         Q_QUICK_SG_PROFILE_SKIP(QQuickProfiler::SceneGraphRenderLoopFrame,
                                 QQuickProfiler::SceneGraphRenderLoopSync, 1);
@@ -755,6 +775,7 @@ void QSGRenderThread::run()
 QSGThreadedRenderLoop::QSGThreadedRenderLoop()
     : sg(QSGContext::createDefaultContext())
     , m_animation_timer(0)
+    , m_guiThreadFrameTime(-1)
 {
 #if defined(QSG_RENDER_LOOP_DEBUG)
     qsgrl_timer.start();
@@ -1186,9 +1207,11 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
     qint64 polishTime = 0;
     qint64 waitTime = 0;
     qint64 syncTime = 0;
-    bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
-    if (profileFrames)
-        timer.start();
+    qint64 polishAheadTime = 0;
+    QQuickFrameStatistics *statistics = QQuickWindowPrivate::get(window)->frameStatistics.loadAcquire();
+    bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled() || statistics;
+    // Always timed, the incubation controller sizes its budget from it.
+    timer.start();
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphPolishAndSync);
 
     QQuickWindowPrivate *d = QQuickWindowPrivate::get(window);
@@ -1196,6 +1219,8 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
 
     if (profileFrames)
         polishTime = timer.nsecsElapsed();
+    if (statistics)
+        statistics->recordPolish(polishTime);
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphPolishAndSync,
                               QQuickProfiler::SceneGraphPolishAndSyncPolish);
 
@@ -1228,19 +1253,39 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
         qCDebug(QSG_LOG_RENDERLOOP, "- advancing animations");
         m_animation_driver->advance();
         qCDebug(QSG_LOG_RENDERLOOP, "- animations done..");
+        if (qsgrl_pipeline_depth() > 1) {
+            // Polish the next frame while this one is being rendered. Items
+            // changed by events before the next sync are polished again then.
+            // This is polish work, so keep it out of the animation time and
+            // the frame time the incubation controller budgets against.
+            qCDebug(QSG_LOG_RENDERLOOP, "- polishing ahead");
+            const qint64 polishAheadStart = timer.nsecsElapsed();
+            d->polishItems();
+            polishAheadTime = timer.nsecsElapsed() - polishAheadStart;
+        }
         // We need to trigger another sync to keep animations running...
         maybePostPolishRequest(w);
+        m_guiThreadFrameTime = timer.nsecsElapsed() - polishAheadTime;
         emit timeToIncubate();
     } else if (w->updateDuringSync) {
         maybePostPolishRequest(w);
     }
 
+    const qint64 animationTime = timer.nsecsElapsed() - syncTime - polishAheadTime;
+    if (statistics) {
+        const bool animating = m_animation_driver->isRunning();
+        if (polishAheadTime)
+            statistics->recordPolish(polishTime + polishAheadTime);
+        statistics->recordAnimations(animating && m_animation_timer == 0 ? animationTime : 0, animating);
+    }
+
     qCDebug(QSG_LOG_TIME_RENDERLOOP()).nospace()
             << "Frame prepared with 'threaded' renderloop"
             << ", polish=" << (polishTime / 1000000)
             << ", lock=" << (waitTime - polishTime) / 1000000
             << ", blockedForSync=" << (syncTime - waitTime) / 1000000
-            << ", animations=" << (timer.nsecsElapsed() - syncTime) / 1000000
+            << ", animations=" << (animationTime / 1000000)
+            << ", polishAhead=" << (polishAheadTime / 1000000)
             << " - (on Gui thread) " << window;
 
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphPolishAndSync,
@@ -1256,6 +1301,7 @@ bool QSGThreadedRenderLoop::event(QEvent *e)
         if (te->timerId() == m_animation_timer) {
             qCDebug(QSG_LOG_RENDERLOOP, "- ticking non-visual timer");
             m_animation_driver->advance();
+            m_guiThreadFrameTime = -1;
             emit timeToIncubate();
             return true;
         }
@@ -91,6 +91,7 @@ public:
     void postJob(QQuickWindow *window, QRunnable *job) override;
 
     bool interleaveIncubation() const override;
+    qint64 guiThreadFrameTime() const override { return m_guiThreadFrameTime; }
 
 public Q_SLOTS:
     void animationStarted();
@@ -131,6 +132,7 @@ private:
     QList<Window> m_windows;
 
     int m_animation_timer;
+    qint64 m_guiThreadFrameTime;
 
     bool m_lockedForSync;
 };
@@ -50,6 +50,7 @@
 #include <QtQuick/private/qquickwindow_p.h>
 #include <QtQuick/private/qsgrenderer_p.h>
 #include <QtQuick/private/qsgdefaultrendercontext_p.h>
+#include <QtQuick/private/qsgtexture_p.h>
 
 #include <QtQuick/QQuickWindow>
 
@@ -323,7 +324,9 @@ QImage QSGWindowsRenderLoop::grab(QQuickWindow *window)
     QQuickWindowPrivate *d = QQuickWindowPrivate::get(window);
     d->polishItems();
     d->syncSceneGraph();
+    qsg_suspendTextureUploadBudget();
     d->renderSceneGraph(window->size());
+    qsg_resumeTextureUploadBudget();
 
     bool alpha = window->format().alphaBufferSize() > 0 && window->color().alpha() != 255;
     QImage image = qt_gl_read_framebuffer(window->size() * window->effectiveDevicePixelRatio(), alpha, alpha);
@@ -104,6 +104,7 @@ qtConfig(opengl(es1|es2)?) {
         $$PWD/qsgdefaultglyphnode.cpp \
         $$PWD/qsgdefaultglyphnode_p.cpp \
         $$PWD/qsgdefaultdistancefieldglyphcache.cpp \
+        $$PWD/qsgdistancefielddiskcache.cpp \
         $$PWD/qsgdistancefieldglyphnode.cpp \
         $$PWD/qsgdistancefieldglyphnode_p.cpp \
         $$PWD/qsgdefaultinternalimagenode.cpp \
@@ -119,6 +120,7 @@ qtConfig(opengl(es1|es2)?) {
     HEADERS += \
         $$PWD/qsgdefaultglyphnode_p.h \
         $$PWD/qsgdefaultdistancefieldglyphcache_p.h \
+        $$PWD/qsgdistancefielddiskcache_p.h \
         $$PWD/qsgdistancefieldglyphnode_p.h \
         $$PWD/qsgdistancefieldglyphnode_p_p.h \
         $$PWD/qsgdefaultglyphnode_p_p.h \
@@ -386,6 +386,7 @@ void Atlas::upload(Texture *texture)
     QOpenGLContext::currentContext()->functions()->glTexSubImage2D(GL_TEXTURE_2D, 0,
                                                                    r.x(), r.y(), r.width(), r.height(),
                                                                    m_externalFormat, GL_UNSIGNED_BYTE, tmp.constBits());
+    qsg_countTextureUpload(tmp.sizeInBytes());
 }
 
 void Atlas::uploadBgra(Texture *texture)
@@ -449,6 +450,7 @@ void Atlas::uploadBgra(Texture *texture)
     } else {
         funcs->glTexSubImage2D(GL_TEXTURE_2D, 0, r.x() + 1, r.y() + 1, r.width() - 2, r.height() - 2, m_externalFormat, GL_UNSIGNED_BYTE, src);
     }
+    qsg_countTextureUpload(qint64(r.width()) * r.height() * 4);
 }
 
 void Atlas::generateTexture()
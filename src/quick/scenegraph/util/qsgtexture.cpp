@@ -40,6 +40,7 @@
 #include "qsgtexture_p.h"
 #include <QtQuick/private/qsgcontext_p.h>
 #include <qthread.h>
+#include <qthreadstorage.h>
 #include <qmath.h>
 #include <private/qquickprofiler_p.h>
 #include <private/qqmlglobal_p.h>
@@ -306,6 +307,135 @@ static void qt_debug_remove_texture(QSGTexture* texture)
     \internal
  */
 
+static QBasicAtomicInt qsg_texture_upload_counting = Q_BASIC_ATOMIC_INITIALIZER(0);
+Q_GLOBAL_STATIC(QThreadStorage<qint64>, qsg_texture_upload_bytes)
+
+void qsg_enableTextureUploadCounting(bool enable)
+{
+    if (enable)
+        qsg_texture_upload_counting.ref();
+    else
+        qsg_texture_upload_counting.deref();
+}
+
+void qsg_countTextureUpload(qint64 bytes)
+{
+    if (qsg_texture_upload_counting.loadAcquire() > 0)
+        qsg_texture_upload_bytes()->localData() += bytes;
+}
+
+qint64 qsg_takeTextureUploadBytes()
+{
+    if (!qsg_texture_upload_bytes()->hasLocalData())
+        return 0;
+    qint64 &bytes = qsg_texture_upload_bytes()->localData();
+    const qint64 taken = bytes;
+    bytes = 0;
+    return taken;
+}
+
+/*
+    Limits how much texture data is uploaded per frame, so that a page full of
+    new images is shown over several frames instead of stalling one of them.
+    The budget is set in kilobytes with QSG_TEXTURE_UPLOAD_BUDGET, and in
+    milliseconds spent uploading with QSG_TEXTURE_UPLOAD_TIME_BUDGET. The
+    first upload of a frame is always allowed, so that every frame makes
+    progress. Only textures that are drawn are bound, so the textures that
+    are visible are the only ones uploaded.
+
+    Renders whose result is kept, like layers and window grabs, are not
+    repeated for the deferred textures, so they suspend the budget.
+ */
+struct QSGTextureUploadFrame
+{
+    bool active = false;
+    bool deferred = false;
+    int suspended = 0;
+    qint64 bytes = 0;
+    QElapsedTimer timer;
+};
+
+Q_GLOBAL_STATIC(QThreadStorage<QSGTextureUploadFrame>, qsg_texture_upload_frame)
+
+static qint64 qsg_texture_upload_byte_budget()
+{
+    static const qint64 budget = qint64(qMax(0, qEnvironmentVariableIntValue("QSG_TEXTURE_UPLOAD_BUDGET"))) * 1024;
+    return budget;
+}
+
+static qint64 qsg_texture_upload_time_budget()
+{
+    static const qint64 budget = qMax(0, qEnvironmentVariableIntValue("QSG_TEXTURE_UPLOAD_TIME_BUDGET"));
+    return budget;
+}
+
+void qsg_beginTextureUploadFrame()
+{
+    if (qsg_texture_upload_byte_budget() == 0 && qsg_texture_upload_time_budget() == 0)
+        return;
+    QSGTextureUploadFrame &frame = qsg_texture_upload_frame()->localData();
+    frame.active = true;
+    frame.deferred = false;
+    frame.bytes = 0;
+}
+
+/*
+    Ends the frame started by qsg_beginTextureUploadFrame() and returns true
+    when uploads were deferred, in which case another frame is needed.
+ */
+bool qsg_endTextureUploadFrame()
+{
+    if (!qsg_texture_upload_frame()->hasLocalData())
+        return false;
+    QSGTextureUploadFrame &frame = qsg_texture_upload_frame()->localData();
+    frame.active = false;
+    return frame.deferred;
+}
+
+void qsg_suspendTextureUploadBudget()
+{
+    if (qsg_texture_upload_byte_budget() == 0 && qsg_texture_upload_time_budget() == 0)
+        return;
+    ++qsg_texture_upload_frame()->localData().suspended;
+}
+
+void qsg_resumeTextureUploadBudget()
+{
+    if (!qsg_texture_upload_frame()->hasLocalData())
+        return;
+    QSGTextureUploadFrame &frame = qsg_texture_upload_frame()->localData();
+    if (frame.suspended > 0)
+        --frame.suspended;
+}
+
+/*
+    Returns true when \a bytes of texture data can be uploaded in the current
+    frame, and accounts for them, or false when the upload has to wait for a
+    later frame.
+ */
+bool qsg_reserveTextureUpload(qint64 bytes)
+{
+    if (!qsg_texture_upload_frame()->hasLocalData())
+        return true;
+    QSGTextureUploadFrame &frame = qsg_texture_upload_frame()->localData();
+    if (!frame.active)
+        return true;
+
+    if (frame.bytes > 0 && !frame.suspended) {
+        const qint64 byteBudget = qsg_texture_upload_byte_budget();
+        const qint64 timeBudget = qsg_texture_upload_time_budget();
+        if ((byteBudget > 0 && frame.bytes + bytes > byteBudget)
+                || (timeBudget > 0 && frame.timer.elapsed() >= timeBudget)) {
+            frame.deferred = true;
+            return false;
+        }
+    } else if (frame.bytes == 0) {
+        frame.timer.start();
+    }
+    frame.bytes += bytes;
+    return true;
+}
+
 #ifndef QT_NO_DEBUG
 Q_GLOBAL_STATIC(QSet<QSGTexture *>, qsg_valid_texture_set)
 Q_GLOBAL_STATIC(QMutex, qsg_valid_texture_mutex)
@@ -647,6 +777,7 @@ QSGPlainTexture::QSGPlainTexture()
     , m_owns_texture(true)
     , m_mipmaps_generated(false)
     , m_retain_image(false)
+    , m_has_contents(false)
 {
 }
 
@@ -697,10 +828,58 @@ void QSGPlainTexture::setTextureId(int id)
     m_texture_id = id;
     m_dirty_texture = false;
     m_dirty_bind_options = true;
+    m_has_contents = true;
     m_image = QImage();
     m_mipmaps_generated = false;
 }
 
+#if QT_CONFIG(opengl)
+/*
+    Picks the formats to upload \a image with, converting it to RGBA when
+    the context cannot upload BGRA data. \a image is RGB32 or
+    ARGB32_Premultiplied.
+ */
+static void qsg_selectTextureFormats(QOpenGLContext *context, QImage *image,
+                                     GLenum *internalFormat, GLenum *externalFormat)
+{
+    *externalFormat = GL_RGBA;
+    *internalFormat = GL_RGBA;
+
+#if defined(Q_OS_ANDROID) && !defined(Q_OS_ANDROID_EMBEDDED)
+    QString *deviceName =
+            static_cast<QString *>(QGuiApplication::platformNativeInterface()->nativeResourceForIntegration("AndroidDeviceName"));
+    static bool wrongfullyReportsBgra8888Support = deviceName != 0
+                                                    && (deviceName->compare(QLatin1String("samsung SM-T211"), Qt::CaseInsensitive) == 0
+                                                        || deviceName->compare(QLatin1String("samsung SM-T210"), Qt::CaseInsensitive) == 0
+                                                        || deviceName->compare(QLatin1String("samsung SM-T215"), Qt::CaseInsensitive) == 0);
+#else
+    static bool wrongfullyReportsBgra8888Support = false;
+#endif
+
+    if (context->hasExtension(QByteArrayLiteral("GL_EXT_bgra"))) {
+        *externalFormat = GL_BGRA;
+#ifdef QT_OPENGL_ES
+        *internalFormat = GL_BGRA;
+#else
+        if (context->isOpenGLES())
+            *internalFormat = GL_BGRA;
+#endif // QT_OPENGL_ES
+    } else if (!wrongfullyReportsBgra8888Support
+               && (context->hasExtension(QByteArrayLiteral("GL_EXT_texture_format_BGRA8888"))
+                   || context->hasExtension(QByteArrayLiteral("GL_IMG_texture_format_BGRA8888")))) {
+        *externalFormat = GL_BGRA;
+        *internalFormat = GL_BGRA;
+#if defined(Q_OS_DARWIN) && !defined(Q_OS_OSX)
+    } else if (context->hasExtension(QByteArrayLiteral("GL_APPLE_texture_format_BGRA8888"))) {
+        *externalFormat = GL_BGRA;
+        *internalFormat = GL_RGBA;
+#endif
+    } else {
+        *image = std::move(*image).convertToFormat(QImage::Format_RGBA8888_Premultiplied);
+    }
+}
+#endif
+
 void QSGPlainTexture::bind()
 {
 #if QT_CONFIG(opengl)
@@ -717,6 +896,35 @@ void QSGPlainTexture::bind()
         return;
     }
 
+    if (!m_image.isNull() && !qsg_reserveTextureUpload(qint64(m_image.width()) * m_image.height() * 4)) {
+        // Over the upload budget of this frame. Keep showing the previous
+        // contents, or a tiny version of the image for a new texture, until
+        // a later frame uploads it.
+        if (m_texture_id == 0)
+            funcs->glGenTextures(1, &m_texture_id);
+        funcs->glBindTexture(GL_TEXTURE_2D, m_texture_id);
+        if (!m_has_contents) {
+            // Uploaded like the real image below, so that both use the same formats
+            QImage placeholder = m_image.scaled(QSize(16, 16).boundedTo(m_image.size()),
+                                                Qt::IgnoreAspectRatio, Qt::FastTransformation);
+            if (placeholder.format() != QImage::Format_RGB32)
+                placeholder = std::move(placeholder).convertToFormat(QImage::Format_ARGB32_Premultiplied);
+            GLenum externalFormat;
+            GLenum internalFormat;
+            qsg_selectTextureFormats(context, &placeholder, &internalFormat, &externalFormat);
+            funcs->glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, placeholder.width(), placeholder.height(), 0,
+                                externalFormat, GL_UNSIGNED_BYTE, placeholder.constBits());
+            m_has_contents = true;
+        }
+        updateBindOptions(true);
+        // The placeholder has no mipmaps, the options are set again after the upload
+        if (mipmapFiltering() != QSGTexture::None)
+            funcs->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                                   filtering() == QSGTexture::Nearest ? GL_NEAREST : GL_LINEAR);
+        m_dirty_bind_options = true;
+        return;
+    }
+
     m_dirty_texture = false;
 
     bool profileFrames = QSG_LOG_TIME_TEXTURE().isDebugEnabled();
@@ -739,6 +947,7 @@ void QSGPlainTexture::bind()
         m_texture_id = 0;
         m_texture_size = QSize();
         m_has_alpha = false;
+        m_has_contents = false;
 
         return;
     }
@@ -797,41 +1006,9 @@ void QSGPlainTexture::bind()
 
     updateBindOptions(m_dirty_bind_options);
 
-    GLenum externalFormat = GL_RGBA;
-    GLenum internalFormat = GL_RGBA;
-
-#if defined(Q_OS_ANDROID) && !defined(Q_OS_ANDROID_EMBEDDED)
-    QString *deviceName =
-            static_cast<QString *>(QGuiApplication::platformNativeInterface()->nativeResourceForIntegration("AndroidDeviceName"));
-    static bool wrongfullyReportsBgra8888Support = deviceName != 0
-                                                    && (deviceName->compare(QLatin1String("samsung SM-T211"), Qt::CaseInsensitive) == 0
-                                                        || deviceName->compare(QLatin1String("samsung SM-T210"), Qt::CaseInsensitive) == 0
-                                                        || deviceName->compare(QLatin1String("samsung SM-T215"), Qt::CaseInsensitive) == 0);
-#else
-    static bool wrongfullyReportsBgra8888Support = false;
-#endif
-
-    if (context->hasExtension(QByteArrayLiteral("GL_EXT_bgra"))) {
-        externalFormat = GL_BGRA;
-#ifdef QT_OPENGL_ES
-        internalFormat = GL_BGRA;
-#else
-        if (context->isOpenGLES())
-            internalFormat = GL_BGRA;
-#endif // QT_OPENGL_ES
-    } else if (!wrongfullyReportsBgra8888Support
-               && (context->hasExtension(QByteArrayLiteral("GL_EXT_texture_format_BGRA8888"))
-                   || context->hasExtension(QByteArrayLiteral("GL_IMG_texture_format_BGRA8888")))) {
-        externalFormat = GL_BGRA;
-        internalFormat = GL_BGRA;
-#if defined(Q_OS_DARWIN) && !defined(Q_OS_OSX)
-    } else if (context->hasExtension(QByteArrayLiteral("GL_APPLE_texture_format_BGRA8888"))) {
-        externalFormat = GL_BGRA;
-        internalFormat = GL_RGBA;
-#endif
-    } else {
-        tmp = std::move(tmp).convertToFormat(QImage::Format_RGBA8888_Premultiplied);
-    }
+    GLenum externalFormat;
+    GLenum internalFormat;
+    qsg_selectTextureFormats(context, &tmp, &internalFormat, &externalFormat);
 
     qint64 swizzleTime = 0;
     if (profileFrames)
@@ -840,6 +1017,7 @@ void QSGPlainTexture::bind()
                               QQuickProfiler::SceneGraphTexturePrepareSwizzle);
 
     funcs->glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, m_texture_size.width(), m_texture_size.height(), 0, externalFormat, GL_UNSIGNED_BYTE, tmp.constBits());
+    qsg_countTextureUpload(tmp.sizeInBytes());
 
     qint64 uploadTime = 0;
     if (profileFrames)
@@ -874,6 +1052,7 @@ void QSGPlainTexture::bind()
     m_texture_rect = QRectF(0, 0, 1, 1);
 
     m_dirty_bind_options = false;
+    m_has_contents = true;
     if (!m_retain_image)
         m_image = QImage();
 #endif
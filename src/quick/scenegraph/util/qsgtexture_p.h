@@ -122,10 +122,24 @@ protected:
     uint m_owns_texture : 1;
     uint m_mipmaps_generated : 1;
     uint m_retain_image: 1;
+    uint m_has_contents : 1;
 };
 
 Q_QUICK_PRIVATE_EXPORT bool qsg_safeguard_texture(QSGTexture *);
 
+// Bytes of texture data uploaded on the current thread, counted while enabled
+Q_QUICK_PRIVATE_EXPORT void qsg_enableTextureUploadCounting(bool enable);
+Q_QUICK_PRIVATE_EXPORT void qsg_countTextureUpload(qint64 bytes);
+Q_QUICK_PRIVATE_EXPORT qint64 qsg_takeTextureUploadBytes();
+
+// Per-frame texture upload budget of the current thread, see QSG_TEXTURE_UPLOAD_BUDGET
+Q_QUICK_PRIVATE_EXPORT void qsg_beginTextureUploadFrame();
+Q_QUICK_PRIVATE_EXPORT bool qsg_endTextureUploadFrame();
+Q_QUICK_PRIVATE_EXPORT bool qsg_reserveTextureUpload(qint64 bytes);
+// Nests, for renders that are not repeated when uploads are deferred
+Q_QUICK_PRIVATE_EXPORT void qsg_suspendTextureUploadBudget();
+Q_QUICK_PRIVATE_EXPORT void qsg_resumeTextureUploadBudget();
+
 QT_END_NAMESPACE
 
 #endif // QSGTEXTURE_P_H
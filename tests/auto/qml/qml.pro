@@ -70,6 +70,8 @@ PRIVATETESTS += \
     qqmltranslation \
     qqmlimport \
     qqmlobjectmodel \
+    qqmlsortfiltermodel \
+    qrecyclingallocator \
     qv4assembler \
     qv4mm \
     qv4identifiertable \
@@ -29,6 +29,8 @@
 #include "../../shared/util.h"
 #include <QQmlApplicationEngine>
 #include <QScopedPointer>
+#include <QTemporaryDir>
+#include <private/qqmlengine_p.h>
 #include <QSignalSpy>
 #if QT_CONFIG(process)
 #include <QProcess>
@@ -52,6 +54,7 @@ private slots:
     void removeObjectsWhenDestroyed();
     void loadTranslation_data();
     void loadTranslation();
+    void preloadManifest();
 
 private:
     QString buildDir;
@@ -269,6 +272,39 @@ void tst_qqmlapplicationengine::loadTranslation()
     QCOMPARE(rootObject->property("translation").toString(), translation);
 }
 
+void tst_qqmlapplicationengine::preloadManifest()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QString manifest = tempDir.filePath(QStringLiteral("preload.manifest"));
+
+    {
+        qputenv("QML_PRELOAD_MANIFEST_OUTPUT", QFile::encodeName(manifest));
+        QQmlApplicationEngine test(testFileUrl("nonResolvedLocal.qml"));
+        qunsetenv("QML_PRELOAD_MANIFEST_OUTPUT");
+        QCOMPARE(test.rootObjects().size(), 1);
+    }
+
+    QFile file(manifest);
+    QVERIFY(file.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QByteArray contents = file.readAll();
+    QVERIFY(contents.contains("type " + testFileUrl("nonResolvedLocal.qml").toEncoded()));
+    QVERIFY(contents.contains("type " + testFileUrl("LocalComponent.qml").toEncoded()));
+    file.close();
+
+    QQmlApplicationEngine test;
+    QQmlTypeLoader *typeLoader = &QQmlEnginePrivate::get(&test)->typeLoader;
+    QVERIFY(!typeLoader->isTypeLoaded(testFileUrl("LocalComponent.qml")));
+    QVERIFY(test.loadPreloadManifest(manifest));
+    QVERIFY(typeLoader->isTypeLoaded(testFileUrl("LocalComponent.qml")));
+
+    test.load(testFileUrl("nonResolvedLocal.qml"));
+    QTRY_COMPARE(test.rootObjects().size(), 1);
+    QVERIFY(test.rootObjects().first()->property("success").toBool());
+
+    QVERIFY(!test.loadPreloadManifest(tempDir.filePath(QStringLiteral("missing.manifest"))));
+}
+
 QTEST_MAIN(tst_qqmlapplicationengine)
 
 #include "tst_qqmlapplicationengine.moc"
@@ -53,6 +53,8 @@ private slots:
     void initTestCase();
 
     void incubationMode();
+    void priority();
+    void incubationStatistics();
     void objectDeleted();
     void clear();
     void noIncubationController();
@@ -130,6 +132,78 @@ void tst_qqmlincubator::incubationMode()
     }
 }
 
+void tst_qqmlincubator::priority()
+{
+    QQmlComponent component(&engine, testFileUrl("clear.qml"));
+    QVERIFY(component.isReady());
+
+    class MyIncubator : public QQmlIncubator
+    {
+    public:
+        MyIncubator(int id, QList<int> *order) : id(id), order(order) {}
+
+    protected:
+        void statusChanged(Status s) override { if (s == Ready) order->append(id); }
+
+    private:
+        int id;
+        QList<int> *order;
+    };
+
+    QList<int> order;
+    MyIncubator low(0, &order);
+    MyIncubator normal(1, &order);
+    MyIncubator high(2, &order);
+    QCOMPARE(normal.priority(), QQmlIncubator::NormalPriority);
+
+    low.setPriority(QQmlIncubator::LowPriority);
+    high.setPriority(QQmlIncubator::HighPriority);
+    QCOMPARE(low.priority(), QQmlIncubator::LowPriority);
+    QCOMPARE(high.priority(), QQmlIncubator::HighPriority);
+
+    component.create(low);
+    component.create(high);
+    component.create(normal);
+
+    while (low.isLoading()) {
+        bool b = false;
+        controller.incubateWhile(&b);
+    }
+
+    QCOMPARE(order, QList<int>() << 2 << 1 << 0);
+    QVERIFY(low.isReady());
+    delete low.object();
+    delete normal.object();
+    delete high.object();
+}
+
+void tst_qqmlincubator::incubationStatistics()
+{
+    QQmlComponent component(&engine, testFileUrl("clear.qml"));
+    QVERIFY(component.isReady());
+
+    QQmlIncubator first;
+    QQmlIncubator second;
+    component.create(first);
+    component.create(second);
+    QCOMPARE(controller.incubatingObjectCount(), 2);
+
+    controller.incubateFor(1000);
+    QVERIFY(first.isReady());
+    QVERIFY(second.isReady());
+    QCOMPARE(controller.lastIncubatedObjectCount(), 2);
+    QCOMPARE(controller.lastIncubationBudget(), 1000);
+    QVERIFY(controller.lastIncubationTime() > 0);
+
+    // Nothing left to incubate, so the statistics are kept
+    controller.incubateFor(5);
+    QCOMPARE(controller.lastIncubatedObjectCount(), 2);
+    QCOMPARE(controller.lastIncubationBudget(), 1000);
+
+    delete first.object();
+    delete second.object();
+}
+
 void tst_qqmlincubator::objectDeleted()
 {
     {
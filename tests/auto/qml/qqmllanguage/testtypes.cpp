@@ -117,8 +117,11 @@ void registerTypes()
     qmlRegisterType<DeferredProperties>("Test", 1, 0, "DeferredProperties");
 }
 
+int myCustomVariantTypeConverterCalls = 0;
+
 QVariant myCustomVariantTypeConverter(const QString &data)
 {
+    ++myCustomVariantTypeConverterCalls;
     MyCustomVariantType rv;
     rv.a = data.toInt();
     return QVariant::fromValue(rv);
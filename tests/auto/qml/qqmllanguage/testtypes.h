@@ -45,6 +45,7 @@
 #include <QtQml/qqmlproperty.h>
 #include <private/qqmlcustomparser_p.h>
 
+extern int myCustomVariantTypeConverterCalls;
 QVariant myCustomVariantTypeConverter(const QString &data);
 
 class MyInterface
@@ -100,6 +100,7 @@ private slots:
     void assignLiteralSignalProperty();
     void assignQmlComponent();
     void assignBasicTypes();
+    void assignBasicTypesRepeatedly();
     void assignTypeExtremes();
     void assignCompositeToType();
     void assignLiteralToVariant();
@@ -767,6 +768,29 @@ void tst_qqmllanguage::assignBasicTypes()
     QCOMPARE(object->property("mirroredEnumTriggeredChange").toBool(), false);
 }
 
+// Literal values are converted once per compilation unit and reused by later instances
+void tst_qqmllanguage::assignBasicTypesRepeatedly()
+{
+    QQmlComponent component(&engine, testFileUrl("assignBasicTypes.qml"));
+    VERIFY_ERRORS(0);
+    const QUrl encoded = QUrl::fromEncoded("main.qml?with%3cencoded%3edata", QUrl::TolerantMode);
+    for (int i = 0; i < 2; ++i) {
+        QScopedPointer<MyTypeObject> object(qobject_cast<MyTypeObject *>(component.create()));
+        QVERIFY(object != nullptr);
+        QCOMPARE(object->colorProperty(), QColor("red"));
+        QCOMPARE(object->dateProperty(), QDate(1982, 11, 25));
+        QCOMPARE(object->timeProperty(), QTime(11, 11, 32));
+        QCOMPARE(object->dateTimeProperty(), QDateTime(QDate(2009, 5, 12), QTime(13, 22, 1)));
+        QCOMPARE(object->pointProperty(), QPoint(99,13));
+        QCOMPARE(object->sizeFProperty(), QSizeF(0.1, 0.2));
+        QCOMPARE(object->rectFProperty(), QRectF(1000.1, -10.9, 400, 90.99));
+        QCOMPARE(object->variantProperty(), QVariant("Hello World!"));
+        QCOMPARE(object->vectorProperty(), QVector3D(10, 1, 2.2f));
+        QCOMPARE(object->vector4Property(), QVector4D(10, 1, 2.2f, 2.3f));
+        QCOMPARE(object->urlProperty(), component.url().resolved(encoded));
+    }
+}
+
 // Test edge case type assignments
 void tst_qqmllanguage::assignTypeExtremes()
 {
@@ -1641,9 +1665,16 @@ void tst_qqmllanguage::customVariantTypes()
 {
     QQmlComponent component(&engine, testFileUrl("customVariantTypes.qml"));
     VERIFY_ERRORS(0);
+    const int calls = myCustomVariantTypeConverterCalls;
     QScopedPointer<MyQmlObject> object(qobject_cast<MyQmlObject*>(component.create()));
     QVERIFY(object != nullptr);
     QCOMPARE(object->customType().a, 10);
+
+    // Custom converters run for every instance, their results are not cached
+    object.reset(qobject_cast<MyQmlObject*>(component.create()));
+    QVERIFY(object != nullptr);
+    QCOMPARE(object->customType().a, 10);
+    QCOMPARE(myCustomVariantTypeConverterCalls, calls + 2);
 }
 
 void tst_qqmllanguage::valueTypes()
@@ -37,6 +37,7 @@
 #include <QtCore/qtimer.h>
 #include <QtCore/qdebug.h>
 #include <QtCore/qtranslator.h>
+#include <QtCore/qregularexpression.h>
 #include <QSignalSpy>
 
 #include "../../shared/util.h"
@@ -128,6 +129,9 @@ private slots:
     void qobjectTrackerForDynamicModelObjects();
     void crash_append_empty_array();
     void dynamic_roles_crash_QTBUG_38907();
+    void scalarRoleColumns();
+    void batchedChanges();
+    void batchNotCommitted();
 };
 
 bool tst_qqmllistmodel::compareVariantList(const QVariantList &testList, QVariant object)
@@ -1667,6 +1671,292 @@ void tst_qqmllistmodel::dynamic_roles_crash_QTBUG_38907()
     QVERIFY(retVal.toBool());
 }
 
+void tst_qqmllistmodel::scalarRoleColumns()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(
+                "import QtQuick 2.0\n"
+                "Item {\n"
+                "   ListModel {\n"
+                "      objectName: \"testModel\"\n"
+                "   }\n"
+                "}\n", QUrl());
+    QScopedPointer<QObject> scene(component.create());
+    QVERIFY(scene);
+    QQmlListModel *model = scene->findChild<QQmlListModel*>("testModel");
+    QVERIFY(model);
+
+    QQmlExpression fill(engine.rootContext(), model,
+                        "var rows = [];"
+                        "for (var i = 0; i < 1000; ++i)"
+                        "    rows.push({ name: (i % 2) ? \"odd\" : \"even\", value: i, flag: i % 3 == 0 });"
+                        "append(rows);");
+    fill.evaluate();
+    QVERIFY2(!fill.hasError(), QTest::toString(fill.error().toString()));
+    QCOMPARE(model->count(), 1000);
+
+    const QHash<int, QByteArray> names = model->roleNames();
+    const int nameRole = names.key("name");
+    const int valueRole = names.key("value");
+    const int flagRole = names.key("flag");
+
+    QCOMPARE(model->data(model->index(1, 0, QModelIndex()), nameRole).toString(), QStringLiteral("odd"));
+    QCOMPARE(model->data(model->index(998, 0, QModelIndex()), nameRole).toString(), QStringLiteral("even"));
+    QCOMPARE(model->data(model->index(998, 0, QModelIndex()), valueRole).toInt(), 998);
+    QCOMPARE(model->data(model->index(999, 0, QModelIndex()), flagRole).toBool(), true);
+
+    // Changing a shared string only affects its own row
+    QSignalSpy changedSpy(model, &QAbstractItemModel::dataChanged);
+    QVERIFY(model->setData(model->index(1, 0, QModelIndex()), QStringLiteral("changed"), nameRole));
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(model->data(model->index(1, 0, QModelIndex()), nameRole).toString(), QStringLiteral("changed"));
+    QCOMPARE(model->data(model->index(3, 0, QModelIndex()), nameRole).toString(), QStringLiteral("odd"));
+
+    // Setting the same value again does not notify
+    model->setProperty(3, QStringLiteral("name"), QStringLiteral("odd"));
+    QCOMPARE(changedSpy.count(), 1);
+
+    // The columns follow moves and removals of rows
+    model->move(0, 10, 2);
+    QCOMPARE(model->data(model->index(10, 0, QModelIndex()), valueRole).toInt(), 0);
+    QCOMPARE(model->data(model->index(11, 0, QModelIndex()), nameRole).toString(), QStringLiteral("changed"));
+    QCOMPARE(model->data(model->index(0, 0, QModelIndex()), valueRole).toInt(), 2);
+
+    QQmlExpression remove(engine.rootContext(), model, "remove(0, 10)");
+    remove.evaluate();
+    QVERIFY2(!remove.hasError(), QTest::toString(remove.error().toString()));
+    QCOMPARE(model->count(), 990);
+    QCOMPARE(model->data(model->index(0, 0, QModelIndex()), valueRole).toInt(), 0);
+    QCOMPARE(model->data(model->index(1, 0, QModelIndex()), valueRole).toInt(), 1);
+    QCOMPARE(model->data(model->index(1, 0, QModelIndex()), nameRole).toString(), QStringLiteral("changed"));
+    QCOMPARE(model->data(model->index(2, 0, QModelIndex()), valueRole).toInt(), 12);
+    QCOMPARE(model->data(model->index(2, 0, QModelIndex()), flagRole).toBool(), true);
+
+    // Rows inserted after a role exists get the default value
+    QQmlExpression insert(engine.rootContext(), model, "insert(0, { other: 1 }); get(0).name");
+    QVariant result = insert.evaluate();
+    QVERIFY2(!insert.hasError(), QTest::toString(insert.error().toString()));
+    QVERIFY(!result.isValid() || result.toString().isEmpty());
+    QCOMPARE(model->data(model->index(0, 0, QModelIndex()), valueRole).toInt(), 0);
+    QCOMPARE(model->data(model->index(0, 0, QModelIndex()), flagRole).toBool(), false);
+}
+
+void tst_qqmllistmodel::batchedChanges()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(
+                "import QtQuick 2.13\n"
+                "Item {\n"
+                "   ListModel {\n"
+                "      objectName: \"testModel\"\n"
+                "      ListElement { value: 0 }\n"
+                "      ListElement { value: 1 }\n"
+                "      ListElement { value: 2 }\n"
+                "      ListElement { value: 3 }\n"
+                "   }\n"
+                "}\n", QUrl());
+    QScopedPointer<QObject> scene(component.create());
+    QVERIFY2(scene, qPrintable(component.errorString()));
+    QQmlListModel *model = scene->findChild<QQmlListModel*>("testModel");
+    QVERIFY(model);
+    const int valueRole = model->roleNames().key("value");
+
+    QSignalSpy insertedSpy(model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removedSpy(model, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy changedSpy(model, &QAbstractItemModel::dataChanged);
+    QSignalSpy resetSpy(model, &QAbstractItemModel::modelReset);
+    QSignalSpy countSpy(model, &QQmlListModel::countChanged);
+
+    // Value changes are reported as the changed ranges
+    QQmlExpression changeExpr(engine.rootContext(), model,
+                              "beginBatch();"
+                              "setProperty(1, \"value\", 11);"
+                              "set(2, { value: 12 });"
+                              "setProperty(1, \"value\", 21);"
+                              "commitBatch();");
+    changeExpr.evaluate();
+    QVERIFY2(!changeExpr.hasError(), QTest::toString(changeExpr.error().toString()));
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(changedSpy.at(0).at(0).value<QModelIndex>().row(), 1);
+    QCOMPARE(changedSpy.at(0).at(1).value<QModelIndex>().row(), 2);
+    QCOMPARE(changedSpy.at(0).at(2).value<QVector<int>>(), QVector<int>() << valueRole);
+    QCOMPARE(insertedSpy.count(), 0);
+    QCOMPARE(removedSpy.count(), 0);
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(countSpy.count(), 0);
+    changedSpy.clear();
+
+    // Appends are reported as a single insertion of all the new rows
+    int rowCountWhenInserting = -1;
+    QMetaObject::Connection connection = connect(model, &QAbstractItemModel::rowsAboutToBeInserted, [&]() {
+        rowCountWhenInserting = model->rowCount();
+    });
+    QQmlExpression appendExpr(engine.rootContext(), model,
+                              "beginBatch();"
+                              "for (var i = 4; i < 104; ++i)"
+                              "    append({ value: i });"
+                              "setProperty(0, \"value\", 10);"
+                              "var during = count;"
+                              "commitBatch();"
+                              "during");
+    QCOMPARE(appendExpr.evaluate().toInt(), 104);
+    QVERIFY2(!appendExpr.hasError(), QTest::toString(appendExpr.error().toString()));
+    disconnect(connection);
+    QCOMPARE(rowCountWhenInserting, 4);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 4);
+    QCOMPARE(insertedSpy.at(0).at(2).toInt(), 103);
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(changedSpy.at(0).at(0).value<QModelIndex>().row(), 0);
+    QCOMPARE(changedSpy.at(0).at(1).value<QModelIndex>().row(), 0);
+    QCOMPARE(removedSpy.count(), 0);
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(model->rowCount(), 104);
+    insertedSpy.clear();
+    changedSpy.clear();
+    countSpy.clear();
+
+    // Inserts and removals in the middle of the list are replayed range by
+    // range. Applying them to a copy of the old content must give the new one.
+    const int insertedRow = -1000;
+    QVector<int> shadow;
+    for (int row = 0; row < model->rowCount(); ++row)
+        shadow.append(model->data(model->index(row, 0, QModelIndex()), valueRole).toInt());
+    QVector<int> rowCounts;
+    connection = connect(model, &QAbstractItemModel::rowsAboutToBeRemoved, [&]() {
+        rowCounts.append(model->rowCount());
+    });
+    QMetaObject::Connection insertConnection = connect(model, &QAbstractItemModel::rowsAboutToBeInserted, [&]() {
+        rowCounts.append(model->rowCount());
+    });
+    QMetaObject::Connection shadowRemove = connect(model, &QAbstractItemModel::rowsRemoved,
+                                                   [&](const QModelIndex &, int first, int last) {
+        QCOMPARE(model->rowCount(), shadow.count() - (last - first + 1));
+        shadow.remove(first, last - first + 1);
+    });
+    QMetaObject::Connection shadowInsert = connect(model, &QAbstractItemModel::rowsInserted,
+                                                   [&](const QModelIndex &, int first, int last) {
+        QCOMPARE(model->rowCount(), shadow.count() + (last - first + 1));
+        shadow.insert(first, last - first + 1, insertedRow);
+    });
+
+    QQmlExpression mixedExpr(engine.rootContext(), model,
+                             "beginBatch();"
+                             "remove(0);"
+                             "insert(0, { value: -1 });"
+                             "remove(50, 10);"
+                             "commitBatch();");
+    mixedExpr.evaluate();
+    QVERIFY2(!mixedExpr.hasError(), QTest::toString(mixedExpr.error().toString()));
+    QCOMPARE(resetSpy.count(), 0);
+    int removedRows = 0;
+    for (const QList<QVariant> &args : qAsConst(removedSpy))
+        removedRows += args.at(2).toInt() - args.at(1).toInt() + 1;
+    QCOMPARE(removedRows, 11);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 0);
+    QCOMPARE(insertedSpy.at(0).at(2).toInt(), 0);
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(model->rowCount(), 94);
+    QCOMPARE(shadow.count(), 94);
+    for (int row = 0; row < shadow.count(); ++row) {
+        if (shadow.at(row) != insertedRow)
+            QCOMPARE(model->data(model->index(row, 0, QModelIndex()), valueRole).toInt(), shadow.at(row));
+    }
+    QCOMPARE(model->data(model->index(0, 0, QModelIndex()), valueRole).toInt(), -1);
+    QCOMPARE(model->data(model->index(1, 0, QModelIndex()), valueRole).toInt(), 21);
+    QCOMPARE(model->data(model->index(50, 0, QModelIndex()), valueRole).toInt(), 60);
+    insertedSpy.clear();
+    removedSpy.clear();
+    countSpy.clear();
+    rowCounts.clear();
+
+    // Dropping expired rows at the front and appending new ones is reported
+    // as exactly one removal and one insertion
+    QQmlExpression expireExpr(engine.rootContext(), model,
+                              "beginBatch();"
+                              "remove(0, 10);"
+                              "for (var i = 0; i < 10; ++i)"
+                              "    append({ value: 200 + i });"
+                              "commitBatch();");
+    expireExpr.evaluate();
+    QVERIFY2(!expireExpr.hasError(), QTest::toString(expireExpr.error().toString()));
+    disconnect(connection);
+    disconnect(insertConnection);
+    disconnect(shadowRemove);
+    disconnect(shadowInsert);
+    QCOMPARE(resetSpy.count(), 0);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 0);
+    QCOMPARE(removedSpy.at(0).at(2).toInt(), 9);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 84);
+    QCOMPARE(insertedSpy.at(0).at(2).toInt(), 93);
+    QCOMPARE(rowCounts, QVector<int>() << 94 << 84);
+    QCOMPARE(changedSpy.count(), 0);
+    QCOMPARE(countSpy.count(), 0);
+    QCOMPARE(model->rowCount(), 94);
+    QCOMPARE(model->data(model->index(93, 0, QModelIndex()), valueRole).toInt(), 209);
+
+    // Committing without a batch only warns
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*commitBatch: no batch in progress"));
+    QQmlExpression extraCommit(engine.rootContext(), model, "commitBatch()");
+    extraCommit.evaluate();
+    QCOMPARE(countSpy.count(), 0);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(resetSpy.count(), 0);
+}
+
+void tst_qqmllistmodel::batchNotCommitted()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(
+                "import QtQuick 2.13\n"
+                "Item {\n"
+                "   ListModel {\n"
+                "      objectName: \"testModel\"\n"
+                "      ListElement { value: 0 }\n"
+                "   }\n"
+                "}\n", QUrl());
+    QScopedPointer<QObject> scene(component.create());
+    QVERIFY2(scene, qPrintable(component.errorString()));
+    QQmlListModel *model = scene->findChild<QQmlListModel*>("testModel");
+    QVERIFY(model);
+
+    QSignalSpy insertedSpy(model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy countSpy(model, &QQmlListModel::countChanged);
+
+    QQmlExpression expr(engine.rootContext(), model,
+                        "beginBatch();"
+                        "append({ value: 1 });"
+                        "throw new Error(\"failed\");"
+                        "commitBatch();");
+    expr.evaluate();
+    QVERIFY(expr.hasError());
+    QCOMPARE(model->count(), 2);
+    QCOMPARE(insertedSpy.count(), 0);
+
+    // The batch is committed once control returns to the event loop
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*beginBatch: batch not committed, committing it now"));
+    QTRY_COMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(insertedSpy.at(0).at(2).toInt(), 1);
+    QCOMPARE(countSpy.count(), 1);
+
+    // Later changes are notified right away again
+    QQmlExpression appendExpr(engine.rootContext(), model, "append({ value: 2 })");
+    appendExpr.evaluate();
+    QCOMPARE(insertedSpy.count(), 2);
+    QCOMPARE(insertedSpy.at(1).at(1).toInt(), 2);
+    QCOMPARE(insertedSpy.at(1).at(2).toInt(), 2);
+    QCOMPARE(countSpy.count(), 2);
+}
+
 QTEST_MAIN(tst_qqmllistmodel)
 
 #include "tst_qqmllistmodel.moc"
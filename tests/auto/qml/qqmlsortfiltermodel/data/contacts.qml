@@ -0,0 +1,18 @@
+import QtQml.Models 2.13
+
+SortFilterModel {
+    sourceModel: ListModel {
+        id: contacts
+        ListElement { name: "Charlie"; age: 30 }
+        ListElement { name: "alice"; age: 25 }
+        ListElement { name: "Bob"; age: 41 }
+        ListElement { name: "dave"; age: 19 }
+        ListElement { name: "Eve"; age: 35 }
+    }
+    sortRole: "name"
+    filterRole: "name"
+
+    function setAge(row, age) { contacts.setProperty(row, "age", age) }
+    function append(name, age) { contacts.append({ "name": name, "age": age }) }
+    function remove(row) { contacts.remove(row) }
+}
@@ -0,0 +1,12 @@
+CONFIG += testcase
+TARGET = tst_qqmlsortfiltermodel
+osx:CONFIG -= app_bundle
+
+SOURCES += tst_qqmlsortfiltermodel.cpp
+
+include (../../shared/util.pri)
+
+TESTDATA = data/*
+
+QT += qml testlib
+QT += core-private qml-private
@@ -0,0 +1,204 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtQml/private/qqmlsortfiltermodel_p.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+#include <QtTest/qabstractitemmodeltester.h>
+#include <QtTest/qsignalspy.h>
+#include <QtTest/qtest.h>
+#include "../../shared/util.h"
+
+class tst_QQmlSortFilterModel : public QQmlDataTest
+{
+    Q_OBJECT
+
+private slots:
+    void sort();
+    void filter();
+    void dataChangedMovesRow();
+    void sourceInsertRemove();
+
+private:
+    QQmlSortFilterModel *createModel(QQmlEngine *engine);
+};
+
+static QStringList values(QAbstractItemModel *model, const QByteArray &roleName)
+{
+    const int role = model->roleNames().key(roleName, -1);
+    QStringList result;
+    for (int row = 0; row < model->rowCount(); ++row)
+        result.append(model->data(model->index(row, 0), role).toString());
+    return result;
+}
+
+QQmlSortFilterModel *tst_QQmlSortFilterModel::createModel(QQmlEngine *engine)
+{
+    QQmlComponent component(engine, testFileUrl("contacts.qml"));
+    QObject *object = component.create();
+    if (!object)
+        qWarning() << component.errorString();
+    return qobject_cast<QQmlSortFilterModel *>(object);
+}
+
+void tst_QQmlSortFilterModel::sort()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQmlSortFilterModel> model(createModel(&engine));
+    QVERIFY(model);
+    QAbstractItemModelTester tester(model.data(), QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+    QCOMPARE(model->count(), 5);
+    QCOMPARE(values(model.data(), "name"), QStringList({ "alice", "Bob", "Charlie", "dave", "Eve" }));
+    QCOMPARE(model->mapToSource(0), 1);
+    QCOMPARE(model->mapFromSource(0), 2);
+
+    QSignalSpy layoutSpy(model.data(), &QAbstractItemModel::layoutChanged);
+    QSignalSpy resetSpy(model.data(), &QAbstractItemModel::modelReset);
+
+    model->setSortOrder(Qt::DescendingOrder);
+    QCOMPARE(values(model.data(), "name"), QStringList({ "Eve", "dave", "Charlie", "Bob", "alice" }));
+
+    model->setCaseSensitivity(Qt::CaseSensitive);
+    QCOMPARE(values(model.data(), "name"), QStringList({ "dave", "alice", "Eve", "Charlie", "Bob" }));
+
+    model->setSortRole(QStringLiteral("age"));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "Bob", "Eve", "Charlie", "alice", "dave" }));
+
+    model->setSortRole(QString());
+    QCOMPARE(values(model.data(), "name"), QStringList({ "Charlie", "alice", "Bob", "dave", "Eve" }));
+
+    QCOMPARE(layoutSpy.count(), 4);
+    QCOMPARE(resetSpy.count(), 0);
+}
+
+void tst_QQmlSortFilterModel::filter()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQmlSortFilterModel> model(createModel(&engine));
+    QVERIFY(model);
+    QAbstractItemModelTester tester(model.data(), QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+    QSignalSpy removedSpy(model.data(), &QAbstractItemModel::rowsRemoved);
+    QSignalSpy insertedSpy(model.data(), &QAbstractItemModel::rowsInserted);
+    QSignalSpy resetSpy(model.data(), &QAbstractItemModel::modelReset);
+    QSignalSpy countSpy(model.data(), &QQmlSortFilterModel::countChanged);
+
+    model->setFilterString(QStringLiteral("A"));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "alice", "Charlie", "dave" }));
+    QCOMPARE(removedSpy.count(), 2);
+    QCOMPARE(insertedSpy.count(), 0);
+
+    model->setFilterString(QStringLiteral("Al"));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "alice" }));
+    QCOMPARE(removedSpy.count(), 3);
+
+    model->setFilterSyntax(QQmlSortFilterModel::StartsWith);
+    model->setFilterString(QStringLiteral("d"));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "dave" }));
+
+    model->setFilterSyntax(QQmlSortFilterModel::RegularExpression);
+    model->setFilterString(QStringLiteral("^[a-c]"));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "alice", "Bob", "Charlie" }));
+
+    model->setFilterString(QString());
+    QCOMPARE(model->count(), 5);
+    QCOMPARE(model->mapFromSource(3), 3);
+
+    QCOMPARE(resetSpy.count(), 0);
+    QVERIFY(countSpy.count() > 0);
+}
+
+void tst_QQmlSortFilterModel::dataChangedMovesRow()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQmlSortFilterModel> model(createModel(&engine));
+    QVERIFY(model);
+    QAbstractItemModelTester tester(model.data(), QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+    model->setSortRole(QStringLiteral("age"));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "dave", "alice", "Charlie", "Eve", "Bob" }));
+
+    QSignalSpy movedSpy(model.data(), &QAbstractItemModel::rowsMoved);
+    QSignalSpy layoutSpy(model.data(), &QAbstractItemModel::layoutChanged);
+    QSignalSpy dataSpy(model.data(), &QAbstractItemModel::dataChanged);
+
+    QMetaObject::invokeMethod(model.data(), "setAge", Q_ARG(QVariant, 3), Q_ARG(QVariant, 50));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "alice", "Charlie", "Eve", "Bob", "dave" }));
+    QCOMPARE(movedSpy.count(), 1);
+    QCOMPARE(movedSpy.at(0).at(1).toInt(), 0);
+    QCOMPARE(movedSpy.at(0).at(4).toInt(), 5);
+    QCOMPARE(dataSpy.count(), 1);
+    QCOMPARE(dataSpy.at(0).at(0).value<QModelIndex>().row(), 4);
+
+    // A change that keeps the row in place only forwards the data change.
+    QMetaObject::invokeMethod(model.data(), "setAge", Q_ARG(QVariant, 1), Q_ARG(QVariant, 26));
+    QCOMPARE(movedSpy.count(), 1);
+    QCOMPARE(dataSpy.count(), 2);
+    QCOMPARE(layoutSpy.count(), 0);
+}
+
+void tst_QQmlSortFilterModel::sourceInsertRemove()
+{
+    QQmlEngine engine;
+    QScopedPointer<QQmlSortFilterModel> model(createModel(&engine));
+    QVERIFY(model);
+    QAbstractItemModelTester tester(model.data(), QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+    model->setFilterString(QStringLiteral("e"));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "alice", "Charlie", "dave", "Eve" }));
+
+    QSignalSpy insertedSpy(model.data(), &QAbstractItemModel::rowsInserted);
+    QSignalSpy removedSpy(model.data(), &QAbstractItemModel::rowsRemoved);
+
+    QMetaObject::invokeMethod(model.data(), "append", Q_ARG(QVariant, "Beth"), Q_ARG(QVariant, 28));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "alice", "Beth", "Charlie", "dave", "Eve" }));
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(insertedSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(model->mapToSource(1), 5);
+
+    QMetaObject::invokeMethod(model.data(), "append", Q_ARG(QVariant, "Zoltan"), Q_ARG(QVariant, 60));
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(model->count(), 5);
+
+    // Removing "Charlie" shifts the source rows of everything behind it.
+    QMetaObject::invokeMethod(model.data(), "remove", Q_ARG(QVariant, 0));
+    QCOMPARE(values(model.data(), "name"), QStringList({ "alice", "Beth", "dave", "Eve" }));
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 2);
+    QCOMPARE(model->mapToSource(1), 4);
+    QCOMPARE(model->mapFromSource(0), 0);
+
+    // Removing a row that is filtered out is not visible through the proxy.
+    QMetaObject::invokeMethod(model.data(), "remove", Q_ARG(QVariant, 1));
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(model->mapToSource(0), 0);
+}
+
+QTEST_MAIN(tst_QQmlSortFilterModel)
+
+#include "tst_qqmlsortfiltermodel.moc"
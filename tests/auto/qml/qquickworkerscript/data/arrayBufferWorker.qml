@@ -0,0 +1,51 @@
+import QtQuick 2.0
+
+WorkerScript {
+    id: worker
+    source: "script_arraybuffer.js"
+
+    property var shared: new SharedArrayBuffer(4)
+    property int sentLength: -1
+    property int receivedLength: -1
+    property int receivedSum: -1
+    property int sharedValue: -1
+    property bool sameBufferInWorker: false
+    property bool sameCopyInWorker: false
+    property bool sameBuffer: false
+
+    signal done()
+
+    function testTransfer() {
+        var buffer = new ArrayBuffer(16)
+        var bytes = new Uint8Array(buffer)
+        for (var i = 0; i < bytes.length; ++i)
+            bytes[i] = i
+        var copy = new ArrayBuffer(4)
+        worker.sendMessage({ buffer: buffer, alias: buffer, copy: copy, copyAlias: copy, shared: shared },
+                           [ buffer ])
+        sentLength = buffer.byteLength
+    }
+
+    function testInvalidTransfer() {
+        try {
+            worker.sendMessage({}, [ {} ])
+        } catch (e) {
+            return true
+        }
+        return false
+    }
+
+    onMessage: {
+        var bytes = new Uint8Array(messageObject.buffer)
+        var sum = 0
+        for (var i = 0; i < bytes.length; ++i)
+            sum += bytes[i]
+        receivedLength = bytes.length
+        receivedSum = sum
+        sharedValue = new Int32Array(shared)[0]
+        sameBufferInWorker = messageObject.sameBuffer
+        sameCopyInWorker = messageObject.sameCopy
+        sameBuffer = messageObject.buffer === messageObject.alias
+        worker.done()
+    }
+}
@@ -0,0 +1,32 @@
+import QtQuick 2.12
+
+Item {
+    id: root
+
+    property int count: listModel.count
+    property int firstReceived: -1
+    property int secondReceived: -1
+
+    ListModel { id: listModel }
+
+    // Both scripts ask for the same priority, so the pool starts one thread each
+    property WorkerScript first: WorkerScript {
+        source: "script_listmodel_threads.js"
+        onMessage: root.firstReceived = messageObject.received ? 1 : 0
+    }
+
+    property WorkerScript second: WorkerScript {
+        source: "script_listmodel_threads.js"
+        onMessage: root.secondReceived = messageObject.received ? 1 : 0
+    }
+
+    function sendToFirst() {
+        firstReceived = -1
+        first.sendMessage({ model: listModel })
+    }
+
+    function sendToSecond() {
+        secondReceived = -1
+        second.sendMessage({ model: listModel })
+    }
+}
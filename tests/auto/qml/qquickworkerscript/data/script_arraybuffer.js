@@ -0,0 +1,9 @@
+WorkerScript.onMessage = function(msg) {
+    var bytes = new Uint8Array(msg.buffer)
+    for (var i = 0; i < bytes.length; ++i)
+        bytes[i] *= 2
+    new Int32Array(msg.shared)[0] = 42
+    WorkerScript.sendMessage({ buffer: msg.buffer, alias: msg.buffer,
+                              sameBuffer: msg.buffer === msg.alias,
+                              sameCopy: msg.copy === msg.copyAlias }, [ msg.buffer ])
+}
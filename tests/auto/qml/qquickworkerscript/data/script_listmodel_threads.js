@@ -0,0 +1,9 @@
+WorkerScript.onMessage = function(msg) {
+    if (msg.model === undefined) {
+        WorkerScript.sendMessage({ received: false })
+        return
+    }
+    msg.model.append({ value: msg.model.count })
+    msg.model.sync()
+    WorkerScript.sendMessage({ received: true })
+}
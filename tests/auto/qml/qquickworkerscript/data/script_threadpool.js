@@ -0,0 +1,15 @@
+WorkerScript.onMessage = function(msg) {
+    var flag
+    if (msg.action === "wait") {
+        // Only sees the flag if the releasing script runs in parallel
+        flag = new Int32Array(msg.shared)
+        var deadline = Date.now() + 2000
+        while (Atomics.load(flag, 0) === 0 && Date.now() < deadline) {}
+        WorkerScript.sendMessage({ waited: true, released: Atomics.load(flag, 0) === 1 })
+    } else if (msg.action === "release") {
+        flag = new Int32Array(msg.shared)
+        Atomics.store(flag, 0, 1)
+    } else {
+        WorkerScript.sendMessage({ waited: false })
+    }
+}
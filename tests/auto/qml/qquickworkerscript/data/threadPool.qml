@@ -0,0 +1,33 @@
+import QtQuick 2.13
+
+Item {
+    id: root
+
+    property var shared: new SharedArrayBuffer(4)
+    property bool released: false
+    property int handled: 0
+
+    property WorkerScript waiting: WorkerScript {
+        source: "script_threadpool.js"
+        onMessage: {
+            if (messageObject.waited)
+                root.released = messageObject.released
+            ++root.handled
+        }
+    }
+
+    property WorkerScript releasing: WorkerScript {
+        source: "script_threadpool.js"
+        priority: WorkerScript.NormalPriority
+    }
+
+    function startWaiting() {
+        waiting.sendMessage({ action: "wait", shared: shared })
+        waiting.sendMessage({ action: "noop" })
+        waiting.sendMessage({ action: "noop" })
+    }
+
+    function release() {
+        releasing.sendMessage({ action: "release", shared: shared })
+    }
+}
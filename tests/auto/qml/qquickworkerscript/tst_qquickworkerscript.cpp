@@ -42,8 +42,6 @@
 class tst_QQuickWorkerScript : public QQmlDataTest
 {
     Q_OBJECT
-public:
-    tst_QQuickWorkerScript() {}
 private slots:
     void source();
     void messaging();
@@ -51,6 +49,9 @@ private slots:
     void messaging_sendQObjectList();
     void messaging_sendJsObject();
     void messaging_sendExternalObject();
+    void messaging_transferArrayBuffer();
+    void threadPool();
+    void listModelThreads();
     void script_with_pragma();
     void script_included();
     void scriptError_onLoad();
@@ -203,6 +204,87 @@ void tst_QQuickWorkerScript::messaging_sendExternalObject()
     delete obj;
 }
 
+void tst_QQuickWorkerScript::messaging_transferArrayBuffer()
+{
+    QQmlComponent component(&m_engine, testFileUrl("arrayBufferWorker.qml"));
+    QScopedPointer<QQuickWorkerScript> worker(qobject_cast<QQuickWorkerScript*>(component.create()));
+    QVERIFY(worker != nullptr);
+
+    QVERIFY(QMetaObject::invokeMethod(worker.data(), "testTransfer"));
+    // The transferred buffer is detached in the sender
+    QCOMPARE(worker->property("sentLength").toInt(), 0);
+    waitForEchoMessage(worker.data());
+
+    QCOMPARE(worker->property("receivedLength").toInt(), 16);
+    QCOMPARE(worker->property("receivedSum").toInt(), 240);
+    // Written by the worker into the SharedArrayBuffer
+    QCOMPARE(worker->property("sharedValue").toInt(), 42);
+    // A buffer that appears twice in a message is received as one object
+    QVERIFY(worker->property("sameBufferInWorker").toBool());
+    QVERIFY(worker->property("sameCopyInWorker").toBool());
+    QVERIFY(worker->property("sameBuffer").toBool());
+
+    QVariant thrown;
+    QVERIFY(QMetaObject::invokeMethod(worker.data(), "testInvalidTransfer", Q_RETURN_ARG(QVariant, thrown)));
+    QVERIFY(thrown.toBool());
+
+    qApp->processEvents();
+}
+
+void tst_QQuickWorkerScript::threadPool()
+{
+    // A fresh engine, so that no scripts of other tests occupy the pool,
+    // with two threads also on single core machines
+    QQmlEngine engine;
+    QQmlEnginePrivate::get(&engine)->getWorkerScriptEnginePool()->setMaximumThreadCount(2);
+    QQmlComponent component(&engine, testFileUrl("threadPool.qml"));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(root != nullptr);
+
+    QQuickWorkerScript *waiting = qobject_cast<QQuickWorkerScript *>(root->property("waiting").value<QObject *>());
+    QQuickWorkerScript *releasing = qobject_cast<QQuickWorkerScript *>(root->property("releasing").value<QObject *>());
+    QVERIFY(waiting);
+    QVERIFY(releasing);
+    QCOMPARE(waiting->priority(), QQuickWorkerScript::LowestPriority);
+    QCOMPARE(releasing->priority(), QQuickWorkerScript::NormalPriority);
+    QCOMPARE(waiting->pendingMessageCount(), 0);
+
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "startWaiting"));
+    // The first message blocks the thread, the other two stay queued
+    QTRY_COMPARE(waiting->pendingMessageCount(), 2);
+
+    // Only delivered in time if the second script has a thread of its own
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "release"));
+    // The waiting script gives up after 2 seconds, well before the timeout
+    QTRY_COMPARE_WITH_TIMEOUT(root->property("handled").toInt(), 3, 10000);
+    QVERIFY(root->property("released").toBool());
+    QCOMPARE(waiting->pendingMessageCount(), 0);
+}
+
+void tst_QQuickWorkerScript::listModelThreads()
+{
+    QQmlEngine engine;
+    QQmlEnginePrivate::get(&engine)->getWorkerScriptEnginePool()->setMaximumThreadCount(2);
+    QQmlComponent component(&engine, testFileUrl("listModelThreads.qml"));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(root != nullptr);
+
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "sendToFirst"));
+    QTRY_COMPARE(root->property("firstReceived").toInt(), 1);
+    QTRY_COMPARE(root->property("count").toInt(), 1);
+
+    // The second script runs on another thread and must not touch the model
+    QTest::ignoreMessage(QtWarningMsg, "WorkerScript: a ListModel can only be used by the WorkerScripts of one thread; "
+                                       "set QML_WORKERSCRIPT_MAX_THREADS=1 to run all scripts on the same thread");
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "sendToSecond"));
+    QTRY_COMPARE(root->property("secondReceived").toInt(), 0);
+
+    // The first script keeps working on the model
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "sendToFirst"));
+    QTRY_COMPARE(root->property("firstReceived").toInt(), 1);
+    QTRY_COMPARE(root->property("count").toInt(), 2);
+}
+
 void tst_QQuickWorkerScript::script_with_pragma()
 {
     QVariant value(100);
@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qrecyclingallocator
+macx:CONFIG -= app_bundle
+
+SOURCES += tst_qrecyclingallocator.cpp
+
+QT += core-private qml-private testlib
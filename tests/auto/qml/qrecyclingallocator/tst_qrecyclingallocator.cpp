@@ -0,0 +1,149 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qvector.h>
+#include <private/qrecyclingallocator_p.h>
+
+class tst_qrecyclingallocator : public QObject
+{
+    Q_OBJECT
+public:
+    tst_qrecyclingallocator() {}
+
+private slots:
+    void reuse();
+    void differentSize();
+    void freeOnOtherThread();
+    void outliveThread();
+};
+
+static QAtomicInt liveObjects;
+
+class Recycled
+{
+    Q_QML_RECYCLING_ALLOCATOR(Recycled)
+public:
+    Recycled() { liveObjects.ref(); }
+    virtual ~Recycled() { liveObjects.deref(); }
+
+    int value = 0;
+};
+
+class LargerRecycled : public Recycled
+{
+public:
+    char padding[256];
+};
+
+template<typename Function>
+static void runInThread(Function function)
+{
+    QScopedPointer<QThread> thread(QThread::create(function));
+    thread->start();
+    QVERIFY(thread->wait());
+}
+
+void tst_qrecyclingallocator::reuse()
+{
+    Recycled *first = new Recycled;
+    void *memory = first;
+    delete first;
+
+    Recycled *second = new Recycled;
+    QCOMPARE(static_cast<void *>(second), memory);
+    delete second;
+
+    QVector<Recycled *> objects;
+    for (int i = 0; i < 1000; ++i) {
+        objects.append(new Recycled);
+        objects.last()->value = i;
+    }
+    for (int i = 0; i < objects.count(); ++i)
+        QCOMPARE(objects.at(i)->value, i);
+    qDeleteAll(objects);
+    QCOMPARE(liveObjects.load(), 0);
+}
+
+void tst_qrecyclingallocator::differentSize()
+{
+    // Subclasses of another size go through the global allocator.
+    QVector<Recycled *> objects;
+    for (int i = 0; i < 100; ++i) {
+        objects.append(i % 2 ? new LargerRecycled : new Recycled);
+        objects.last()->value = i;
+    }
+    for (int i = 0; i < objects.count(); ++i)
+        QCOMPARE(objects.at(i)->value, i);
+    qDeleteAll(objects);
+    QCOMPARE(liveObjects.load(), 0);
+}
+
+void tst_qrecyclingallocator::freeOnOtherThread()
+{
+    QVector<Recycled *> objects;
+    for (int i = 0; i < 500; ++i)
+        objects.append(new Recycled);
+    Recycled *first = objects.first();
+
+    runInThread([&objects]() { qDeleteAll(objects); });
+    objects.clear();
+    QCOMPARE(liveObjects.load(), 0);
+
+    // Blocks freed elsewhere are handed back to the allocating thread.
+    bool reused = false;
+    for (int i = 0; i < 500; ++i) {
+        objects.append(new Recycled);
+        reused = reused || objects.last() == first;
+    }
+    QVERIFY(reused);
+    qDeleteAll(objects);
+    QCOMPARE(liveObjects.load(), 0);
+}
+
+void tst_qrecyclingallocator::outliveThread()
+{
+    QVector<Recycled *> objects;
+    runInThread([&objects]() {
+        for (int i = 0; i < 500; ++i) {
+            objects.append(new Recycled);
+            objects.last()->value = i;
+        }
+    });
+
+    // The pool of the finished thread stays alive until its last object is gone.
+    for (int i = 0; i < objects.count(); ++i)
+        QCOMPARE(objects.at(i)->value, i);
+    qDeleteAll(objects);
+    QCOMPARE(liveObjects.load(), 0);
+}
+
+QTEST_MAIN(tst_qrecyclingallocator)
+
+#include "tst_qrecyclingallocator.moc"
@@ -31,12 +31,15 @@
 
 #include <QtGui/QOffscreenSurface>
 #include <QtGui/QOpenGLContext>
+#include <QtGui/QOpenGLExtraFunctions>
+#include <QtGui/QOpenGLFramebufferObject>
 #include <QtQuick/qsgnode.h>
 #include <QtQuick/private/qsgbatchrenderer_p.h>
 #include <QtQuick/private/qsgnodeupdater_p.h>
 #include <QtQuick/private/qsgrenderloop_p.h>
 #include <QtQuick/private/qsgcontext_p.h>
 
+#include <QtQuick/qsgflatcolormaterial.h>
 #include <QtQuick/qsgsimplerectnode.h>
 #include <QtQuick/qsgsimpletexturenode.h>
 #include <QtQuick/private/qsgtexture_p.h>
@@ -75,7 +78,13 @@ private Q_SLOTS:
     void textureNodeTextureOwnership();
     void textureNodeRect();
 
+    // Batch renderer
+    void partialBufferUpload();
+
 private:
+    QByteArray bufferContents(GLenum target, const QSGBatchRenderer::Buffer &buffer);
+    QVector<QByteArray> batchBuffers(const QSGBatchRenderer::Renderer &renderer);
+
     QOffscreenSurface *surface = nullptr;
     QOpenGLContext *context = nullptr;
     QSGDefaultRenderContext *renderContext = nullptr;
@@ -363,6 +372,111 @@ void NodesTest::textureNodeRect()
     QCOMPARE(vertices[3], bottomRight);
 }
 
+QByteArray NodesTest::bufferContents(GLenum target, const QSGBatchRenderer::Buffer &buffer)
+{
+    QOpenGLExtraFunctions *funcs = context->extraFunctions();
+    funcs->glBindBuffer(target, buffer.id);
+    QByteArray contents;
+    if (const void *data = funcs->glMapBufferRange(target, 0, buffer.size, GL_MAP_READ_BIT)) {
+        contents = QByteArray(static_cast<const char *>(data), buffer.size);
+        funcs->glUnmapBuffer(target);
+    }
+    funcs->glBindBuffer(target, 0);
+    return contents;
+}
+
+// Reads back what the renderer has uploaded to the buffers of its batches
+QVector<QByteArray> NodesTest::batchBuffers(const QSGBatchRenderer::Renderer &renderer)
+{
+    QVector<QByteArray> buffers;
+    const QDataBuffer<QSGBatchRenderer::Batch *> *batchLists[] = {
+        &renderer.m_opaqueBatches, &renderer.m_alphaBatches
+    };
+    for (const QDataBuffer<QSGBatchRenderer::Batch *> *batches : batchLists) {
+        for (int i = 0; i < batches->size(); ++i) {
+            const QSGBatchRenderer::Batch *batch = batches->at(i);
+            if (!batch->vbo.id)
+                continue;
+            buffers << bufferContents(GL_ARRAY_BUFFER, batch->vbo);
+            if (batch->ibo.id)
+                buffers << bufferContents(GL_ELEMENT_ARRAY_BUFFER, batch->ibo);
+        }
+    }
+    return buffers;
+}
+
+void NodesTest::partialBufferUpload()
+{
+    const QSurfaceFormat format = context->format();
+    if (format.majorVersion() < 3)
+        QSKIP("Reading back buffers needs OpenGL (ES) 3.0");
+
+    QSGRootNode root;
+    QSGFlatColorMaterial material;
+    material.setColor(Qt::red);
+    const int nodeCount = 64;
+    for (int i = 0; i < nodeCount; ++i) {
+        QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 4, 6);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        QSGGeometry::updateRectGeometry(geometry, QRectF(i % 8 * 10, i / 8 * 10, 8, 8));
+        const quint16 indices[] = { 0, 1, 2, 2, 1, 3 };
+        memcpy(geometry->indexDataAsUShort(), indices, sizeof(indices));
+
+        QSGGeometryNode *node = new QSGGeometryNode;
+        node->setGeometry(geometry);
+        node->setMaterial(&material);
+        node->setFlag(QSGNode::OwnsGeometry);
+        root.appendChildNode(node);
+    }
+
+    QSGBatchRenderer::Renderer fullRenderer(renderContext);
+    qputenv("QSG_RENDERER_BUFFER_STRATEGY", "partial");
+    QSGBatchRenderer::Renderer partialRenderer(renderContext);
+    qunsetenv("QSG_RENDERER_BUFFER_STRATEGY");
+    QVERIFY(!fullRenderer.m_partialBufferUpload);
+    QVERIFY(partialRenderer.m_partialBufferUpload);
+
+    QOpenGLFramebufferObject fbo(100, 100);
+    QSGBatchRenderer::Renderer *renderers[] = { &fullRenderer, &partialRenderer };
+    for (QSGBatchRenderer::Renderer *renderer : renderers) {
+        renderer->setRootNode(&root);
+        renderer->setDeviceRect(fbo.size());
+        renderer->setViewportRect(fbo.size());
+        renderer->setProjectionMatrixToRect(QRectF(QPointF(), fbo.size()));
+    }
+
+    for (int frame = 0; frame < 8; ++frame) {
+        // Small changes in the middle of the batch: move one node, or flip
+        // the winding of its triangles
+        QSGGeometryNode *node = static_cast<QSGGeometryNode *>(root.childAtIndex(frame * 7 % nodeCount));
+        QSGGeometry *geometry = node->geometry();
+        if (frame % 2) {
+            quint16 *indices = geometry->indexDataAsUShort();
+            qSwap(indices[1], indices[2]);
+            qSwap(indices[4], indices[5]);
+        } else {
+            QSGGeometry::Point2D *vertices = geometry->vertexDataAsPoint2D();
+            for (int i = 0; i < geometry->vertexCount(); ++i)
+                vertices[i].x += 1;
+        }
+        node->markDirty(QSGNode::DirtyGeometry);
+
+        fullRenderer.renderScene(fbo.handle());
+        partialRenderer.renderScene(fbo.handle());
+
+        const QVector<QByteArray> fullBuffers = batchBuffers(fullRenderer);
+        const QVector<QByteArray> partialBuffers = batchBuffers(partialRenderer);
+        QVERIFY(!fullBuffers.isEmpty());
+        QCOMPARE(partialBuffers.size(), fullBuffers.size());
+        for (int i = 0; i < fullBuffers.size(); ++i)
+            QVERIFY2(partialBuffers.at(i) == fullBuffers.at(i),
+                     qPrintable(QStringLiteral("frame %1, buffer %2").arg(frame).arg(i)));
+    }
+
+    for (QSGBatchRenderer::Renderer *renderer : renderers)
+        renderer->setRootNode(nullptr);
+}
+
 QTEST_MAIN(NodesTest);
 
 #include "tst_nodestest.moc"
@@ -215,6 +215,8 @@ private slots:
 
     void keyNavigationEnabled();
     void releaseItems();
+    void reuseItems();
+    void reuseItemsData();
 
 private:
     QList<int> toIntList(const QVariantList &list);
@@ -6804,6 +6806,84 @@ void tst_QQuickGridView::releaseItems()
     gridview->setModel(123);
 }
 
+void tst_QQuickGridView::reuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItems.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickGridView *gridview = qobject_cast<QQuickGridView *>(window->rootObject());
+    QVERIFY(gridview);
+    QVERIFY(gridview->reuseItems());
+    QQuickItemViewPrivate *priv = QQuickItemViewPrivate::get(gridview);
+
+    QVERIFY(gridview->property("delegatesCreatedCount").toInt() > 0);
+    QCOMPARE(priv->model->poolSize(), 0);
+
+    // Flick through the grid one row at a time. The rows flicked out at the
+    // top should be recycled for the rows flicked in at the bottom.
+    gridview->setContentY(50.0);
+    const int createdAfterFirstFlick = gridview->property("delegatesCreatedCount").toInt();
+    QVERIFY(priv->model->poolSize() > 0);
+    for (int i = 2; i <= 50; ++i) {
+        gridview->setContentY(i * 40.0 + 10.0);
+        QCOMPARE(gridview->property("delegatesCreatedCount").toInt(), createdAfterFirstFlick);
+    }
+
+    // Every visible item must show the data for its new index
+    bool foundReusedItem = false;
+    for (FxViewItem *item : qAsConst(priv->visibleItems)) {
+        QCOMPARE(item->item->property("modelIndex").toInt(), item->index);
+        if (item->item->property("reusedCount").toInt() > 0) {
+            QVERIFY(item->item->property("pooledCount").toInt() > 0);
+            foundReusedItem = true;
+        }
+    }
+    QVERIFY(foundReusedItem);
+
+    // Turning reuse off must drain the pool, and stop pooling
+    gridview->setReuseItems(false);
+    QCOMPARE(priv->model->poolSize(), 0);
+    gridview->setContentY(60 * 40.0);
+    QCOMPARE(priv->model->poolSize(), 0);
+}
+
+void tst_QQuickGridView::reuseItemsData()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItemsData.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickGridView *gridview = qobject_cast<QQuickGridView *>(window->rootObject());
+    QVERIFY(gridview);
+    QVERIFY(gridview->reuseItems());
+    QQuickItemViewPrivate *priv = QQuickItemViewPrivate::get(gridview);
+    QTRY_COMPARE(priv->polishScheduled, false);
+
+    // Flick down and back up. On every frame, each visible delegate,
+    // recycled or not, must show the row of the model it is placed at.
+    const qreal velocities[] = { -2500, 2500 };
+    for (qreal velocity : velocities) {
+        gridview->flick(0, velocity);
+        QVERIFY(gridview->isFlicking());
+        QElapsedTimer timer;
+        timer.start();
+        while (gridview->isMoving() && timer.elapsed() < 10000) {
+            QTest::qWait(16);
+            for (FxViewItem *item : qAsConst(priv->visibleItems)) {
+                if (item->index < 0)
+                    continue;
+                QCOMPARE(item->item->property("modelIndex").toInt(), item->index);
+                QCOMPARE(item->item->property("modelLabel").toString(), QStringLiteral("cell %1").arg(item->index));
+                QCOMPARE(item->item->property("modelValue").toInt(), item->index * 3);
+            }
+        }
+        QVERIFY(!gridview->isMoving());
+    }
+}
+
 QTEST_MAIN(tst_QQuickGridView)
 
 #include "tst_qquickgridview.moc"
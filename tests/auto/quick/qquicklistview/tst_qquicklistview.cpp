@@ -280,6 +280,10 @@ private slots:
     void setPositionOnLayout();
     void touchCancel();
     void resizeAfterComponentComplete();
+    void reuseItems();
+    void reuseItemsData();
+    void prefetch();
+    void sizeRole();
 
 private:
     template <class T> void items(const QUrl &source);
@@ -9632,6 +9636,155 @@ void tst_QQuickListView::resizeAfterComponentComplete()  // QTBUG-76487
     QTRY_COMPARE(lastItem->property("y").toInt(), 9 * lastItem->property("height").toInt());
 }
 
+void tst_QQuickListView::reuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItems.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview);
+    QVERIFY(listview->reuseItems());
+    QQuickItemViewPrivate *priv = QQuickItemViewPrivate::get(listview);
+
+    QVERIFY(listview->property("delegatesCreatedCount").toInt() > 0);
+    QCOMPARE(priv->model->poolSize(), 0);
+
+    // Flick through the list one delegate at a time. Once the first flick has put
+    // an item into the pool, the items flicked out at the top should be recycled
+    // for the ones flicked in at the bottom, so no new delegates should be created.
+    listview->setContentY(50.0);
+    const int createdAfterFirstFlick = listview->property("delegatesCreatedCount").toInt();
+    QVERIFY(priv->model->poolSize() > 0);
+    for (int i = 2; i <= 50; ++i) {
+        listview->setContentY(i * 40.0 + 10.0);
+        QCOMPARE(listview->property("delegatesCreatedCount").toInt(), createdAfterFirstFlick);
+    }
+
+    // Every visible item must show the data for its new index
+    bool foundReusedItem = false;
+    for (FxViewItem *item : qAsConst(priv->visibleItems)) {
+        QCOMPARE(item->item->property("modelIndex").toInt(), item->index);
+        if (item->item->property("reusedCount").toInt() > 0) {
+            QVERIFY(item->item->property("pooledCount").toInt() > 0);
+            foundReusedItem = true;
+        }
+    }
+    QVERIFY(foundReusedItem);
+
+    // Turning reuse off must drain the pool, and stop pooling
+    listview->setReuseItems(false);
+    QCOMPARE(priv->model->poolSize(), 0);
+    listview->setContentY(60 * 40.0);
+    QCOMPARE(priv->model->poolSize(), 0);
+}
+
+void tst_QQuickListView::reuseItemsData()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItemsData.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview);
+    QVERIFY(listview->reuseItems());
+    QQuickItemViewPrivate *priv = QQuickItemViewPrivate::get(listview);
+    QTRY_COMPARE(priv->polishScheduled, false);
+
+    // Flick down and back up. On every frame, each visible delegate,
+    // recycled or not, must show the row of the model it is placed at.
+    const qreal velocities[] = { -2500, 2500 };
+    for (qreal velocity : velocities) {
+        listview->flick(0, velocity);
+        QVERIFY(listview->isFlicking());
+        QElapsedTimer timer;
+        timer.start();
+        while (listview->isMoving() && timer.elapsed() < 10000) {
+            QTest::qWait(16);
+            for (FxViewItem *item : qAsConst(priv->visibleItems)) {
+                if (item->index < 0)
+                    continue;
+                QCOMPARE(item->item->property("modelIndex").toInt(), item->index);
+                QCOMPARE(item->item->property("modelLabel").toString(), QStringLiteral("row %1").arg(item->index));
+                QCOMPARE(item->item->property("modelValue").toInt(), item->index * 3);
+            }
+        }
+        QVERIFY(!listview->isMoving());
+    }
+}
+
+void tst_QQuickListView::prefetch()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("prefetch.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview);
+    QVERIFY(listview->prefetch());
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+
+    // Without a cache buffer, a resting view only creates what it shows
+    QVERIFY(listview->property("highestCreatedIndex").toInt() <= 8);
+
+    // While flicking towards the end, delegates below the view are created ahead of time
+    listview->flick(0, -2000);
+    QVERIFY(listview->isFlicking());
+    QTRY_VERIFY(listview->property("highestCreatedIndex").toInt()
+                > listview->indexAt(0, listview->contentY() + listview->height() - 1) + 1);
+    QTRY_VERIFY(!listview->isMoving());
+}
+
+void tst_QQuickListView::sizeRole()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("sizeRole.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview);
+    QCOMPARE(listview->sizeRole(), QLatin1String("rowHeight"));
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+    QCOMPARE(listview->count(), 1000);
+
+    // Every fourth row is 80 high, the rest are 20
+    QCOMPARE(listview->contentHeight(), 35000.0);
+
+    // Jumping far ahead lands exactly on the item, without creating the items in between
+    const int createdCount = listview->property("createdCount").toInt();
+    listview->positionViewAtIndex(500, QQuickListView::Beginning);
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+    QCOMPARE(listview->contentY(), 17500.0);
+    QCOMPARE(listview->indexAt(0, listview->contentY()), 500);
+    QCOMPARE(listview->contentHeight(), 35000.0);
+    QVERIFY(listview->property("createdCount").toInt() - createdCount < 40);
+
+    // Changing the size of an item that hasn't been created updates the content size
+    QVERIFY(QMetaObject::invokeMethod(listview, "resize", Q_ARG(QVariant, 999), Q_ARG(QVariant, 120)));
+    QTRY_COMPARE(listview->contentHeight(), 35100.0);
+    QCOMPARE(listview->contentY(), 17500.0);
+    QCOMPARE(listview->indexAt(0, listview->contentY()), 500);
+
+    QVERIFY(QMetaObject::invokeMethod(listview, "resize", Q_ARG(QVariant, 1), Q_ARG(QVariant, 50)));
+    QTRY_COMPARE(listview->contentHeight(), 35130.0);
+    QCOMPARE(listview->indexAt(0, listview->contentY()), 500);
+
+    // Inserting and removing items before the end keeps the sizes of the other items
+    QVERIFY(QMetaObject::invokeMethod(listview, "insertRow", Q_ARG(QVariant, 100), Q_ARG(QVariant, 200)));
+    QTRY_COMPARE(listview->contentHeight(), 35330.0);
+    QCOMPARE(listview->indexAt(0, listview->contentY()), 501);
+
+    // Row 200 is now the original row 199, which is 20 high
+    QVERIFY(QMetaObject::invokeMethod(listview, "removeRow", Q_ARG(QVariant, 200)));
+    QTRY_COMPARE(listview->contentHeight(), 35310.0);
+    QCOMPARE(listview->indexAt(0, listview->contentY()), 500);
+    QVERIFY(listview->property("createdCount").toInt() - createdCount < 80);
+}
+
 QTEST_MAIN(tst_QQuickListView)
 
 #include "tst_qquicklistview.moc"
@@ -157,6 +157,7 @@ private slots:
     void useDelegateChooserWithoutDefault();
     void checkTableviewInsideAsyncLoader();
     void checkThatRevisionedPropertiesCannotBeUsedInOldImports();
+    void prefetchAndReverseFlick();
 };
 
 tst_QQuickTableView::tst_QQuickTableView()
@@ -2015,6 +2016,50 @@ void tst_QQuickTableView::checkThatRevisionedPropertiesCannotBeUsedInOldImports(
     QCOMPARE(resolvedColumn, 42);
 }
 
+void tst_QQuickTableView::prefetchAndReverseFlick()
+{
+    // Check that rows prefetched ahead of a flick are dropped again, and that
+    // the ones still incubating do not disturb the table, when the flick
+    // changes direction before reaching them.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    auto model = TestModelAsVariant(1000, 4);
+    tableView->setModel(model);
+    tableView->setPrefetch(true);
+
+    WAIT_UNTIL_POLISHED;
+
+    QVERIFY(tableViewPrivate->prefetchedItems.isEmpty());
+
+    tableView->flick(0, -2000);
+    QVERIFY(tableView->isFlicking());
+    QTRY_VERIFY(tableView->contentY() > 500);
+    QTRY_VERIFY(!tableViewPrivate->prefetchedItems.isEmpty());
+
+    // Flick back towards the top. Only rows above the table are upcoming now.
+    tableView->flick(0, 2000);
+    const auto prefetchingAboveTable = [=]() {
+        if (tableViewPrivate->prefetchedItems.isEmpty())
+            return false;
+        const auto keys = tableViewPrivate->prefetchedItems.keys();
+        for (int modelIndex : keys) {
+            if (tableViewPrivate->cellAtModelIndex(modelIndex).y() >= tableViewPrivate->loadedTable.top())
+                return false;
+        }
+        return true;
+    };
+    QTRY_VERIFY(prefetchingAboveTable());
+
+    // Once the view rests, nothing is prefetched and the table covers the viewport
+    QTRY_VERIFY(!tableView->isMoving());
+    QTRY_VERIFY(!tableViewPrivate->polishScheduled);
+    QVERIFY(tableViewPrivate->prefetchedItems.isEmpty());
+    QVERIFY(!tableViewPrivate->loadRequest.isActive());
+    QVERIFY(tableViewPrivate->loadedTableOuterRect.top() <= tableView->contentY());
+    QVERIFY(tableViewPrivate->loadedTableOuterRect.bottom() >= tableView->contentY() + tableView->height()
+            || tableViewPrivate->loadedTable.bottom() == 999);
+}
+
 QTEST_MAIN(tst_QQuickTableView)
 
 #include "tst_qquicktableview.moc"
@@ -0,0 +1,15 @@
+import QtQuick 2.0
+
+ListView {
+    width: 100
+    height: 300
+    cacheBuffer: 0
+    model: myModel
+    delegate: Item {
+        objectName: "delegate"
+        width: 100
+        height: 20
+        property string label: name + ":" + number
+        property string title: name
+    }
+}
@@ -42,6 +42,7 @@
 #include <QtQml/private/qqmldelegatemodel_p.h>
 #include <private/qqmlvaluetype_p.h>
 #include <private/qqmlchangeset_p.h>
+#include <private/qqmladaptormodel_p.h>
 #include <private/qqmlengine_p.h>
 #include <math.h>
 #include <QtGui/qstandarditemmodel.h>
@@ -371,6 +372,68 @@ public Q_SLOTS:
     }
 };
 
+class RoleDataModel : public QAbstractListModel, public QQmlAdaptorModelRoleDataInterface
+{
+    Q_OBJECT
+    Q_INTERFACES(QQmlAdaptorModelRoleDataInterface)
+public:
+    enum Roles { Name = Qt::UserRole, Number };
+
+    RoleDataModel(int count, QObject *parent = nullptr)
+        : QAbstractListModel(parent), m_count(count) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : m_count;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        ++dataCalls;
+        return value(index.row(), role);
+    }
+
+    QHash<int, QByteArray> roleNames() const override
+    {
+        QHash<int, QByteArray> roles;
+        roles[Name] = "name";
+        roles[Number] = "number";
+        return roles;
+    }
+
+    QVector<QVariant> roleData(
+            const QModelIndex &, int, int first, int last, const QVector<int> &roles) const override
+    {
+        ++roleDataCalls;
+        QVector<QVariant> values;
+        for (int row = first; row <= last; ++row) {
+            for (int role : roles)
+                values.append(value(row, role));
+        }
+        return values;
+    }
+
+    void setSuffix(const QString &suffix)
+    {
+        m_suffix = suffix;
+        emit dataChanged(index(0), index(m_count - 1), QVector<int>() << Name);
+    }
+
+    mutable int dataCalls = 0;
+    mutable int roleDataCalls = 0;
+
+private:
+    QVariant value(int row, int role) const
+    {
+        if (role == Name)
+            return QString(QLatin1String("Item") + QString::number(row) + m_suffix);
+        return row * 10;
+    }
+
+    int m_count;
+    QString m_suffix;
+};
+
 QML_DECLARE_TYPE(SingleRoleModel)
 QML_DECLARE_TYPE(DataObject)
 QML_DECLARE_TYPE(StandardItem)
@@ -432,6 +495,7 @@ private slots:
     void asynchronousCancel();
     void invalidContext();
     void externalManagedModel();
+    void roleDataBatching();
 
 private:
     template <int N> void groups_verify(
@@ -4302,6 +4366,38 @@ void tst_qquickvisualdatamodel::externalManagedModel()
     QTRY_VERIFY(!object->property("running").toBool());
 }
 
+void tst_qquickvisualdatamodel::roleDataBatching()
+{
+    RoleDataModel model(100);
+
+    QQuickView view;
+    view.rootContext()->setContextProperty("myModel", &model);
+    view.setSource(testFileUrl("roleData.qml"));
+
+    QQuickListView *listview = qobject_cast<QQuickListView*>(view.rootObject());
+    QVERIFY(listview != nullptr);
+    QQuickItem *contentItem = listview->contentItem();
+    QVERIFY(contentItem != nullptr);
+
+    QQuickItem *delegate = findItem<QQuickItem>(contentItem, "delegate", 3);
+    QVERIFY(delegate);
+    QCOMPARE(delegate->property("label").toString(), QString("Item3:30"));
+    QCOMPARE(delegate->property("title").toString(), QString("Item3"));
+
+    // The roles of all visible rows come from a couple of batched calls: one
+    // per role while the first delegate discovers which roles it uses.
+    QCOMPARE(model.dataCalls, 0);
+    QVERIFY(model.roleDataCalls <= 3);
+
+    // Changed roles are fetched again; the others stay cached
+    const int roleDataCalls = model.roleDataCalls;
+    model.setSuffix(QLatin1String("!"));
+    QCOMPARE(delegate->property("label").toString(), QString("Item3!:30"));
+    QCOMPARE(delegate->property("title").toString(), QString("Item3!"));
+    QCOMPARE(model.dataCalls, 0);
+    QVERIFY(model.roleDataCalls - roleDataCalls <= 2);
+}
+
 QTEST_MAIN(tst_qquickvisualdatamodel)
 
 #include "tst_qquickvisualdatamodel.moc"
@@ -43,6 +43,7 @@
 #include "../shared/viewtestutil.h"
 #include <QSignalSpy>
 #include <private/qquickwindow_p.h>
+#include <private/qquickframestatistics_p.h>
 #include <private/qguiapplication_p.h>
 #include <QRunnable>
 #include <QOpenGLFunctions>
@@ -420,6 +421,9 @@ private slots:
     void grab();
     void multipleWindows();
 
+    void frameStatistics();
+    void frameStatisticsRecording();
+
     void animationsWhileHidden();
 
     void focusObject();
@@ -1510,6 +1514,66 @@ void tst_qquickwindow::grab()
     }
 }
 
+void tst_qquickwindow::frameStatistics()
+{
+    QQuickFrameStatistics statistics(4);
+    QCOMPARE(statistics.frameCount(), 0);
+    QCOMPARE(statistics.percentile(QQuickFrameStatistics::SyncTime, 50), qint64(0));
+
+    for (int i = 1; i <= 6; ++i) {
+        statistics.recordPolish(10 * i);
+        statistics.finishFrame(i, 2 * i, 3 * i);
+    }
+
+    // Only the last four frames are kept, oldest first
+    const QVector<QQuickFrameRecord> frames = statistics.frames();
+    QCOMPARE(frames.size(), 4);
+    for (int i = 0; i < frames.size(); ++i) {
+        QCOMPARE(frames.at(i).syncTime, qint64(i + 3));
+        QCOMPARE(frames.at(i).renderTime, qint64(2 * (i + 3)));
+        QCOMPARE(frames.at(i).swapTime, qint64(3 * (i + 3)));
+        QCOMPARE(frames.at(i).polishTime, qint64(10 * (i + 3)));
+    }
+
+    QCOMPARE(statistics.percentile(QQuickFrameStatistics::SyncTime, 0), qint64(3));
+    QCOMPARE(statistics.percentile(QQuickFrameStatistics::SyncTime, 50), qint64(4));
+    QCOMPARE(statistics.percentile(QQuickFrameStatistics::SyncTime, 90), qint64(6));
+    QCOMPARE(statistics.percentile(QQuickFrameStatistics::SwapTime, 100), qint64(18));
+
+    // Frames are only missed while animating
+    QCOMPARE(statistics.missedFrameCount(), 0);
+
+    statistics.reset();
+    QCOMPARE(statistics.frameCount(), 0);
+    QVERIFY(statistics.frames().isEmpty());
+}
+
+void tst_qquickwindow::frameStatisticsRecording()
+{
+    QQuickWindow window;
+    window.setTitle(QTest::currentTestFunction());
+    window.resize(100, 100);
+
+    QVERIFY(!window.frameStatistics());
+    QQuickFrameStatistics *statistics = window.enableFrameStatistics(16);
+    QVERIFY(statistics);
+    QCOMPARE(window.enableFrameStatistics(), statistics);
+    QCOMPARE(window.frameStatistics(), statistics);
+    QCOMPARE(statistics->capacity(), 16);
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    window.setColor(Qt::green);
+    window.update();
+    QTRY_VERIFY(statistics->frameCount() >= 1);
+    for (const QQuickFrameRecord &frame : statistics->frames()) {
+        QVERIFY(frame.renderTime >= 0);
+        QVERIFY(frame.syncTime >= 0);
+        QVERIFY(frame.swapTime >= 0);
+    }
+}
+
 void tst_qquickwindow::multipleWindows()
 {
     QList<QQuickWindow *> windows;
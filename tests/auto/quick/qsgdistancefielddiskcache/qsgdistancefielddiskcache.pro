@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qsgdistancefielddiskcache
+macx:CONFIG -= app_bundle
+
+SOURCES += tst_qsgdistancefielddiskcache.cpp
+
+QT += core-private gui-private quick-private testlib
@@ -0,0 +1,130 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtCore/qtemporarydir.h>
+#include <QtGui/qfont.h>
+#include <QtGui/qrawfont.h>
+#include <private/qsgdistancefielddiskcache_p.h>
+
+class tst_qsgdistancefielddiskcache : public QObject
+{
+    Q_OBJECT
+public:
+    tst_qsgdistancefielddiskcache() {}
+
+private slots:
+    void initTestCase();
+    void roundTrip();
+    void concurrentWriters();
+
+private:
+    QVector<QDistanceField> generate(const QString &text) const;
+    static bool equal(const QDistanceField &a, const QDistanceField &b);
+
+    QTemporaryDir m_cacheDir;
+    QRawFont m_font;
+};
+
+void tst_qsgdistancefielddiskcache::initTestCase()
+{
+    QVERIFY(m_cacheDir.isValid());
+    // Read once by the first QSGDistanceFieldDiskCache::create()
+    qputenv("QSG_DISTANCEFIELD_CACHE_DIR", QFile::encodeName(m_cacheDir.path()));
+
+    m_font = QRawFont::fromFont(QFont());
+    if (!m_font.isValid() || m_font.fontTable("head").isEmpty())
+        QSKIP("The default font cannot be identified for the disk cache");
+}
+
+QVector<QDistanceField> tst_qsgdistancefielddiskcache::generate(const QString &text) const
+{
+    QVector<QDistanceField> fields;
+    const QVector<quint32> glyphs = m_font.glyphIndexesForString(text);
+    for (quint32 glyph : glyphs)
+        fields.append(QDistanceField(m_font, glyph));
+    return fields;
+}
+
+bool tst_qsgdistancefielddiskcache::equal(const QDistanceField &a, const QDistanceField &b)
+{
+    return a.width() == b.width() && a.height() == b.height()
+            && memcmp(a.constBits(), b.constBits(), size_t(a.width()) * a.height()) == 0;
+}
+
+void tst_qsgdistancefielddiskcache::roundTrip()
+{
+    const QVector<QDistanceField> fields = generate(QStringLiteral("AbQ"));
+
+    {
+        QScopedPointer<QSGDistanceFieldDiskCache> cache(QSGDistanceFieldDiskCache::create(m_font, false));
+        QVERIFY(cache);
+        for (const QDistanceField &field : fields) {
+            QVERIFY(cache->glyph(field.glyph()).isNull());
+            cache->insert(field);
+        }
+        QVERIFY(cache->save());
+    }
+
+    QScopedPointer<QSGDistanceFieldDiskCache> cache(QSGDistanceFieldDiskCache::create(m_font, false));
+    QVERIFY(cache);
+    for (const QDistanceField &field : fields) {
+        const QDistanceField loaded = cache->glyph(field.glyph());
+        QVERIFY(!loaded.isNull());
+        QVERIFY(equal(loaded, field));
+    }
+
+    // A different resolution is stored in a different file
+    QScopedPointer<QSGDistanceFieldDiskCache> doubleCache(QSGDistanceFieldDiskCache::create(m_font, true));
+    QVERIFY(doubleCache);
+    QVERIFY(doubleCache->glyph(fields.first().glyph()).isNull());
+}
+
+// Two caches that were loaded before either saved must not drop each
+// other's glyphs.
+void tst_qsgdistancefielddiskcache::concurrentWriters()
+{
+    const QVector<QDistanceField> first = generate(QStringLiteral("x"));
+    const QVector<QDistanceField> second = generate(QStringLiteral("y"));
+
+    QScopedPointer<QSGDistanceFieldDiskCache> a(QSGDistanceFieldDiskCache::create(m_font, false));
+    QScopedPointer<QSGDistanceFieldDiskCache> b(QSGDistanceFieldDiskCache::create(m_font, false));
+    QVERIFY(a && b);
+    a->insert(first.first());
+    b->insert(second.first());
+    QVERIFY(a->save());
+    QVERIFY(b->save());
+
+    QScopedPointer<QSGDistanceFieldDiskCache> cache(QSGDistanceFieldDiskCache::create(m_font, false));
+    QVERIFY(equal(cache->glyph(first.first().glyph()), first.first()));
+    QVERIFY(equal(cache->glyph(second.first().glyph()), second.first()));
+}
+
+QTEST_MAIN(tst_qsgdistancefielddiskcache)
+
+#include "tst_qsgdistancefielddiskcache.moc"
@@ -0,0 +1,63 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.12
+
+// Overlapping, rotated, translucent and text content across the whole
+// window, so that every band boundary cuts through something.
+Rectangle {
+    width: 640
+    height: 480
+    color: "white"
+
+    Repeater {
+        model: 24
+        Rectangle {
+            x: (index % 6) * 100 + 10
+            y: Math.floor(index / 6) * 110 + 15
+            width: 120
+            height: 90
+            rotation: index * 7
+            radius: index % 3 * 10
+            opacity: 0.5 + (index % 2) * 0.5
+            border.width: 3
+            border.color: "black"
+            gradient: Gradient {
+                GradientStop { position: 0; color: Qt.hsla(index / 24, 0.8, 0.5, 1) }
+                GradientStop { position: 1; color: "yellow" }
+            }
+
+            Text {
+                anchors.centerIn: parent
+                text: "Band " + index
+                font.pixelSize: 18
+                rotation: -parent.rotation / 2
+            }
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.12
+
+Rectangle {
+    width: 400
+    height: 400
+    color: "white"
+
+    Rectangle { x: 50; y: 50; width: 300; height: 300; color: "lightsteelblue" }
+    Rectangle { x: 100; y: 100; width: 200; height: 100; color: "steelblue" }
+    Rectangle { objectName: "lower"; x: 10; y: 10; width: 20; height: 20; color: "red" }
+    Rectangle { x: 150; y: 250; width: 100; height: 100; color: "navy" }
+    Rectangle { objectName: "upper"; x: 10; y: 370; width: 20; height: 20; color: "green" }
+}
@@ -0,0 +1,66 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.12
+
+// A static scene under a large moving item, so that each update is large
+// enough to be painted in bands while the scene is in the retained image.
+Rectangle {
+    width: 640
+    height: 480
+    color: "white"
+
+    Repeater {
+        model: 24
+        Rectangle {
+            x: (index % 6) * 100 + 10
+            y: Math.floor(index / 6) * 110 + 15
+            width: 120
+            height: 90
+            rotation: index * 7
+            border.width: 3
+            border.color: "black"
+            color: Qt.hsla(index / 24, 0.8, 0.5, 1)
+
+            Text {
+                anchors.centerIn: parent
+                text: "Cell " + index
+                font.pixelSize: 18
+            }
+        }
+    }
+
+    Rectangle {
+        objectName: "mover"
+        x: 100
+        y: 40
+        width: 400
+        height: 400
+        color: "#8000ff00"
+    }
+}
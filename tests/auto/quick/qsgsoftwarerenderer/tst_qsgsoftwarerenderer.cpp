@@ -0,0 +1,249 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtQuick/qquickitem.h>
+#include <QtQuick/qquickview.h>
+#include <private/qquickwindow_p.h>
+#include <private/qsgabstractsoftwarerenderer_p.h>
+
+#include "../../shared/util.h"
+
+class tst_qsgsoftwarerenderer : public QQmlDataTest
+{
+    Q_OBJECT
+public:
+    tst_qsgsoftwarerenderer() {}
+
+private slots:
+    void initTestCase() override;
+    void bands();
+    void dirtyRegion();
+    void growRetainedImage();
+    void retainedImageInBands();
+    void boundedRegion_data();
+    void boundedRegion();
+
+private:
+    static QSGAbstractSoftwareRenderer *renderer(QQuickWindow *window);
+};
+
+void tst_qsgsoftwarerenderer::initTestCase()
+{
+    QQmlDataTest::initTestCase();
+    QQuickWindow::setSceneGraphBackend(QSGRendererInterface::Software);
+}
+
+QSGAbstractSoftwareRenderer *tst_qsgsoftwarerenderer::renderer(QQuickWindow *window)
+{
+    return static_cast<QSGAbstractSoftwareRenderer *>(QQuickWindowPrivate::get(window)->renderer);
+}
+
+// Painting in several bands on worker threads must give exactly the same
+// pixels as painting with a single painter.
+void tst_qsgsoftwarerenderer::bands()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("bands.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QVERIFY(renderer(&view));
+
+    renderer(&view)->setRenderThreadCount(1);
+    renderer(&view)->markDirty();
+    const QImage single = view.grabWindow();
+    if (single.isNull())
+        QSKIP("The platform cannot grab software rendered windows");
+
+    for (int threads : { 2, 3, 8 }) {
+        renderer(&view)->setRenderThreadCount(threads);
+        renderer(&view)->markDirty();
+        const QImage banded = view.grabWindow();
+        QCOMPARE(banded.size(), single.size());
+        QVERIFY2(banded == single, qPrintable(QString::fromLatin1("%1 bands differ").arg(threads)));
+    }
+}
+
+// Moving one small item repaints only its old and new area, and gives the
+// same pixels as a full repaint.
+void tst_qsgsoftwarerenderer::dirtyRegion()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("dirtyRegion.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QSGAbstractSoftwareRenderer *softwareRenderer = renderer(&view);
+    QVERIFY(softwareRenderer);
+    softwareRenderer->setRenderThreadCount(1);
+
+    QQuickItem *lower = view.rootObject()->findChild<QQuickItem *>("lower");
+    QVERIFY(lower);
+    for (int i = 0; i < 5; ++i) {
+        lower->setX(lower->x() + 30);
+        const QImage image = view.grabWindow();
+        if (image.isNull())
+            QSKIP("The platform cannot grab software rendered windows");
+
+        // The old and the new position of the 20x20 item
+        const QSGAbstractSoftwareRenderer::PaintStatistics &statistics = softwareRenderer->paintStatistics();
+        QVERIFY2(statistics.dirtyPixels >= 2 * 20 * 20 && statistics.dirtyPixels <= 2 * 22 * 22,
+                 qPrintable(QString::number(statistics.dirtyPixels)));
+        QVERIFY(statistics.paintedPixels < 400 * 400 / 10);
+
+        softwareRenderer->markDirty();
+        QCOMPARE(view.grabWindow(), image);
+    }
+}
+
+// When more nodes become static, only those are painted into the retained
+// image, on top of the ones it already holds.
+void tst_qsgsoftwarerenderer::growRetainedImage()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("dirtyRegion.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QSGAbstractSoftwareRenderer *softwareRenderer = renderer(&view);
+    QVERIFY(softwareRenderer);
+    softwareRenderer->setRenderThreadCount(1);
+
+    QQuickItem *lower = view.rootObject()->findChild<QQuickItem *>("lower");
+    QQuickItem *upper = view.rootObject()->findChild<QQuickItem *>("upper");
+    QVERIFY(lower && upper);
+
+    int firstRetained = 0;
+    int lastRetained = 0;
+    int painted = 0;
+    for (int frame = 0; frame < 20; ++frame) {
+        upper->setX(frame % 2 ? 10 : 40);
+        if (frame < 6)
+            lower->setX(frame % 2 ? 10 : 40);
+        const QImage image = view.grabWindow();
+        if (image.isNull())
+            QSKIP("The platform cannot grab software rendered windows");
+
+        const QSGAbstractSoftwareRenderer::PaintStatistics &statistics = softwareRenderer->paintStatistics();
+        painted += statistics.retainedNodesPainted;
+        if (!firstRetained)
+            firstRetained = statistics.retainedNodes;
+        lastRetained = statistics.retainedNodes;
+    }
+
+    // The retained part grew once the lower item stopped moving, and every
+    // node was painted into the image only once
+    QVERIFY(firstRetained > 0);
+    QVERIFY(lastRetained > firstRetained);
+    QCOMPARE(painted, lastRetained);
+}
+
+// Large updates are painted in bands, which also copy the static bottom of
+// the scene from the retained image, and give the same pixels as a single
+// painter repainting everything.
+void tst_qsgsoftwarerenderer::retainedImageInBands()
+{
+    QQuickView view;
+    view.setSource(testFileUrl("retainedBands.qml"));
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QSGAbstractSoftwareRenderer *softwareRenderer = renderer(&view);
+    QVERIFY(softwareRenderer);
+    softwareRenderer->setRenderThreadCount(4);
+
+    QQuickItem *mover = view.rootObject()->findChild<QQuickItem *>("mover");
+    QVERIFY(mover);
+
+    int comparedFrames = 0;
+    for (int frame = 0; frame < 12; ++frame) {
+        mover->setX(frame % 2 ? 100 : 140);
+        const QImage image = view.grabWindow();
+        if (image.isNull())
+            QSKIP("The platform cannot grab software rendered windows");
+
+        const QSGAbstractSoftwareRenderer::PaintStatistics &statistics = softwareRenderer->paintStatistics();
+        QVERIFY(statistics.dirtyPixels >= 256 * 256);
+        if (statistics.retainedNodes == 0)
+            continue;
+
+        softwareRenderer->setRenderThreadCount(1);
+        softwareRenderer->markDirty();
+        QCOMPARE(view.grabWindow(), image);
+        softwareRenderer->setRenderThreadCount(4);
+        ++comparedFrames;
+    }
+
+    QVERIFY(comparedFrames > 0);
+}
+
+void tst_qsgsoftwarerenderer::boundedRegion_data()
+{
+    QTest::addColumn<QRegion>("region");
+    QTest::addColumn<int>("expectedRects");
+
+    // The default limit, QSG_SOFTWARE_MAX_DIRTY_RECTS, is 32 rects
+    QRegion few;
+    for (int i = 0; i < 32; ++i)
+        few += QRect(i * 10, i * 10, 4, 4);
+    QTest::newRow("at limit") << few << 32;
+
+    QRegion grid;
+    for (int y = 0; y < 10; ++y) {
+        for (int x = 0; x < 10; ++x)
+            grid += QRect(x * 20, y * 20, 2, 2);
+    }
+    QTest::newRow("grid") << grid << -1;
+
+    QRegion row;
+    for (int x = 0; x < 50; ++x)
+        row += QRect(x * 4, 0, 2, 2);
+    QTest::newRow("row") << row << 1;
+
+    QRegion diagonal;
+    for (int i = 0; i < 100; ++i)
+        diagonal += QRect(i * 10, i * 10, 4, 4);
+    QTest::newRow("diagonal") << diagonal << -1;
+}
+
+void tst_qsgsoftwarerenderer::boundedRegion()
+{
+    QFETCH(QRegion, region);
+    QFETCH(int, expectedRects);
+
+    const QRegion bounded = QSGAbstractSoftwareRenderer::boundedRegion(region);
+
+    QVERIFY(bounded.rectCount() <= 32);
+    if (expectedRects >= 0)
+        QCOMPARE(bounded.rectCount(), expectedRects);
+    QVERIFY((region - bounded).isEmpty());
+    QCOMPARE(bounded.boundingRect(), region.boundingRect());
+    if (region.rectCount() <= 32)
+        QCOMPARE(bounded, region);
+}
+
+QTEST_MAIN(tst_qsgsoftwarerenderer)
+
+#include "tst_qsgsoftwarerenderer.moc"
@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qsgtexture
+macx:CONFIG -= app_bundle
+
+SOURCES += tst_qsgtexture.cpp
+
+QT += core-private gui-private qml quick-private testlib
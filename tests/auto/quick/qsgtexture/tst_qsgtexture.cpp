@@ -0,0 +1,164 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <qtest.h>
+#include <QtCore/QMutex>
+#include <QtQml/QQmlComponent>
+#include <QtQml/QQmlEngine>
+#include <QtQuick/QQuickItem>
+#include <QtQuick/QQuickWindow>
+#include <QtQuick/QSGRendererInterface>
+#include <QtQuick/QSGSimpleTextureNode>
+#include <private/qsgtexture_p.h>
+
+static const int textureBytes = 64 * 64 * 4;
+
+class TextureItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(QColor color MEMBER m_color)
+public:
+    TextureItem() { setFlag(ItemHasContents); }
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *) override
+    {
+        QSGSimpleTextureNode *node = static_cast<QSGSimpleTextureNode *>(oldNode);
+        if (!node) {
+            QImage image(64, 64, QImage::Format_ARGB32_Premultiplied);
+            image.fill(m_color);
+            node = new QSGSimpleTextureNode;
+            node->setTexture(window()->createTextureFromImage(image));
+            node->setOwnsTexture(true);
+        }
+        node->setRect(boundingRect());
+        return node;
+    }
+
+private:
+    QColor m_color;
+};
+
+class tst_qsgtexture : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void uploadBudget_data();
+    void uploadBudget();
+
+private:
+    void recordUploads();
+    int uploadCount();
+
+    QMutex m_mutex;
+    QVector<qint64> m_uploads;
+};
+
+void tst_qsgtexture::initTestCase()
+{
+    // Read once, before the first frame. Any texture goes over 1 kB, so
+    // each frame uploads a single one.
+    qputenv("QSG_TEXTURE_UPLOAD_BUDGET", "1");
+    qsg_enableTextureUploadCounting(true);
+    qmlRegisterType<TextureItem>("Test", 1, 0, "TextureItem");
+}
+
+void tst_qsgtexture::recordUploads()
+{
+    const qint64 bytes = qsg_takeTextureUploadBytes();
+    if (bytes > 0) {
+        QMutexLocker lock(&m_mutex);
+        m_uploads.append(bytes);
+    }
+}
+
+int tst_qsgtexture::uploadCount()
+{
+    QMutexLocker lock(&m_mutex);
+    return m_uploads.size();
+}
+
+void tst_qsgtexture::uploadBudget_data()
+{
+    QTest::addColumn<bool>("layer");
+    QTest::addColumn<QVector<qint64>>("uploads");
+
+    // The textures that did not fit are uploaded in the following frames,
+    // without anything else requesting an update.
+    QTest::newRow("window") << false << (QVector<qint64>() << textureBytes << textureBytes << textureBytes);
+    // A layer is not rendered again for deferred textures, so it uploads
+    // all of them at once.
+    QTest::newRow("layer") << true << (QVector<qint64>() << 3 * textureBytes);
+}
+
+void tst_qsgtexture::uploadBudget()
+{
+    QFETCH(bool, layer);
+    QFETCH(QVector<qint64>, uploads);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.12\n"
+                      "import QtQuick.Window 2.12\n"
+                      "import Test 1.0\n"
+                      "Window {\n"
+                      "    width: 240; height: 80\n"
+                      "    property bool layerEnabled\n"
+                      "    Row {\n"
+                      "        layer.enabled: layerEnabled\n"
+                      "        TextureItem { width: 80; height: 80; color: \"red\" }\n"
+                      "        TextureItem { width: 80; height: 80; color: \"green\" }\n"
+                      "        TextureItem { width: 80; height: 80; color: \"blue\" }\n"
+                      "    }\n"
+                      "}\n", QUrl());
+    QScopedPointer<QQuickWindow> window(qobject_cast<QQuickWindow *>(component.beginCreate(engine.rootContext())));
+    QVERIFY2(window, qPrintable(component.errorString()));
+    window->setProperty("layerEnabled", layer);
+    component.completeCreate();
+
+    m_uploads.clear();
+    connect(window.data(), &QQuickWindow::afterRendering, this, &tst_qsgtexture::recordUploads,
+            Qt::DirectConnection);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    if (window->rendererInterface()->graphicsApi() != QSGRendererInterface::OpenGL)
+        QSKIP("The upload budget only applies to OpenGL textures");
+
+    QTRY_COMPARE(uploadCount(), uploads.size());
+    // Give the window time to upload more than expected
+    QTest::qWait(100);
+    QMutexLocker lock(&m_mutex);
+    QCOMPARE(m_uploads, uploads);
+}
+
+QTEST_MAIN(tst_qsgtexture)
+
+#include "tst_qsgtexture.moc"
@@ -10,6 +10,10 @@ qtConfig(opengl(es1|es2)?) {
         rendernode
     qtHaveModule(widgets): PUBLICTESTS += nodes
 
+    PRIVATETESTS += \
+        qsgdistancefielddiskcache \
+        qsgtexture
+
     QUICKTESTS += \
         qquickanimatedsprite \
         qquickframebufferobject \
@@ -41,7 +45,8 @@ PRIVATETESTS += \
     qquickstyledtext \
     qquickstates \
     qquicksystempalette \
-    qquicktimeline
+    qquicktimeline \
+    qsgsoftwarerenderer
 
 QUICKTESTS += \
     pointerhandlers \
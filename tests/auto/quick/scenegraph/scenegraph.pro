@@ -11,6 +11,7 @@ QT += core-private gui-private qml-private quick-private  testlib
 
 
 OTHER_FILES += \
+    data/asyncDistanceFieldGlyphs.qml \
     data/render_OutOfFloatRange.qml \
     data/simple.qml \
     data/render_ImageFiltering.qml
@@ -43,6 +43,8 @@
 
 #include <private/qsgcontext_p.h>
 #include <private/qsgrenderloop_p.h>
+#include <private/qsgadaptationlayer_p.h>
+#include <private/qquickwindow_p.h>
 
 #include "../../shared/util.h"
 #include "../shared/visualtestutil.h"
@@ -113,6 +115,9 @@ private slots:
 #endif
     void createTextureFromImage_data();
     void createTextureFromImage();
+#if QT_CONFIG(opengl)
+    void asyncDistanceFieldGlyphs();
+#endif
 
 private:
     bool m_brokenMipmapSupport;
@@ -559,6 +564,41 @@ void tst_SceneGraph::createTextureFromImage()
     QCOMPARE(texture->hasAlphaChannel(), expectedAlpha);
 }
 
+#if QT_CONFIG(opengl)
+// A batch of new glyphs large enough to be generated on worker threads must
+// end up in the glyph cache without anything else triggering a new frame.
+void tst_SceneGraph::asyncDistanceFieldGlyphs()
+{
+    if (!isRunningOnOpenGL())
+        QSKIP("Skipping distance field test due to not running with OpenGL");
+
+    QQuickView view;
+    view.setSource(testFileUrl("asyncDistanceFieldGlyphs.qml"));
+    QObject *text = view.rootObject();
+    QVERIFY(text);
+
+    const QRawFont font = QRawFont::fromFont(text->property("font").value<QFont>());
+    const QVector<quint32> glyphs = font.glyphIndexesForString(text->property("text").toString());
+    QVERIFY(glyphs.size() >= 64);
+
+    // The cache is only accessed on the render thread.
+    QAtomicInt allUploaded;
+    connect(&view, &QQuickWindow::afterRendering, [&]() {
+        QSGRenderContext *rc = QQuickWindowPrivate::get(&view)->context;
+        QSGDistanceFieldGlyphCache *cache = rc->distanceFieldGlyphCache(font);
+        for (quint32 glyph : glyphs) {
+            if (!cache->glyphTexture(glyph)->textureId)
+                return;
+        }
+        allUploaded.store(1);
+    }, Qt::DirectConnection);
+
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QTRY_COMPARE(allUploaded.load(), 1);
+}
+#endif
+
 bool tst_SceneGraph::isRunningOnOpenGL()
 {
     bool retval = false;
@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.12
+
+// Components declared in the same document, each with states and transitions
+Item {
+    width: 400; height: 800
+
+    Component {
+        id: button
+        Rectangle {
+            id: control
+            property bool pressed: false
+            property bool checked: false
+            width: 120; height: 40
+            radius: 4
+            color: "lightgray"
+
+            Text { id: label; anchors.centerIn: parent; text: "Button" }
+
+            states: [
+                State {
+                    name: "pressed"; when: control.pressed
+                    PropertyChanges { target: control; color: "gray"; scale: 0.95 }
+                    PropertyChanges { target: label; color: "white" }
+                },
+                State {
+                    name: "checked"; when: control.checked
+                    PropertyChanges { target: control; color: "steelblue" }
+                    PropertyChanges { target: label; text: "Checked"; font.bold: true }
+                },
+                State {
+                    name: "disabled"; when: !control.enabled
+                    PropertyChanges { target: control; opacity: 0.5 }
+                }
+            ]
+            transitions: Transition {
+                ColorAnimation { duration: 100 }
+                NumberAnimation { properties: "scale,opacity"; duration: 100 }
+            }
+        }
+    }
+
+    Grid {
+        columns: 3
+        Repeater {
+            model: 30
+            Loader {
+                sourceComponent: button
+                onLoaded: {
+                    item.checked = index % 3 === 0
+                    item.enabled = index % 5 !== 0
+                }
+            }
+        }
+    }
+}
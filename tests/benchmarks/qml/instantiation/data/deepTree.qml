@@ -0,0 +1,62 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.12
+
+// A deep, regular item hierarchy as found in complex pages
+Item {
+    width: 800; height: 600
+
+    Repeater {
+        model: 4
+        Item {
+            x: index * 200; width: 200; height: 600
+            Repeater {
+                model: 4
+                Item {
+                    y: index * 150; width: 200; height: 150
+                    Repeater {
+                        model: 4
+                        Rectangle {
+                            x: index * 50; width: 50; height: 50
+                            color: "lightsteelblue"
+                            Item {
+                                anchors.fill: parent
+                                Item {
+                                    anchors.margins: 2
+                                    anchors.fill: parent
+                                    Rectangle { anchors.fill: parent; color: "transparent"; border.width: 1 }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
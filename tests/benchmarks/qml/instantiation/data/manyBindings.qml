@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.12
+
+// Delegates with many bindings, as in a typical list row
+Item {
+    width: 400; height: 2000
+
+    Repeater {
+        model: 40
+        Rectangle {
+            id: row
+            property bool selected: index % 3 === 0
+            property real progress: index / 40
+            x: 0
+            y: index * height
+            width: parent.width
+            height: 48
+            color: selected ? "lightsteelblue" : (index % 2 ? "white" : "whitesmoke")
+            border.color: selected ? "steelblue" : "transparent"
+            border.width: selected ? 2 : 0
+            opacity: 0.5 + progress / 2
+            clip: true
+
+            Rectangle {
+                id: icon
+                x: 8; y: (row.height - height) / 2
+                width: row.height - 16; height: width
+                radius: width / 2
+                color: Qt.rgba(row.progress, 0.5, 1 - row.progress, 1)
+            }
+            Text {
+                id: title
+                anchors.left: icon.right; anchors.leftMargin: 8
+                anchors.right: parent.right; anchors.rightMargin: 8
+                y: 4
+                text: "Item " + index
+                font.bold: row.selected
+                font.pixelSize: row.height / 3
+                elide: Text.ElideRight
+            }
+            Text {
+                anchors.left: title.left; anchors.right: title.right
+                anchors.top: title.bottom
+                text: "Progress " + Math.round(row.progress * 100) + "%"
+                color: row.selected ? "black" : "gray"
+                font.pixelSize: title.font.pixelSize * 0.75
+            }
+            Rectangle {
+                anchors.bottom: parent.bottom
+                width: parent.width * row.progress
+                height: 2
+                color: row.selected ? "steelblue" : "lightgray"
+                visible: row.progress > 0
+            }
+        }
+    }
+}
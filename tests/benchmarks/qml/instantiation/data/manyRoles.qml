@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.12
+
+// A model with many roles, all of which are used by the delegate
+Item {
+    width: 400; height: 1200
+
+    ListModel {
+        id: listModel
+        ListElement { name: "name 0"; title: "title 0"; subtitle: "subtitle 0"; description: "description 0"; author: "author 0"; category: "category 0"; url: "url 0"; icon: "icon 0"; color: "color 0"; tag: "tag 0"; count: 0; rating: 0; price: 0; width: 0; height: 0; enabled: false }
+        ListElement { name: "name 1"; title: "title 1"; subtitle: "subtitle 1"; description: "description 1"; author: "author 1"; category: "category 1"; url: "url 1"; icon: "icon 1"; color: "color 1"; tag: "tag 1"; count: 1; rating: 2; price: 3; width: 4; height: 5; enabled: true }
+        ListElement { name: "name 2"; title: "title 2"; subtitle: "subtitle 2"; description: "description 2"; author: "author 2"; category: "category 2"; url: "url 2"; icon: "icon 2"; color: "color 2"; tag: "tag 2"; count: 2; rating: 4; price: 6; width: 8; height: 10; enabled: false }
+        ListElement { name: "name 3"; title: "title 3"; subtitle: "subtitle 3"; description: "description 3"; author: "author 3"; category: "category 3"; url: "url 3"; icon: "icon 3"; color: "color 3"; tag: "tag 3"; count: 3; rating: 6; price: 9; width: 12; height: 15; enabled: true }
+        ListElement { name: "name 4"; title: "title 4"; subtitle: "subtitle 4"; description: "description 4"; author: "author 4"; category: "category 4"; url: "url 4"; icon: "icon 4"; color: "color 4"; tag: "tag 4"; count: 4; rating: 8; price: 12; width: 16; height: 20; enabled: false }
+        ListElement { name: "name 5"; title: "title 5"; subtitle: "subtitle 5"; description: "description 5"; author: "author 5"; category: "category 5"; url: "url 5"; icon: "icon 5"; color: "color 5"; tag: "tag 5"; count: 5; rating: 10; price: 15; width: 20; height: 25; enabled: true }
+        ListElement { name: "name 6"; title: "title 6"; subtitle: "subtitle 6"; description: "description 6"; author: "author 6"; category: "category 6"; url: "url 6"; icon: "icon 6"; color: "color 6"; tag: "tag 6"; count: 6; rating: 12; price: 18; width: 24; height: 30; enabled: false }
+        ListElement { name: "name 7"; title: "title 7"; subtitle: "subtitle 7"; description: "description 7"; author: "author 7"; category: "category 7"; url: "url 7"; icon: "icon 7"; color: "color 7"; tag: "tag 7"; count: 7; rating: 14; price: 21; width: 28; height: 35; enabled: true }
+        ListElement { name: "name 8"; title: "title 8"; subtitle: "subtitle 8"; description: "description 8"; author: "author 8"; category: "category 8"; url: "url 8"; icon: "icon 8"; color: "color 8"; tag: "tag 8"; count: 8; rating: 16; price: 24; width: 32; height: 40; enabled: false }
+        ListElement { name: "name 9"; title: "title 9"; subtitle: "subtitle 9"; description: "description 9"; author: "author 9"; category: "category 9"; url: "url 9"; icon: "icon 9"; color: "color 9"; tag: "tag 9"; count: 9; rating: 18; price: 27; width: 36; height: 45; enabled: true }
+        ListElement { name: "name 10"; title: "title 10"; subtitle: "subtitle 10"; description: "description 10"; author: "author 10"; category: "category 10"; url: "url 10"; icon: "icon 10"; color: "color 10"; tag: "tag 10"; count: 10; rating: 20; price: 30; width: 40; height: 50; enabled: false }
+        ListElement { name: "name 11"; title: "title 11"; subtitle: "subtitle 11"; description: "description 11"; author: "author 11"; category: "category 11"; url: "url 11"; icon: "icon 11"; color: "color 11"; tag: "tag 11"; count: 11; rating: 22; price: 33; width: 44; height: 55; enabled: true }
+        ListElement { name: "name 12"; title: "title 12"; subtitle: "subtitle 12"; description: "description 12"; author: "author 12"; category: "category 12"; url: "url 12"; icon: "icon 12"; color: "color 12"; tag: "tag 12"; count: 12; rating: 24; price: 36; width: 48; height: 60; enabled: false }
+        ListElement { name: "name 13"; title: "title 13"; subtitle: "subtitle 13"; description: "description 13"; author: "author 13"; category: "category 13"; url: "url 13"; icon: "icon 13"; color: "color 13"; tag: "tag 13"; count: 13; rating: 26; price: 39; width: 52; height: 65; enabled: true }
+        ListElement { name: "name 14"; title: "title 14"; subtitle: "subtitle 14"; description: "description 14"; author: "author 14"; category: "category 14"; url: "url 14"; icon: "icon 14"; color: "color 14"; tag: "tag 14"; count: 14; rating: 28; price: 42; width: 56; height: 70; enabled: false }
+        ListElement { name: "name 15"; title: "title 15"; subtitle: "subtitle 15"; description: "description 15"; author: "author 15"; category: "category 15"; url: "url 15"; icon: "icon 15"; color: "color 15"; tag: "tag 15"; count: 15; rating: 30; price: 45; width: 60; height: 75; enabled: true }
+        ListElement { name: "name 16"; title: "title 16"; subtitle: "subtitle 16"; description: "description 16"; author: "author 16"; category: "category 16"; url: "url 16"; icon: "icon 16"; color: "color 16"; tag: "tag 16"; count: 16; rating: 32; price: 48; width: 64; height: 80; enabled: false }
+        ListElement { name: "name 17"; title: "title 17"; subtitle: "subtitle 17"; description: "description 17"; author: "author 17"; category: "category 17"; url: "url 17"; icon: "icon 17"; color: "color 17"; tag: "tag 17"; count: 17; rating: 34; price: 51; width: 68; height: 85; enabled: true }
+        ListElement { name: "name 18"; title: "title 18"; subtitle: "subtitle 18"; description: "description 18"; author: "author 18"; category: "category 18"; url: "url 18"; icon: "icon 18"; color: "color 18"; tag: "tag 18"; count: 18; rating: 36; price: 54; width: 72; height: 90; enabled: false }
+        ListElement { name: "name 19"; title: "title 19"; subtitle: "subtitle 19"; description: "description 19"; author: "author 19"; category: "category 19"; url: "url 19"; icon: "icon 19"; color: "color 19"; tag: "tag 19"; count: 19; rating: 38; price: 57; width: 76; height: 95; enabled: true }
+        ListElement { name: "name 20"; title: "title 20"; subtitle: "subtitle 20"; description: "description 20"; author: "author 20"; category: "category 20"; url: "url 20"; icon: "icon 20"; color: "color 20"; tag: "tag 20"; count: 20; rating: 40; price: 60; width: 80; height: 100; enabled: false }
+        ListElement { name: "name 21"; title: "title 21"; subtitle: "subtitle 21"; description: "description 21"; author: "author 21"; category: "category 21"; url: "url 21"; icon: "icon 21"; color: "color 21"; tag: "tag 21"; count: 21; rating: 42; price: 63; width: 84; height: 105; enabled: true }
+        ListElement { name: "name 22"; title: "title 22"; subtitle: "subtitle 22"; description: "description 22"; author: "author 22"; category: "category 22"; url: "url 22"; icon: "icon 22"; color: "color 22"; tag: "tag 22"; count: 22; rating: 44; price: 66; width: 88; height: 110; enabled: false }
+        ListElement { name: "name 23"; title: "title 23"; subtitle: "subtitle 23"; description: "description 23"; author: "author 23"; category: "category 23"; url: "url 23"; icon: "icon 23"; color: "color 23"; tag: "tag 23"; count: 23; rating: 46; price: 69; width: 92; height: 115; enabled: true }
+        ListElement { name: "name 24"; title: "title 24"; subtitle: "subtitle 24"; description: "description 24"; author: "author 24"; category: "category 24"; url: "url 24"; icon: "icon 24"; color: "color 24"; tag: "tag 24"; count: 24; rating: 48; price: 72; width: 96; height: 120; enabled: false }
+        ListElement { name: "name 25"; title: "title 25"; subtitle: "subtitle 25"; description: "description 25"; author: "author 25"; category: "category 25"; url: "url 25"; icon: "icon 25"; color: "color 25"; tag: "tag 25"; count: 25; rating: 50; price: 75; width: 100; height: 125; enabled: true }
+        ListElement { name: "name 26"; title: "title 26"; subtitle: "subtitle 26"; description: "description 26"; author: "author 26"; category: "category 26"; url: "url 26"; icon: "icon 26"; color: "color 26"; tag: "tag 26"; count: 26; rating: 52; price: 78; width: 104; height: 130; enabled: false }
+        ListElement { name: "name 27"; title: "title 27"; subtitle: "subtitle 27"; description: "description 27"; author: "author 27"; category: "category 27"; url: "url 27"; icon: "icon 27"; color: "color 27"; tag: "tag 27"; count: 27; rating: 54; price: 81; width: 108; height: 135; enabled: true }
+        ListElement { name: "name 28"; title: "title 28"; subtitle: "subtitle 28"; description: "description 28"; author: "author 28"; category: "category 28"; url: "url 28"; icon: "icon 28"; color: "color 28"; tag: "tag 28"; count: 28; rating: 56; price: 84; width: 112; height: 140; enabled: false }
+        ListElement { name: "name 29"; title: "title 29"; subtitle: "subtitle 29"; description: "description 29"; author: "author 29"; category: "category 29"; url: "url 29"; icon: "icon 29"; color: "color 29"; tag: "tag 29"; count: 29; rating: 58; price: 87; width: 116; height: 145; enabled: true }
+    }
+
+    Column {
+        Repeater {
+            model: listModel
+            Item {
+                width: 400; height: 40
+                enabled: model.enabled
+                Text { text: name + " " + title; font.bold: rating > 10 }
+                Text { x: 100; text: subtitle + " - " + description }
+                Text { x: 200; text: author + " / " + category; color: model.color === "" ? "black" : "gray" }
+                Text { x: 300; text: tag + " " + count + " " + price }
+                Item { width: model.width; height: model.height; objectName: url + icon }
+            }
+        }
+    }
+}
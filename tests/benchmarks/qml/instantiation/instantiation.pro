@@ -0,0 +1,16 @@
+CONFIG += benchmark qtquickcompiler
+TEMPLATE = app
+TARGET = tst_instantiation
+QT += qml quick testlib
+macx:CONFIG -= app_bundle
+
+SOURCES += tst_instantiation.cpp
+
+RESOURCES += \
+    data/deepTree.qml \
+    data/manyBindings.qml \
+    data/nestedLoaders.qml \
+    data/componentsWithStates.qml \
+    data/manyRoles.qml
+
+DEFINES += SRCDIR=\\\"$$PWD\\\"
@@ -0,0 +1,310 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QQmlEngine>
+#include <QQmlComponent>
+#include <QQmlIncubator>
+#include <QQuickItem>
+#include <QTemporaryDir>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSet>
+#include <QDebug>
+
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+// Counts the allocations made through the global operator new and new[] by
+// the whole process, including the Qt libraries, so that allocations per
+// created object can be reported. Memory allocated with malloc directly, such
+// as the data of QString, QByteArray and the other implicitly shared
+// containers, is not included.
+static QBasicAtomicInteger<quint64> allocationCount = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+static void *countedAllocation(std::size_t size)
+{
+    allocationCount.fetchAndAddRelaxed(1);
+    void *ptr = std::malloc(size ? size : 1);
+    Q_CHECK_PTR(ptr);
+    return ptr;
+}
+
+void *operator new(std::size_t size)
+{
+    return countedAllocation(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return countedAllocation(size);
+}
+
+void operator delete(void *ptr) Q_DECL_NOTHROW
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) Q_DECL_NOTHROW
+{
+    std::free(ptr);
+}
+
+static qint64 peakMemoryKB()
+{
+#if defined(Q_OS_LINUX)
+    QFile status(QStringLiteral("/proc/self/status"));
+    if (status.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        const QList<QByteArray> lines = status.readAll().split('\n');
+        for (const QByteArray &line : lines) {
+            if (line.startsWith("VmHWM:"))
+                return line.mid(6).trimmed().split(' ').first().toLongLong();
+        }
+    }
+#endif
+    return -1;
+}
+
+static void collectObjects(QObject *object, QSet<QObject *> *objects)
+{
+    if (!object || objects->contains(object))
+        return;
+    objects->insert(object);
+    for (QObject *child : object->children())
+        collectObjects(child, objects);
+    if (QQuickItem *item = qobject_cast<QQuickItem *>(object)) {
+        for (QQuickItem *child : item->childItems())
+            collectObjects(child, objects);
+    }
+}
+
+class tst_instantiation : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_instantiation();
+
+private slots:
+    void initTestCase();
+
+    void cold_data() { shapes(); }
+    void cold();
+    void warm_data() { shapes(); }
+    void warm();
+    void aot_data() { shapes(); }
+    void aot();
+    void incubated_data() { shapes(); }
+    void incubated();
+
+private:
+    void shapes();
+    QUrl sourceUrl(const QString &file) const;
+    QUrl warmUrl(const QString &file) const;
+    typedef std::function<QObject *()> Creator;
+    void report(const QString &mode, const QString &file, const Creator &create, bool clear);
+    void clearCache();
+
+    QQmlEngine engine;
+    QQmlIncubationController controller;
+    QTemporaryDir warmDir;
+};
+
+tst_instantiation::tst_instantiation()
+{
+    engine.setIncubationController(&controller);
+}
+
+void tst_instantiation::initTestCase()
+{
+    QVERIFY(warmDir.isValid());
+    const QStringList files = QDir(QLatin1String(SRCDIR "/data")).entryList(QStringList(QLatin1String("*.qml")));
+    QVERIFY(!files.isEmpty());
+    for (const QString &file : files)
+        QVERIFY(QFile::copy(QLatin1String(SRCDIR "/data/") + file, warmDir.filePath(file)));
+}
+
+void tst_instantiation::shapes()
+{
+    QTest::addColumn<QString>("file");
+
+    QTest::newRow("deep item tree") << "deepTree.qml";
+    QTest::newRow("delegates with many bindings") << "manyBindings.qml";
+    QTest::newRow("nested loaders") << "nestedLoaders.qml";
+    QTest::newRow("components with states") << "componentsWithStates.qml";
+    QTest::newRow("model with many roles") << "manyRoles.qml";
+}
+
+QUrl tst_instantiation::sourceUrl(const QString &file) const
+{
+    return QUrl::fromLocalFile(QLatin1String(SRCDIR "/data/") + file);
+}
+
+QUrl tst_instantiation::warmUrl(const QString &file) const
+{
+    return QUrl::fromLocalFile(warmDir.filePath(file));
+}
+
+void tst_instantiation::clearCache()
+{
+    engine.collectGarbage();
+    engine.clearComponentCache();
+}
+
+// Runs the creation path of a mode once more outside of the benchmark loop and
+// reports the creation rate, the heap allocations per object and the peak
+// memory. If \a clear is set, the component cache is cleared before, but not
+// while, the creation is timed.
+void tst_instantiation::report(const QString &mode, const QString &file, const Creator &create, bool clear)
+{
+    if (clear)
+        clearCache();
+
+    const quint64 allocationsBefore = allocationCount.load();
+    QElapsedTimer timer;
+    timer.start();
+    QScopedPointer<QObject> object(create());
+    const qint64 nsecs = timer.nsecsElapsed();
+    const quint64 allocations = allocationCount.load() - allocationsBefore;
+    QVERIFY(object);
+
+    QSet<QObject *> objects;
+    collectObjects(object.data(), &objects);
+    const int count = objects.size();
+
+    qInfo().noquote() << QString::fromLatin1("%1 %2: %3 objects, %4 objects/s, %5 allocations/object, peak memory %6 kB")
+                         .arg(mode, file)
+                         .arg(count)
+                         .arg(nsecs ? qint64(count * 1e9 / nsecs) : 0)
+                         .arg(double(allocations) / count, 0, 'f', 1)
+                         .arg(peakMemoryKB());
+}
+
+// Compiles the document from source on every iteration, without disk cache.
+void tst_instantiation::cold()
+{
+    QFETCH(QString, file);
+
+    QFile source(sourceUrl(file).toLocalFile());
+    QVERIFY(source.open(QIODevice::ReadOnly));
+    const QByteArray data = source.readAll();
+    const QUrl url = sourceUrl(file);
+
+    const Creator create = [this, &data, &url]() {
+        QQmlComponent component(&engine);
+        component.setData(data, url);
+        return component.create();
+    };
+
+    QBENCHMARK {
+        clearCache();
+        QScopedPointer<QObject> object(create());
+        QVERIFY(object);
+    }
+
+    report(QLatin1String("cold"), file, create, true);
+}
+
+// Loads the document from the .qmlc disk cache written by the first load.
+void tst_instantiation::warm()
+{
+    QFETCH(QString, file);
+    const QUrl url = warmUrl(file);
+
+    const Creator create = [this, &url]() {
+        QQmlComponent component(&engine, url);
+        return component.create();
+    };
+
+    {
+        QQmlComponent component(&engine, url);
+        QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+        QScopedPointer<QObject> object(component.create());
+        QVERIFY(object);
+    }
+
+    QBENCHMARK {
+        clearCache();
+        QScopedPointer<QObject> object(create());
+        QVERIFY(object);
+    }
+
+    report(QLatin1String("warm"), file, create, true);
+}
+
+// Loads the document compiled ahead of time by qmlcachegen.
+void tst_instantiation::aot()
+{
+    QFETCH(QString, file);
+    const QUrl url(QLatin1String("qrc:/data/") + file);
+
+    const Creator create = [this, &url]() {
+        QQmlComponent component(&engine, url);
+        return component.create();
+    };
+
+    QBENCHMARK {
+        clearCache();
+        QScopedPointer<QObject> object(create());
+        QVERIFY(object);
+    }
+
+    report(QLatin1String("aot"), file, create, true);
+}
+
+// Creates instances of an already compiled component through QQmlIncubator.
+void tst_instantiation::incubated()
+{
+    QFETCH(QString, file);
+
+    QQmlComponent component(&engine, sourceUrl(file));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    const Creator create = [this, &component]() -> QObject * {
+        QQmlIncubator incubator;
+        component.create(incubator);
+        bool b = true;
+        controller.incubateWhile(&b);
+        if (!incubator.isReady())
+            return nullptr;
+        return incubator.object();
+    };
+
+    QBENCHMARK {
+        QScopedPointer<QObject> object(create());
+        QVERIFY(object);
+    }
+
+    report(QLatin1String("incubated"), file, create, false);
+}
+
+QTEST_MAIN(tst_instantiation)
+
+#include "tst_instantiation.moc"
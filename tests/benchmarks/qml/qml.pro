@@ -6,11 +6,13 @@ SUBDIRS += \
            javascript \
            holistic \
            qqmlchangeset \
+           qqmllistcompositor \
            qqmlcomponent \
            qqmlmetaproperty \
            librarymetrics_performance \
            script \
            js \
-           creation
+           creation \
+           instantiation
 
 qtHaveModule(opengl): SUBDIRS += painting qquickwindow
@@ -0,0 +1,133 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+
+#include <private/qqmllistcompositor_p.h>
+
+class tst_qqmllistcompositor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void find_data();
+    void find();
+    void setFlags_data();
+    void setFlags();
+    void move_data();
+    void move();
+
+private:
+    void fragment(QQmlListCompositor *compositor, int count);
+};
+
+static const int MaxRows = 20000;
+
+static int list;
+
+// Puts every third item into the Persisted group, leaving the compositor with roughly
+// 2 * count / 3 ranges as a filtered DelegateModelGroup would.
+void tst_qqmllistcompositor::fragment(QQmlListCompositor *compositor, int count)
+{
+    compositor->setGroupCount(3);
+    compositor->append(&list, 0, count, QQmlListCompositor::DefaultFlag | QQmlListCompositor::PrependFlag);
+    for (int i = 0; i < count; i += 3)
+        compositor->setFlags(QQmlListCompositor::Default, i, 1, QQmlListCompositor::PersistedFlag);
+}
+
+void tst_qqmllistcompositor::find_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("10000") << 10000;
+    QTest::newRow("20000") << MaxRows;
+}
+
+void tst_qqmllistcompositor::find()
+{
+    QFETCH(int, count);
+
+    QQmlListCompositor compositor;
+    fragment(&compositor, count);
+
+    const int persisted = compositor.count(QQmlListCompositor::Persisted);
+    QBENCHMARK {
+        // Alternate between both ends so no lookup is adjacent to the previous one.
+        for (int i = 0; i < persisted / 2; ++i) {
+            compositor.find(QQmlListCompositor::Persisted, i);
+            compositor.find(QQmlListCompositor::Default, count - 1 - i);
+        }
+    }
+}
+
+void tst_qqmllistcompositor::setFlags_data()
+{
+    find_data();
+}
+
+void tst_qqmllistcompositor::setFlags()
+{
+    QFETCH(int, count);
+
+    QQmlListCompositor compositor;
+    fragment(&compositor, count);
+
+    QBENCHMARK {
+        // Toggle the membership of items spread over the whole compositor.
+        for (int i = 0; i < count; i += 7) {
+            const int index = (i * 13) % count;
+            compositor.setFlags(QQmlListCompositor::Default, index, 1, QQmlListCompositor::PersistedFlag);
+            compositor.clearFlags(QQmlListCompositor::Default, count - 1 - index, 1, QQmlListCompositor::PersistedFlag);
+        }
+    }
+}
+
+void tst_qqmllistcompositor::move_data()
+{
+    find_data();
+}
+
+void tst_qqmllistcompositor::move()
+{
+    QFETCH(int, count);
+
+    QQmlListCompositor compositor;
+    fragment(&compositor, count);
+
+    QBENCHMARK {
+        for (int i = 0; i < count; i += 7) {
+            compositor.move(
+                    QQmlListCompositor::Default, i, QQmlListCompositor::Default, count - 1 - i, 1,
+                    QQmlListCompositor::Default);
+        }
+    }
+}
+
+QTEST_MAIN(tst_qqmllistcompositor)
+#include "tst_qqmllistcompositor.moc"
@@ -0,0 +1,67 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+import QtQuick 2.0
+
+Rectangle {
+    id: root
+    width: 1920
+    height: 1080
+    color: "gray"
+
+    property bool phase: false
+
+    Canvas {
+        id: canvas
+        width: 64
+        height: 64
+        visible: false
+        onPaint: {
+            var ctx = getContext("2d");
+            var gradient = ctx.createLinearGradient(0, 0, width, height);
+            gradient.addColorStop(0, "red");
+            gradient.addColorStop(1, "blue");
+            ctx.fillStyle = gradient;
+            ctx.fillRect(0, 0, width, height);
+        }
+    }
+
+    Grid {
+        columns: 15
+        spacing: 4
+        Repeater {
+            model: 15 * 8
+            ShaderEffectSource {
+                width: 124
+                height: 124
+                sourceItem: canvas
+                smooth: true
+                rotation: root.phase ? 3 : 0
+            }
+        }
+    }
+}
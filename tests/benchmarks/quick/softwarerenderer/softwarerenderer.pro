@@ -0,0 +1,9 @@
+CONFIG += benchmark
+TEMPLATE = app
+TARGET = tst_softwarerenderer
+QT += quick qml testlib
+macos:CONFIG -= app_bundle
+
+SOURCES += tst_softwarerenderer.cpp
+
+include (../../../auto/shared/util.pri)
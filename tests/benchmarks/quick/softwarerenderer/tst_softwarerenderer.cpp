@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtQuick>
+#include <QDebug>
+#include "../../../auto/shared/util.h"
+
+// Measures full window repaints with the software scene graph backend. Run
+// with QSG_SOFTWARE_RENDER_THREADS=1 to compare against painting the whole
+// frame on the render thread.
+class tst_softwarerenderer : public QQmlDataTest
+{
+    Q_OBJECT
+
+public:
+    tst_softwarerenderer();
+
+private slots:
+    void fullRepaint_data();
+    void fullRepaint();
+};
+
+tst_softwarerenderer::tst_softwarerenderer()
+{
+    QQuickWindow::setSceneGraphBackend(QSGRendererInterface::Software);
+}
+
+void tst_softwarerenderer::fullRepaint_data()
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<QSize>("size");
+
+    const QVector<QSize> sizes = { QSize(1920, 1080), QSize(3840, 2160) };
+    for (const QSize &size : sizes) {
+        const QByteArray suffix = " " + QByteArray::number(size.width()) + "x" + QByteArray::number(size.height());
+        QTest::newRow(QByteArray("rectangles" + suffix)) << "rectangles.qml" << size;
+        QTest::newRow(QByteArray("gradients" + suffix)) << "gradients.qml" << size;
+        QTest::newRow(QByteArray("text" + suffix)) << "text.qml" << size;
+        QTest::newRow(QByteArray("images" + suffix)) << "images.qml" << size;
+    }
+}
+
+void tst_softwarerenderer::fullRepaint()
+{
+    QFETCH(QString, file);
+    QFETCH(QSize, size);
+
+    QQuickView view;
+    view.setResizeMode(QQuickView::SizeRootObjectToView);
+    view.setSource(testFileUrl(file));
+    QVERIFY2(view.status() == QQuickView::Ready, qPrintable(view.errors().value(0).toString()));
+    view.resize(size);
+
+    QObject *root = view.rootObject();
+    QVERIFY(root);
+
+    // The first grab creates the backing store and fills the caches.
+    QImage image = view.grabWindow();
+    QCOMPARE(image.size(), size * view.effectiveDevicePixelRatio());
+
+    bool phase = false;
+    QBENCHMARK {
+        phase = !phase;
+        root->setProperty("phase", phase);
+        image = view.grabWindow();
+    }
+}
+
+QTEST_MAIN(tst_softwarerenderer)
+
+#include "tst_softwarerenderer.moc"